@@ -0,0 +1,577 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "SaveBenchmark.h"
+#include "SaveGameSubsystem.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace SaveBenchmark
+{
+	namespace
+	{
+		// Roughly what a fully scripted car holds
+		constexpr int32 ContainersPerCar = 48;
+		constexpr int32 DoorsPerCar = 6;
+		constexpr int32 DestructiblesPerCar = 32;
+		constexpr int32 StepsPerQuest = 16;
+
+		const ESaveChunkType AllSections[] =
+		{
+			ESaveChunkType::Global,
+			ESaveChunkType::Player,
+			ESaveChunkType::Car,
+			ESaveChunkType::NPCs,
+			ESaveChunkType::Quests,
+			ESaveChunkType::Companions
+		};
+
+		const TCHAR* SectionName(ESaveChunkType Type)
+		{
+			switch (Type)
+			{
+			case ESaveChunkType::Global:		return TEXT("Global");
+			case ESaveChunkType::Player:		return TEXT("Player");
+			case ESaveChunkType::Car:			return TEXT("Cars");
+			case ESaveChunkType::NPCs:			return TEXT("NPCs");
+			case ESaveChunkType::Quests:		return TEXT("Quests");
+			case ESaveChunkType::Companions:	return TEXT("Companions");
+			default:							return TEXT("Unknown");
+			}
+		}
+
+		void FillBits(FSaveBitField& Field, int32 NumBits, float Probability, FRandomStream& Rng)
+		{
+			Field.SetNum(NumBits);
+			for (int32 i = 0; i < NumBits; ++i)
+			{
+				Field.Set(i, Rng.FRand() < Probability);
+			}
+		}
+
+		bool CompressBytes(const TArray<uint8>& Bytes, TArray<uint8>& OutCompressed)
+		{
+			int32 Size = FCompression::CompressMemoryBound(NAME_LZ4, Bytes.Num());
+			OutCompressed.SetNumUninitialized(Size);
+			if (!FCompression::CompressMemory(NAME_LZ4, OutCompressed.GetData(), Size, Bytes.GetData(), Bytes.Num()))
+			{
+				OutCompressed = Bytes;
+				return false;
+			}
+			OutCompressed.SetNum(Size, EAllowShrinking::No);
+			return true;
+		}
+
+		template <typename T>
+		TArray<uint8> SerializeSection(T& Section, int32 FormatVersion)
+		{
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			SaveEncoding::SetFormatVersion(Writer, FormatVersion);
+			Writer << Section;
+			return Bytes;
+		}
+
+		/** Serialize every chunk of one section the way FSaveChunkStore lays them out. */
+		void SerializeChunks(FSaveGameData& Source, ESaveChunkType Type, int32 FormatVersion, TArray<TArray<uint8>>& OutChunks)
+		{
+			OutChunks.Reset();
+			switch (Type)
+			{
+			case ESaveChunkType::Global:
+				OutChunks.Add(SerializeSection(Source.GlobalState, FormatVersion));
+				break;
+			case ESaveChunkType::Player:
+				OutChunks.Add(SerializeSection(Source.PlayerState, FormatVersion));
+				break;
+			case ESaveChunkType::Quests:
+				OutChunks.Add(SerializeSection(Source.QuestStates, FormatVersion));
+				break;
+			case ESaveChunkType::Companions:
+				OutChunks.Add(SerializeSection(Source.CompanionStates, FormatVersion));
+				break;
+			case ESaveChunkType::Car:
+				for (FSaveCarState& Car : Source.ModifiedCars)
+				{
+					OutChunks.Add(SerializeSection(Car, FormatVersion));
+				}
+				break;
+			case ESaveChunkType::NPCs:
+			{
+				TMap<int32, TArray<FSaveNPCState*>> NPCsByCar;
+				for (FSaveNPCState& NPC : Source.NPCStates)
+				{
+					NPCsByCar.FindOrAdd(NPC.CurrentCarIndex).Add(&NPC);
+				}
+				for (TPair<int32, TArray<FSaveNPCState*>>& Pair : NPCsByCar)
+				{
+					TArray<uint8>& Bytes = OutChunks.AddDefaulted_GetRef();
+					FMemoryWriter Writer(Bytes);
+					SaveEncoding::SetFormatVersion(Writer, FormatVersion);
+					int32 NumNPCs = Pair.Value.Num();
+					Writer << NumNPCs;
+					for (FSaveNPCState* NPC : Pair.Value)
+					{
+						Writer << *NPC;
+					}
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+
+		double MillisecondsSince(double StartSeconds)
+		{
+			return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+		}
+	}
+
+	// ========================================================================
+	// Synthetic Data
+	// ========================================================================
+
+	FSaveGameData MakeSyntheticPlaythrough(const FSyntheticConfig& Config)
+	{
+		FRandomStream Rng(Config.Seed);
+		FSaveGameData Data;
+
+		Data.Header.PlayTimeSeconds = 36000.f;
+		Data.Header.CurrentCarIndex = Config.NumCars;
+
+		FSaveGlobalState& Global = Data.GlobalState;
+		Global.WorldTimeSeconds = 36000.0;
+		FillBits(Global.RevolutionFlags, 32, 0.3f, Rng);
+		for (int32& Rep : Global.FactionReputations)
+		{
+			Rep = Rng.RandRange(-1000, 1000);
+		}
+		for (int32 i = 0; i < Config.NumCars && i < Global.DiscoveredCars.Num(); ++i)
+		{
+			Global.DiscoveredCars.Set(i, true);
+		}
+		for (int32 i = 0; i < 200; ++i)
+		{
+			Global.GlobalEventLog.Add(FName(TEXT("Event"), i % 40));
+		}
+
+		FSavePlayerState& Player = Data.PlayerState;
+		Player.CurrentCarIndex = Config.NumCars;
+		Player.Level = 18;
+		Player.XP = 41250;
+		for (int32 i = 0; i < Config.NumInventoryItems; ++i)
+		{
+			FSaveItemEntry& Item = Player.InventoryItems.AddDefaulted_GetRef();
+			Item.ItemID = FName(TEXT("Item"), i);
+			Item.StackCount = Rng.RandRange(1, 20);
+			Item.Durability = Rng.FRand();
+		}
+
+		for (int32 CarIndex = 1; CarIndex <= Config.NumCars; ++CarIndex)
+		{
+			FSaveCarState& Car = Data.ModifiedCars.AddDefaulted_GetRef();
+			Car.CarIndex = CarIndex;
+			FillBits(Car.LootedContainers, ContainersPerCar, 0.6f, Rng);
+			FillBits(Car.DestroyedDestructibles, DestructiblesPerCar, 0.2f, Rng);
+			Car.DoorStates.SetNumZeroed(DoorsPerCar);
+			for (uint8& Door : Car.DoorStates)
+			{
+				Door = static_cast<uint8>(Rng.RandRange(0, 3));
+			}
+			for (int32 i = 0; i < FMath::Min(3, Config.NPCsPerCar); ++i)
+			{
+				FSaveNPCOverride& Override = Car.NPCOverrides.AddDefaulted_GetRef();
+				Override.NPCID = FName(TEXT("NPC"), CarIndex * Config.NPCsPerCar + i);
+				Override.bDead = Rng.FRand() < 0.3f;
+				Override.bAlerted = Rng.FRand() < 0.5f;
+			}
+			Car.ClutterSeed = static_cast<int32>(Rng.GetUnsignedInt());
+			Car.CustomFlags.Add(FName(TEXT("CarFlag"), CarIndex % 7));
+
+			for (int32 i = 0; i < Config.NPCsPerCar; ++i)
+			{
+				FSaveNPCState& NPC = Data.NPCStates.AddDefaulted_GetRef();
+				NPC.NPCID = FName(TEXT("NPC"), CarIndex * Config.NPCsPerCar + i);
+				NPC.CurrentCarIndex = CarIndex;
+				NPC.Disposition = Rng.RandRange(-100, 100);
+				NPC.bAlive = Rng.FRand() > 0.1f;
+				NPC.MemoryTags.Add(FName(TEXT("Memory"), i % 5));
+			}
+		}
+
+		for (int32 i = 0; i < Config.NumQuests; ++i)
+		{
+			FSaveQuestState& Quest = Data.QuestStates.AddDefaulted_GetRef();
+			Quest.QuestID = FName(TEXT("Quest"), i);
+			Quest.Status = static_cast<uint8>(Rng.RandRange(0, 3));
+			Quest.CurrentStep = Rng.RandRange(0, StepsPerQuest - 1);
+			FillBits(Quest.StepFlags, StepsPerQuest, 0.5f, Rng);
+		}
+
+		for (int32 i = 0; i < Config.NumCompanions; ++i)
+		{
+			FSaveCompanionState& Companion = Data.CompanionStates.AddDefaulted_GetRef();
+			Companion.CompanionIndex = static_cast<uint8>(i);
+			Companion.bRecruited = i < 5;
+			Companion.Loyalty = Rng.RandRange(-100, 100);
+		}
+
+		return Data;
+	}
+
+	FSaveSnapshot MakeSnapshot(const FSaveGameData& Data)
+	{
+		FSaveSnapshot Snapshot;
+		Snapshot.Header = Data.Header;
+		Snapshot.GlobalState = Data.GlobalState;
+		Snapshot.PlayerState = Data.PlayerState;
+		Snapshot.QuestStates = Data.QuestStates;
+		Snapshot.CompanionStates = Data.CompanionStates;
+
+		TSharedRef<TArray<FSaveCarStateRef>, ESPMode::ThreadSafe> Cars = MakeShared<TArray<FSaveCarStateRef>, ESPMode::ThreadSafe>();
+		Cars->Reserve(Data.ModifiedCars.Num());
+		for (const FSaveCarState& Car : Data.ModifiedCars)
+		{
+			// A revision of 0 means "unknown" and is always re-encoded, so stamp each car
+			// the way UpdateCarState would; writing the same snapshot again then reuses its chunks
+			TSharedRef<FSaveCarState, ESPMode::ThreadSafe> Copy = MakeShared<FSaveCarState, ESPMode::ThreadSafe>(Car);
+			if (Copy->SaveRevision == 0)
+			{
+				Copy->SaveRevision = static_cast<uint32>(Cars->Num()) + 1;
+			}
+			Cars->Add(Copy);
+		}
+		Snapshot.Cars = Cars;
+		Snapshot.NPCStates = MakeShared<const TArray<FSaveNPCState>, ESPMode::ThreadSafe>(Data.NPCStates);
+		return Snapshot;
+	}
+
+	// ========================================================================
+	// Size
+	// ========================================================================
+
+	FSizeReport MeasureSize(const FSaveGameData& Data, int32 FormatVersion)
+	{
+		FSaveGameData& Source = const_cast<FSaveGameData&>(Data);
+
+		FSizeReport Report;
+		Report.FormatVersion = FormatVersion;
+
+		TArray<TArray<uint8>> Chunks;
+		TArray<uint8> Compressed;
+		for (const ESaveChunkType Type : AllSections)
+		{
+			SerializeChunks(Source, Type, FormatVersion, Chunks);
+			for (const TArray<uint8>& Bytes : Chunks)
+			{
+				CompressBytes(Bytes, Compressed);
+				Report.RawBytes += Bytes.Num();
+				Report.CompressedBytes += Compressed.Num();
+				if (Type == ESaveChunkType::Car)
+				{
+					Report.CarRawBytes += Bytes.Num();
+					Report.CarCompressedBytes += Compressed.Num();
+				}
+			}
+		}
+
+		return Report;
+	}
+
+	void MeasureCarCacheMemory(const FSaveGameData& Data, int64& OutBitFieldBytes, int64& OutBoolArrayBytes)
+	{
+		OutBitFieldBytes = 0;
+		OutBoolArrayBytes = 0;
+		for (const FSaveCarState& Car : Data.ModifiedCars)
+		{
+			OutBitFieldBytes += Car.LootedContainers.GetAllocatedSize() + Car.DestroyedDestructibles.GetAllocatedSize();
+			OutBoolArrayBytes += (Car.LootedContainers.Num() + Car.DestroyedDestructibles.Num()) * sizeof(bool);
+		}
+	}
+
+	void RunSizeBenchmark(const FSyntheticConfig& Config)
+	{
+		const FSaveGameData Data = MakeSyntheticPlaythrough(Config);
+
+		UE_LOG(LogTemp, Display, TEXT("SaveBenchmark: %d cars, %d NPCs, %d quests"),
+			Data.ModifiedCars.Num(), Data.NPCStates.Num(), Data.QuestStates.Num());
+
+		const FSizeReport Before = MeasureSize(Data, SAVE_FORMAT_VERSION_PACKED - 1);
+		const FSizeReport After = MeasureSize(Data, SAVE_FORMAT_VERSION);
+		for (const FSizeReport* Report : { &Before, &After })
+		{
+			UE_LOG(LogTemp, Display, TEXT("  format %d: payload %lld raw / %lld LZ4, cars %lld raw / %lld LZ4"),
+				Report->FormatVersion, Report->RawBytes, Report->CompressedBytes,
+				Report->CarRawBytes, Report->CarCompressedBytes);
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("  payload ratio %.2fx raw, %.2fx LZ4; car chunks %.2fx raw"),
+			static_cast<double>(Before.RawBytes) / FMath::Max<int64>(After.RawBytes, 1),
+			static_cast<double>(Before.CompressedBytes) / FMath::Max<int64>(After.CompressedBytes, 1),
+			static_cast<double>(Before.CarRawBytes) / FMath::Max<int64>(After.CarRawBytes, 1));
+
+		int64 BitFieldBytes = 0;
+		int64 BoolArrayBytes = 0;
+		MeasureCarCacheMemory(Data, BitFieldBytes, BoolArrayBytes);
+		UE_LOG(LogTemp, Display, TEXT("  car cache flags: %lld bytes as TArray<bool>, %lld bytes bit-packed"),
+			BoolArrayBytes, BitFieldBytes);
+	}
+
+	// ========================================================================
+	// Throughput
+	// ========================================================================
+
+	FThroughputReport MeasureThroughput(const FSaveGameData& Data, int32 Iterations, const FString& ScratchFilePath)
+	{
+		FSaveGameData& Source = const_cast<FSaveGameData&>(Data);
+		Iterations = FMath::Max(Iterations, 1);
+
+		FThroughputReport Report;
+		Report.Iterations = Iterations;
+		for (const ESaveChunkType Type : AllSections)
+		{
+			Report.Sections.AddDefaulted_GetRef().Type = Type;
+		}
+
+		TArray<TArray<uint8>> Chunks;
+		TArray<TArray<uint8>> Compressed;
+		TArray<uint8> Decompressed;
+		TArray<uint8> FileBytes;
+		FSHA256Signature Signature;
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FileBytes.Reset();
+
+			for (FSectionTiming& Section : Report.Sections)
+			{
+				double Start = FPlatformTime::Seconds();
+				SerializeChunks(Source, Section.Type, SAVE_FORMAT_VERSION, Chunks);
+				Section.SerializeMs += MillisecondsSince(Start);
+
+				Start = FPlatformTime::Seconds();
+				for (const TArray<uint8>& Bytes : Chunks)
+				{
+					FSHA256::HashBuffer(Bytes.GetData(), Bytes.Num(), Signature.Signature);
+				}
+				Section.HashMs += MillisecondsSince(Start);
+
+				Compressed.SetNum(Chunks.Num());
+				Start = FPlatformTime::Seconds();
+				for (int32 i = 0; i < Chunks.Num(); ++i)
+				{
+					CompressBytes(Chunks[i], Compressed[i]);
+				}
+				Section.CompressMs += MillisecondsSince(Start);
+
+				// Deserialize into a scratch copy so every iteration decodes the same amount
+				FSaveGameData Decoded;
+				double DecompressMs = 0.0;
+				double DeserializeMs = 0.0;
+				for (int32 i = 0; i < Chunks.Num(); ++i)
+				{
+					Start = FPlatformTime::Seconds();
+					Decompressed.SetNumUninitialized(Chunks[i].Num(), EAllowShrinking::No);
+					FCompression::UncompressMemory(NAME_LZ4, Decompressed.GetData(), Decompressed.Num(),
+						Compressed[i].GetData(), Compressed[i].Num());
+					DecompressMs += MillisecondsSince(Start);
+
+					Start = FPlatformTime::Seconds();
+					FSaveChunkStore::DeserializeChunk(Section.Type, Decompressed, SAVE_FORMAT_VERSION, Decoded);
+					DeserializeMs += MillisecondsSince(Start);
+				}
+				Section.DecompressMs += DecompressMs;
+				Section.DeserializeMs += DeserializeMs;
+
+				if (Iteration == 0)
+				{
+					Section.NumChunks = Chunks.Num();
+					for (int32 i = 0; i < Chunks.Num(); ++i)
+					{
+						Section.RawBytes += Chunks[i].Num();
+						Section.CompressedBytes += Compressed[i].Num();
+					}
+				}
+
+				for (const TArray<uint8>& Bytes : Compressed)
+				{
+					FileBytes.Append(Bytes);
+				}
+			}
+
+			// Disk cost alone, on the same bytes a full rewrite would produce
+			double Start = FPlatformTime::Seconds();
+			FFileHelper::SaveArrayToFile(FileBytes, *ScratchFilePath);
+			Report.DiskWriteMs += MillisecondsSince(Start);
+
+			TArray<uint8> ReadBack;
+			Start = FPlatformTime::Seconds();
+			FFileHelper::LoadFileToArray(ReadBack, *ScratchFilePath);
+			Report.DiskReadMs += MillisecondsSince(Start);
+			Report.FileBytes = ReadBack.Num();
+
+			// The real writer: a cold store encodes and rewrites everything; the warm pass sees
+			// unchanged revisions, reuses every chunk and only commits a new table and header
+			const FSaveSnapshot Snapshot = MakeSnapshot(Data);
+
+			IFileManager::Get().Delete(*ScratchFilePath);
+			FSaveChunkStore Store;
+			Start = FPlatformTime::Seconds();
+			Store.Write(Snapshot, ScratchFilePath, &USEESaveGameSubsystem::SerializeHeader);
+			Report.StoreColdWriteMs += MillisecondsSince(Start);
+
+			Start = FPlatformTime::Seconds();
+			Store.Write(Snapshot, ScratchFilePath, &USEESaveGameSubsystem::SerializeHeader);
+			Report.StoreWarmWriteMs += MillisecondsSince(Start);
+
+			// The real reader on that file: a full decode, then the lazy load LoadFromSlot performs
+			{
+				FSaveGameData Loaded;
+				Start = FPlatformTime::Seconds();
+				const ELoadResult Result = USEESaveGameSubsystem::ReadSaveFile(ScratchFilePath, Loaded);
+				Report.StoreReadMs += MillisecondsSince(Start);
+				if (Result != ELoadResult::Success)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("SaveBenchmark: store-written file failed to load (%d)"), static_cast<int32>(Result));
+				}
+			}
+			{
+				FSaveGameData Loaded;
+				FSaveLazyLoad Lazy;
+				Start = FPlatformTime::Seconds();
+				USEESaveGameSubsystem::ReadSaveFile(ScratchFilePath, Loaded, &Lazy);
+				Report.StoreLazyReadMs += MillisecondsSince(Start);
+			}
+
+			// Round trip: two more appends, each with a new header, then the load must see the last one
+			if (Iteration == 0)
+			{
+				FSaveSnapshot Appended = Snapshot;
+				for (int32 Pass = 1; Pass <= 2; ++Pass)
+				{
+					Appended.Header.PlayTimeSeconds = Snapshot.Header.PlayTimeSeconds + Pass;
+					Store.Write(Appended, ScratchFilePath, &USEESaveGameSubsystem::SerializeHeader);
+				}
+
+				FSaveGameData Loaded;
+				const ELoadResult Result = USEESaveGameSubsystem::ReadSaveFile(ScratchFilePath, Loaded);
+				Report.bAppendRoundTripOk = Result == ELoadResult::Success
+					&& FMath::IsNearlyEqual(Loaded.Header.PlayTimeSeconds, Appended.Header.PlayTimeSeconds, 0.01f);
+				if (!Report.bAppendRoundTripOk)
+				{
+					UE_LOG(LogTemp, Error, TEXT("SaveBenchmark: after two appends the file loads play time %.1f (%d), expected %.1f"),
+						Loaded.Header.PlayTimeSeconds, static_cast<int32>(Result), Appended.Header.PlayTimeSeconds);
+				}
+			}
+		}
+
+		IFileManager::Get().Delete(*ScratchFilePath);
+
+		const double Scale = 1.0 / Iterations;
+		for (FSectionTiming& Section : Report.Sections)
+		{
+			Section.SerializeMs *= Scale;
+			Section.HashMs *= Scale;
+			Section.CompressMs *= Scale;
+			Section.DecompressMs *= Scale;
+			Section.DeserializeMs *= Scale;
+		}
+		Report.DiskWriteMs *= Scale;
+		Report.DiskReadMs *= Scale;
+		Report.StoreColdWriteMs *= Scale;
+		Report.StoreWarmWriteMs *= Scale;
+		Report.StoreReadMs *= Scale;
+		Report.StoreLazyReadMs *= Scale;
+
+		return Report;
+	}
+
+	void LogThroughputReport(const FThroughputReport& Report)
+	{
+		UE_LOG(LogTemp, Display, TEXT("SaveBenchmark: average of %d iterations (ms)"), Report.Iterations);
+		UE_LOG(LogTemp, Display, TEXT("  %-10s %6s %10s %10s %9s %9s %9s %9s %9s"),
+			TEXT("Section"), TEXT("Chunks"), TEXT("Raw"), TEXT("LZ4"),
+			TEXT("Serial"), TEXT("SHA256"), TEXT("Compress"), TEXT("Decomp"), TEXT("Deserial"));
+
+		for (const FSectionTiming& Section : Report.Sections)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %-10s %6d %10lld %10lld %9.3f %9.3f %9.3f %9.3f %9.3f"),
+				SectionName(Section.Type), Section.NumChunks, Section.RawBytes, Section.CompressedBytes,
+				Section.SerializeMs, Section.HashMs, Section.CompressMs, Section.DecompressMs, Section.DeserializeMs);
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("  file %lld bytes: disk write %.3f, disk read %.3f; chunk store write cold %.3f, warm %.3f"),
+			Report.FileBytes, Report.DiskWriteMs, Report.DiskReadMs, Report.StoreColdWriteMs, Report.StoreWarmWriteMs);
+		UE_LOG(LogTemp, Display, TEXT("  load: full decode %.3f, lazy %.3f; append round trip %s"),
+			Report.StoreReadMs, Report.StoreLazyReadMs, Report.bAppendRoundTripOk ? TEXT("ok") : TEXT("FAILED"));
+	}
+
+	FString ThroughputReportToCsv(const FThroughputReport& Report)
+	{
+		FString Csv = TEXT("Section,Chunks,RawBytes,CompressedBytes,SerializeMs,HashMs,CompressMs,DecompressMs,DeserializeMs,WriteMs,ReadMs\n");
+		for (const FSectionTiming& Section : Report.Sections)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%lld,%lld,%.4f,%.4f,%.4f,%.4f,%.4f,,\n"),
+				SectionName(Section.Type), Section.NumChunks, Section.RawBytes, Section.CompressedBytes,
+				Section.SerializeMs, Section.HashMs, Section.CompressMs, Section.DecompressMs, Section.DeserializeMs);
+		}
+		Csv += FString::Printf(TEXT("File,,,%lld,,,,,,%.4f,%.4f\n"), Report.FileBytes, Report.DiskWriteMs, Report.DiskReadMs);
+		Csv += FString::Printf(TEXT("StoreCold,,,,,,,,,%.4f,\n"), Report.StoreColdWriteMs);
+		Csv += FString::Printf(TEXT("StoreWarm,,,,,,,,,%.4f,\n"), Report.StoreWarmWriteMs);
+		Csv += FString::Printf(TEXT("Load,,,,,,,,,,%.4f\n"), Report.StoreReadMs);
+		Csv += FString::Printf(TEXT("LoadLazy,,,,,,,,,,%.4f\n"), Report.StoreLazyReadMs);
+		return Csv;
+	}
+
+	FThroughputReport RunThroughputBenchmark(const FSyntheticConfig& Config, int32 Iterations)
+	{
+		const FSaveGameData Data = MakeSyntheticPlaythrough(Config);
+
+		UE_LOG(LogTemp, Display, TEXT("SaveBenchmark: %d cars, %d NPCs, %d quests, %d companions, %d items"),
+			Data.ModifiedCars.Num(), Data.NPCStates.Num(), Data.QuestStates.Num(),
+			Data.CompanionStates.Num(), Data.PlayerState.InventoryItems.Num());
+
+		const FString ScratchFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveBenchmark.sav"));
+		const FThroughputReport Report = MeasureThroughput(Data, Iterations, ScratchFile);
+		LogThroughputReport(Report);
+		return Report;
+	}
+
+	// ========================================================================
+	// Console Commands
+	// ========================================================================
+
+	static FSyntheticConfig ConfigFromArgs(const TArray<FString>& Args)
+	{
+		FSyntheticConfig Config;
+		if (Args.Num() > 0)
+		{
+			Config.NumCars = FMath::Max(FCString::Atoi(*Args[0]), 1);
+		}
+		return Config;
+	}
+
+	static FAutoConsoleCommand SizeBenchmarkCommand(
+		TEXT("Save.Bench.Size"),
+		TEXT("Compare save payload sizes across format versions on a synthetic playthrough. Usage: Save.Bench.Size [NumCars=100]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			RunSizeBenchmark(ConfigFromArgs(Args));
+		}));
+
+	static FAutoConsoleCommand ThroughputBenchmarkCommand(
+		TEXT("Save.Bench.Throughput"),
+		TEXT("Time each stage of the save/load path on a synthetic playthrough. Usage: Save.Bench.Throughput [NumCars=100] [Iterations=10]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10;
+			RunThroughputBenchmark(ConfigFromArgs(Args), Iterations);
+		}));
+}
@@ -0,0 +1,112 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveTypes.h"
+#include "SaveChunkStore.h"
+
+// ============================================================================
+// SaveBenchmark
+//
+// Synthetic save data and measurements for tuning the save path without
+// loading a level. Run from the console:
+//
+//   Save.Bench.Size [NumCars]          payload and cache size per format version
+//   Save.Bench.Throughput [NumCars]    per-section timings of the save/load path
+//
+// or headless through USaveBenchmarkCommandlet (-run=SaveBenchmark).
+// ============================================================================
+
+namespace SaveBenchmark
+{
+	struct FSyntheticConfig
+	{
+		int32 NumCars = 100;
+		int32 NPCsPerCar = 8;
+		int32 NumQuests = 60;
+		int32 NumCompanions = 8;
+		int32 NumInventoryItems = 40;
+		int32 Seed = 1;
+	};
+
+	/** A deterministic mid-game playthrough; every car in 1..NumCars is visited and modified. */
+	TRAINGAME_API FSaveGameData MakeSyntheticPlaythrough(const FSyntheticConfig& Config);
+
+	/** Wrap Data for FSaveChunkStore::Write. Copies each car once into its own shared state. */
+	TRAINGAME_API FSaveSnapshot MakeSnapshot(const FSaveGameData& Data);
+
+	// --- Size ---
+
+	struct FSizeReport
+	{
+		int32 FormatVersion = 0;
+
+		// Sum over all chunks, serialized and after LZ4
+		int64 RawBytes = 0;
+		int64 CompressedBytes = 0;
+
+		// Car chunks alone, the part that grows with the train
+		int64 CarRawBytes = 0;
+		int64 CarCompressedBytes = 0;
+	};
+
+	/** Serialize Data chunk by chunk, as the chunk store would, in the given format version. */
+	TRAINGAME_API FSizeReport MeasureSize(const FSaveGameData& Data, int32 FormatVersion);
+
+	/** Heap bytes the flag arrays of Data's cars occupy, and what they took as TArray<bool>. */
+	TRAINGAME_API void MeasureCarCacheMemory(const FSaveGameData& Data, int64& OutBitFieldBytes, int64& OutBoolArrayBytes);
+
+	/** Run the size comparison and log it. */
+	TRAINGAME_API void RunSizeBenchmark(const FSyntheticConfig& Config);
+
+	// --- Throughput ---
+
+	/** Averages per iteration for one payload section (all chunks of that type). */
+	struct FSectionTiming
+	{
+		ESaveChunkType Type = ESaveChunkType::Global;
+		int32 NumChunks = 0;
+		int64 RawBytes = 0;
+		int64 CompressedBytes = 0;
+
+		double SerializeMs = 0.0;
+		double HashMs = 0.0;
+		double CompressMs = 0.0;
+		double DecompressMs = 0.0;
+		double DeserializeMs = 0.0;
+	};
+
+	struct FThroughputReport
+	{
+		int32 Iterations = 0;
+		TArray<FSectionTiming> Sections;
+
+		// Compressed chunks written to and read back from disk as one file
+		int64 FileBytes = 0;
+		double DiskWriteMs = 0.0;
+		double DiskReadMs = 0.0;
+
+		// FSaveChunkStore::Write end to end: a fresh store (full rewrite), then again with nothing changed
+		double StoreColdWriteMs = 0.0;
+		double StoreWarmWriteMs = 0.0;
+
+		// USEESaveGameSubsystem::ReadSaveFile on the store-written file: every chunk decoded, then lazily
+		double StoreReadMs = 0.0;
+		double StoreLazyReadMs = 0.0;
+
+		// Two appends onto the store-written file, reloaded: false if the load saw an older header
+		bool bAppendRoundTripOk = true;
+	};
+
+	/** Time every stage of the save and load path. ScratchFilePath is overwritten and deleted. */
+	TRAINGAME_API FThroughputReport MeasureThroughput(const FSaveGameData& Data, int32 Iterations, const FString& ScratchFilePath);
+
+	TRAINGAME_API void LogThroughputReport(const FThroughputReport& Report);
+
+	/** One row per section plus a file row; for tracking regressions across builds. */
+	TRAINGAME_API FString ThroughputReportToCsv(const FThroughputReport& Report);
+
+	/** Build a playthrough, measure it and log the results. */
+	TRAINGAME_API FThroughputReport RunThroughputBenchmark(const FSyntheticConfig& Config, int32 Iterations);
+}
@@ -0,0 +1,56 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "SaveBenchmarkCommandlet.h"
+#include "SaveBenchmark.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+
+USaveBenchmarkCommandlet::USaveBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USaveBenchmarkCommandlet::Main(const FString& Params)
+{
+	SaveBenchmark::FSyntheticConfig Config;
+	FParse::Value(*Params, TEXT("Cars="), Config.NumCars);
+	FParse::Value(*Params, TEXT("NPCsPerCar="), Config.NPCsPerCar);
+	FParse::Value(*Params, TEXT("Quests="), Config.NumQuests);
+	FParse::Value(*Params, TEXT("Companions="), Config.NumCompanions);
+	FParse::Value(*Params, TEXT("Items="), Config.NumInventoryItems);
+	FParse::Value(*Params, TEXT("Seed="), Config.Seed);
+
+	int32 Iterations = 10;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+	SaveBenchmark::RunSizeBenchmark(Config);
+	const SaveBenchmark::FThroughputReport Report = SaveBenchmark::RunThroughputBenchmark(Config, Iterations);
+
+	FString CsvPath;
+	if (FParse::Value(*Params, TEXT("Csv="), CsvPath))
+	{
+		if (!FFileHelper::SaveStringToFile(SaveBenchmark::ThroughputReportToCsv(Report), *CsvPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("SaveBenchmark: could not write %s"), *CsvPath);
+			return 1;
+		}
+	}
+
+	if (!Report.bAppendRoundTripOk)
+	{
+		return 1;
+	}
+
+	double MaxColdWriteMs = 0.0;
+	if (FParse::Value(*Params, TEXT("MaxColdWriteMs="), MaxColdWriteMs) && Report.StoreColdWriteMs > MaxColdWriteMs)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SaveBenchmark: cold write %.3f ms exceeds budget %.3f ms"),
+			Report.StoreColdWriteMs, MaxColdWriteMs);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,29 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SaveBenchmarkCommandlet.generated.h"
+
+// ============================================================================
+// USaveBenchmarkCommandlet
+//
+// Headless save/load throughput run for CI and slow-disk checks:
+//
+//   UnrealEditor-Cmd SnowpiercerEE -run=SaveBenchmark [-Cars=100] [-NPCsPerCar=8]
+//       [-Quests=60] [-Companions=8] [-Items=40] [-Iterations=10] [-Csv=<path>]
+//       [-MaxColdWriteMs=<ms>]
+//
+// Returns non-zero if a cold chunk store write exceeds -MaxColdWriteMs.
+// ============================================================================
+UCLASS()
+class TRAINGAME_API USaveBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USaveBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
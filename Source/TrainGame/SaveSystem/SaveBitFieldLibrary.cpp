@@ -0,0 +1,28 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "SaveBitFieldLibrary.h"
+
+bool USaveBitFieldLibrary::GetFlag(const FSaveBitField& Field, int32 Index)
+{
+	return Field.Get(Index);
+}
+
+void USaveBitFieldLibrary::SetFlag(FSaveBitField& Field, int32 Index, bool bValue)
+{
+	Field.Set(Index, bValue);
+}
+
+int32 USaveBitFieldLibrary::NumFlags(const FSaveBitField& Field)
+{
+	return Field.Num();
+}
+
+void USaveBitFieldLibrary::SetNumFlags(FSaveBitField& Field, int32 NumFlags)
+{
+	Field.SetNum(NumFlags);
+}
+
+int32 USaveBitFieldLibrary::CountSetFlags(const FSaveBitField& Field)
+{
+	return Field.CountSetBits();
+}
@@ -0,0 +1,40 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "SaveTypes.h"
+#include "SaveBitFieldLibrary.generated.h"
+
+// ============================================================================
+// USaveBitFieldLibrary
+//
+// Blueprint access to FSaveBitField, which replaced the TArray<bool> save
+// flags (looted containers, discovered cars, revolution and step flags) and
+// so lost the array nodes Blueprints used on them.
+// ============================================================================
+UCLASS()
+class TRAINGAME_API USaveBitFieldLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Out-of-range indices read as false. */
+	UFUNCTION(BlueprintPure, Category = "Save|Flags")
+	static bool GetFlag(const FSaveBitField& Field, int32 Index);
+
+	/** Setting a flag past the end grows the field. */
+	UFUNCTION(BlueprintCallable, Category = "Save|Flags")
+	static void SetFlag(UPARAM(ref) FSaveBitField& Field, int32 Index, bool bValue);
+
+	UFUNCTION(BlueprintPure, Category = "Save|Flags")
+	static int32 NumFlags(const FSaveBitField& Field);
+
+	/** Resize; flags past the old end start cleared, including ones dropped by an earlier shrink. */
+	UFUNCTION(BlueprintCallable, Category = "Save|Flags")
+	static void SetNumFlags(UPARAM(ref) FSaveBitField& Field, int32 NumFlags);
+
+	UFUNCTION(BlueprintPure, Category = "Save|Flags")
+	static int32 CountSetFlags(const FSaveBitField& Field);
+};
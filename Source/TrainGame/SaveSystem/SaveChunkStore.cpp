@@ -0,0 +1,833 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "SaveChunkStore.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Type (1) + Key (4) + Offset (8) + CompressedSize (4) + UncompressedSize (4) + Hash (32)
+static constexpr int32 SAVE_CHUNK_ENTRY_SIZE = 53;
+
+FArchive& operator<<(FArchive& Ar, FSaveChunkEntry& Entry)
+{
+	uint8 Type = static_cast<uint8>(Entry.Type);
+	Ar << Type;
+	Entry.Type = static_cast<ESaveChunkType>(Type);
+
+	Ar << Entry.Key;
+	Ar << Entry.Offset;
+	Ar << Entry.CompressedSize;
+	Ar << Entry.UncompressedSize;
+	Ar.Serialize(Entry.Hash.Signature, sizeof(Entry.Hash.Signature));
+	return Ar;
+}
+
+namespace
+{
+	bool CompressBytes(const TArray<uint8>& RawBytes, TArray<uint8>& OutCompressed)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, RawBytes.Num());
+		OutCompressed.SetNumUninitialized(CompressedSize);
+
+		if (!FCompression::CompressMemory(
+			NAME_LZ4,
+			OutCompressed.GetData(),
+			CompressedSize,
+			RawBytes.GetData(),
+			RawBytes.Num()))
+		{
+			return false;
+		}
+
+		OutCompressed.SetNum(CompressedSize);
+		OutCompressed.Shrink();
+		return true;
+	}
+
+	/** Magic, version, header length and header offset, as one write. */
+	void MakePreamble(uint8 (&OutBytes)[SAVE_PREAMBLE_SIZE_TRAILING], int32 HeaderLength, int64 HeaderOffset)
+	{
+		const int32 Version = SAVE_FORMAT_VERSION;
+		FMemory::Memcpy(OutBytes, SAVE_MAGIC, 4);
+		FMemory::Memcpy(OutBytes + 4, &Version, sizeof(int32));
+		FMemory::Memcpy(OutBytes + 8, &HeaderLength, sizeof(int32));
+		FMemory::Memcpy(OutBytes + 12, &HeaderOffset, sizeof(int64));
+	}
+
+	/**
+	 * An existing file opened for writes at explicit offsets, never truncated.
+	 * IPlatformFile has no such mode: its non-append handles truncate, and on POSIX
+	 * platforms an append handle may carry O_APPEND, which sends every write to EOF
+	 * whatever Seek said. There the file is opened directly and written with pwrite.
+	 */
+	class FInPlaceFile
+	{
+	public:
+		explicit FInPlaceFile(const FString& FilePath)
+		{
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+			const FString FullPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*FilePath);
+			Fd = ::open(TCHAR_TO_UTF8(*FullPath), O_WRONLY | O_CLOEXEC);
+#else
+			// Append handles here open the existing file without an append-only flag, so Seek holds
+			Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath, /*bAppend*/ true));
+#endif
+		}
+
+		~FInPlaceFile()
+		{
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+			if (Fd >= 0)
+			{
+				::close(Fd);
+			}
+#endif
+		}
+
+		bool IsValid() const
+		{
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+			return Fd >= 0;
+#else
+			return Handle.IsValid();
+#endif
+		}
+
+		bool WriteAt(int64 Offset, const uint8* Data, int64 Size)
+		{
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+			while (Size > 0)
+			{
+				const ssize_t Written = ::pwrite(Fd, Data, Size, Offset);
+				if (Written <= 0)
+				{
+					return false;
+				}
+				Data += Written;
+				Offset += Written;
+				Size -= Written;
+			}
+			return true;
+#else
+			return Handle->Seek(Offset) && Handle->Write(Data, Size);
+#endif
+		}
+
+		/** Flush through to the disk, so later writes can't overtake earlier ones */
+		bool Flush()
+		{
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+			return ::fsync(Fd) == 0;
+#else
+			return Handle->Flush(/*bFullFlush*/ true);
+#endif
+		}
+
+	private:
+#if PLATFORM_UNIX || PLATFORM_APPLE || PLATFORM_ANDROID
+		int Fd = -1;
+#else
+		TUniquePtr<IFileHandle> Handle;
+#endif
+	};
+}
+
+// ============================================================================
+// Write
+// ============================================================================
+
+ESaveResult FSaveChunkStore::Write(const FSaveSnapshot& Snapshot, const FString& FilePath,
+	TFunctionRef<FString(const FSaveHeaderData&)> BuildHeaderJson)
+{
+	FScopeLock Lock(&Mutex);
+
+	TArray<uint64> LiveIds;
+	if (!EncodeSections(Snapshot, LiveIds))
+	{
+		return ESaveResult::FailedCompress;
+	}
+
+	// The file we are about to write may be the one adopted chunks point into
+	DetachChunksMappedFrom(FilePath);
+
+	TArray<FSaveChunkEntry> Entries;
+	TArray<const FEncodedChunk*> ToWrite;
+	TArray<uint8> TableBytes;
+	TArray<uint8> HeaderBytes;
+	int64 TableOffset = 0;
+
+	// Lay out chunks against a ledger (append) or from offset zero (rewrite),
+	// then build the table and the header that commits it
+	auto BuildLayout = [&](const FFileLedger* Ledger)
+	{
+		Entries.Reset();
+		ToWrite.Reset();
+		TableBytes.Reset();
+		LayoutChunks(LiveIds, Ledger, Ledger ? Ledger->DataEnd : 0, Entries, ToWrite, TableOffset);
+
+		FMemoryWriter TableWriter(TableBytes);
+		int32 NumEntries = Entries.Num();
+		TableWriter << NumEntries;
+		for (FSaveChunkEntry& Entry : Entries)
+		{
+			TableWriter << Entry;
+		}
+
+		FSaveHeaderData Header = Snapshot.Header;
+		Header.FormatVersion = SAVE_FORMAT_VERSION;
+		Header.Checksum = ComputeChecksum(TableBytes.GetData(), TableBytes.Num());
+		Header.ChunkTableOffset = TableOffset;
+		Header.ChunkTableSize = TableBytes.Num();
+
+		const FString HeaderJson = BuildHeaderJson(Header);
+		const FTCHARToUTF8 HeaderUtf8(*HeaderJson);
+		HeaderBytes.Reset();
+		HeaderBytes.Append(reinterpret_cast<const uint8*>(HeaderUtf8.Get()), HeaderUtf8.Length());
+	};
+
+	FFileLedger* Ledger = Ledgers.Find(FilePath);
+	if (Ledger && CanAppend(*Ledger, FilePath))
+	{
+		BuildLayout(Ledger);
+	}
+	else
+	{
+		// First write to this file, or compaction due
+		Ledger = nullptr;
+		BuildLayout(nullptr);
+	}
+
+	if (HeaderBytes.Num() > SAVE_MAX_HEADER_SIZE)
+	{
+		return ESaveResult::FailedInvalid;
+	}
+	if (Ledger)
+	{
+		return AppendToFile(FilePath, *Ledger, Entries, ToWrite, TableBytes, TableOffset, HeaderBytes);
+	}
+	return RewriteFile(FilePath, Entries, ToWrite, TableBytes, TableOffset, HeaderBytes);
+}
+
+void FSaveChunkStore::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	Chunks.Empty();
+	Ledgers.Empty();
+}
+
+void FSaveChunkStore::AdoptLoadedFile(const FSaveLazyLoad& Loaded)
+{
+	if (!Loaded.File.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	const FString& FilePath = Loaded.File->FilePath;
+	FFileLedger& Ledger = Ledgers.FindOrAdd(FilePath);
+	Ledger = FFileLedger();
+
+	for (const TPair<uint64, FSaveLazyLoad::FPendingChunk>& Pair : Loaded.Pending)
+	{
+		const FSaveChunkEntry& Entry = Pair.Value.Entry;
+
+		FEncodedChunk& Chunk = Chunks.Add(Pair.Key);
+		Chunk.Type = Entry.Type;
+		Chunk.Key = Entry.Key;
+		Chunk.SourceRevision = Pair.Value.SourceRevision;
+		Chunk.UncompressedSize = Entry.UncompressedSize;
+		Chunk.CompressedSize = Entry.CompressedSize;
+		Chunk.Hash = Entry.Hash;
+		Chunk.Mapping = Loaded.File;
+		Chunk.MappedOffset = Loaded.DataStart + Entry.Offset;
+		Chunk.Generation = ++NextGeneration;
+
+		FChunkLocation& Location = Ledger.Chunks.Add(Pair.Key);
+		Location.Generation = Chunk.Generation;
+		Location.Offset = Entry.Offset;
+		Location.Size = Entry.CompressedSize;
+	}
+
+	// Chunks decoded eagerly have no cached encoding; the next save appends them fresh
+	Ledger.LiveBytes = Loaded.TableSize + Loaded.HeaderLength;
+	for (const FSaveChunkEntry& Entry : Loaded.Entries)
+	{
+		Ledger.LiveBytes += Entry.CompressedSize;
+	}
+
+	// Appends go past both the table and the header; anything beyond them is
+	// left over from an append that never committed and may be overwritten
+	const int64 HeaderEnd = Loaded.HeaderOffset - Loaded.DataStart + Loaded.HeaderLength;
+	Ledger.DataEnd = FMath::Max(Loaded.TableOffset + Loaded.TableSize, HeaderEnd);
+	Ledger.TableSize = Loaded.TableSize;
+	Ledger.DeadBytes = Ledger.DataEnd - Ledger.LiveBytes;
+
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FilePath);
+	Ledger.FileSize = Stat.FileSize;
+	Ledger.ModificationTime = Stat.ModificationTime;
+}
+
+void FSaveChunkStore::ReleaseFile(const FString& FilePath)
+{
+	FScopeLock Lock(&Mutex);
+	DetachChunksMappedFrom(FilePath);
+	Ledgers.Remove(FilePath);
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+bool FSaveChunkStore::EncodeSections(const FSaveSnapshot& Snapshot, TArray<uint64>& OutLiveIds)
+{
+	// FArchive serialization takes non-const refs; FMemoryWriter only reads from them
+	FSaveSnapshot& Source = const_cast<FSaveSnapshot&>(Snapshot);
+
+	auto EncodeSection = [this, &OutLiveIds](ESaveChunkType Type, int32 Key, auto& Section)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Writer << Section;
+		OutLiveIds.Add(MakeChunkId(Type, Key));
+		return RefreshChunk(Type, Key, Bytes, 0);
+	};
+
+	bool bOk = true;
+	bOk &= EncodeSection(ESaveChunkType::Global, 0, Source.GlobalState);
+	bOk &= EncodeSection(ESaveChunkType::Player, 0, Source.PlayerState);
+	bOk &= EncodeSection(ESaveChunkType::Quests, 0, Source.QuestStates);
+	bOk &= EncodeSection(ESaveChunkType::Companions, 0, Source.CompanionStates);
+
+	// NPCs are grouped by the car they are in, so a chunk only changes with that car's population
+	TMap<int32, TArray<const FSaveNPCState*>> NPCsByCar;
+	if (Snapshot.NPCStates.IsValid())
+	{
+		for (const FSaveNPCState& NPC : *Snapshot.NPCStates)
+		{
+			NPCsByCar.FindOrAdd(NPC.CurrentCarIndex).Add(&NPC);
+		}
+	}
+	for (TPair<int32, TArray<const FSaveNPCState*>>& Pair : NPCsByCar)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		int32 NumNPCs = Pair.Value.Num();
+		Writer << NumNPCs;
+		for (const FSaveNPCState* NPC : Pair.Value)
+		{
+			Writer << const_cast<FSaveNPCState&>(*NPC);
+		}
+		OutLiveIds.Add(MakeChunkId(ESaveChunkType::NPCs, Pair.Key));
+		bOk &= RefreshChunk(ESaveChunkType::NPCs, Pair.Key, Bytes, 0);
+	}
+
+	// Cars: skip serialization entirely when the revision we encoded is still current
+	const TArray<FSaveCarStateRef> NoCars;
+	const TArray<FSaveCarStateRef>& Cars = Snapshot.Cars.IsValid() ? *Snapshot.Cars : NoCars;
+	for (const FSaveCarStateRef& CarRef : Cars)
+	{
+		FSaveCarState& Car = const_cast<FSaveCarState&>(*CarRef);
+		const uint64 Id = MakeChunkId(ESaveChunkType::Car, Car.CarIndex);
+		OutLiveIds.Add(Id);
+
+		const FEncodedChunk* Cached = Chunks.Find(Id);
+		if (Cached && Cached->Generation != 0 && Car.SaveRevision != 0 && Cached->SourceRevision == Car.SaveRevision)
+		{
+			continue;
+		}
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Writer << Car;
+		bOk &= RefreshChunk(ESaveChunkType::Car, Car.CarIndex, Bytes, Car.SaveRevision);
+	}
+
+	// Chunks still undecoded since a lazy load are carried over byte-for-byte,
+	// unless the caller supplied fresh state for the same chunk above
+	TSet<uint64> LiveSet(OutLiveIds);
+	for (const uint64 Id : Snapshot.CarriedChunkIds)
+	{
+		if (LiveSet.Contains(Id))
+		{
+			continue;
+		}
+		if (!Chunks.Contains(Id))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveChunkStore: carried chunk %llx has no encoding; dropping it"), Id);
+			continue;
+		}
+		LiveSet.Add(Id);
+		OutLiveIds.Add(Id);
+	}
+
+	// Forget encodings for chunks no longer present (e.g. after a load)
+	if (Chunks.Num() != OutLiveIds.Num())
+	{
+		for (auto It = Chunks.CreateIterator(); It; ++It)
+		{
+			if (!LiveSet.Contains(It.Key()))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	return bOk;
+}
+
+bool FSaveChunkStore::RefreshChunk(ESaveChunkType Type, int32 Key, const TArray<uint8>& RawBytes, uint32 SourceRevision)
+{
+	// The chunk table needs this hash anyway; comparing it rather than a CRC means
+	// unchanged bytes are the only thing that can skip recompression
+	FSHA256Signature Hash;
+	FSHA256::HashBuffer(RawBytes.GetData(), RawBytes.Num(), Hash.Signature);
+
+	FEncodedChunk& Chunk = Chunks.FindOrAdd(MakeChunkId(Type, Key));
+	Chunk.SourceRevision = SourceRevision;
+
+	if (Chunk.Generation != 0 && Chunk.UncompressedSize == RawBytes.Num() &&
+		FMemory::Memcmp(Chunk.Hash.Signature, Hash.Signature, sizeof(Hash.Signature)) == 0)
+	{
+		return true;
+	}
+
+	Chunk.Mapping.Reset();
+	if (!CompressBytes(RawBytes, Chunk.Compressed))
+	{
+		Chunk.Generation = 0;
+		return false;
+	}
+
+	Chunk.CompressedSize = Chunk.Compressed.Num();
+	Chunk.Type = Type;
+	Chunk.Key = Key;
+	Chunk.UncompressedSize = RawBytes.Num();
+	Chunk.Hash = Hash;
+	Chunk.Generation = ++NextGeneration;
+	return true;
+}
+
+// ============================================================================
+// File Layout / I/O
+// ============================================================================
+
+bool FSaveChunkStore::CanAppend(const FFileLedger& Ledger, const FString& FilePath) const
+{
+	if (Ledger.AppendCount >= SAVE_COMPACTION_INTERVAL)
+	{
+		return false;
+	}
+
+	// Compact once superseded chunks take up more space than live ones
+	if (Ledger.DeadBytes > Ledger.LiveBytes)
+	{
+		return false;
+	}
+
+	// Someone else touched the file since we wrote it — our ledger no longer describes it
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FilePath);
+	return Stat.bIsValid && Stat.FileSize == Ledger.FileSize && Stat.ModificationTime == Ledger.ModificationTime;
+}
+
+void FSaveChunkStore::DetachChunksMappedFrom(const FString& FilePath)
+{
+	for (TPair<uint64, FEncodedChunk>& Pair : Chunks)
+	{
+		FEncodedChunk& Chunk = Pair.Value;
+		if (Chunk.Mapping.IsValid() && Chunk.Mapping->FilePath == FilePath)
+		{
+			Chunk.Compressed.SetNumUninitialized(Chunk.CompressedSize);
+			FMemory::Memcpy(Chunk.Compressed.GetData(), Chunk.GetCompressedData(), Chunk.CompressedSize);
+			Chunk.Mapping.Reset();
+		}
+	}
+}
+
+void FSaveChunkStore::LayoutChunks(const TArray<uint64>& LiveIds, const FFileLedger* Ledger, int64 BaseOffset,
+	TArray<FSaveChunkEntry>& OutEntries, TArray<const FEncodedChunk*>& OutToWrite, int64& OutTableOffset) const
+{
+	int64 Cursor = BaseOffset;
+	OutEntries.Reserve(LiveIds.Num());
+
+	for (const uint64 Id : LiveIds)
+	{
+		const FEncodedChunk& Chunk = Chunks.FindChecked(Id);
+
+		FSaveChunkEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Type = Chunk.Type;
+		Entry.Key = Chunk.Key;
+		Entry.CompressedSize = Chunk.CompressedSize;
+		Entry.UncompressedSize = Chunk.UncompressedSize;
+		Entry.Hash = Chunk.Hash;
+
+		const FChunkLocation* Existing = Ledger ? Ledger->Chunks.Find(Id) : nullptr;
+		if (Existing && Existing->Generation == Chunk.Generation)
+		{
+			Entry.Offset = Existing->Offset;
+		}
+		else
+		{
+			Entry.Offset = Cursor;
+			Cursor += Chunk.CompressedSize;
+			OutToWrite.Add(&Chunk);
+		}
+	}
+
+	OutTableOffset = Cursor;
+}
+
+ESaveResult FSaveChunkStore::AppendToFile(const FString& FilePath, FFileLedger& Ledger, const TArray<FSaveChunkEntry>& Entries,
+	const TArray<const FEncodedChunk*>& ToWrite, const TArray<uint8>& TableBytes, int64 TableOffset,
+	const TArray<uint8>& HeaderBytes)
+{
+	bool bOk = false;
+	{
+		FInPlaceFile File(FilePath);
+		if (!File.IsValid())
+		{
+			return ESaveResult::FailedIO;
+		}
+
+		// New chunks, table and header go after everything the previous save left
+		// behind, so none of the bytes the current preamble points at are touched
+		const int64 HeaderOffset = SAVE_PREAMBLE_SIZE_TRAILING + TableOffset + TableBytes.Num();
+		int64 Cursor = SAVE_PREAMBLE_SIZE_TRAILING + Ledger.DataEnd;
+		bOk = true;
+		for (const FEncodedChunk* Chunk : ToWrite)
+		{
+			bOk = bOk && File.WriteAt(Cursor, Chunk->GetCompressedData(), Chunk->CompressedSize);
+			Cursor += Chunk->CompressedSize;
+		}
+		bOk = bOk && File.WriteAt(Cursor, TableBytes.GetData(), TableBytes.Num());
+		bOk = bOk && File.WriteAt(HeaderOffset, HeaderBytes.GetData(), HeaderBytes.Num());
+		bOk = bOk && File.Flush();
+
+		// Commit: one write of the preamble at offset 0 switches readers to the new header
+		uint8 Preamble[SAVE_PREAMBLE_SIZE_TRAILING];
+		MakePreamble(Preamble, HeaderBytes.Num(), HeaderOffset);
+		bOk = bOk && File.WriteAt(0, Preamble, SAVE_PREAMBLE_SIZE_TRAILING);
+		bOk = bOk && File.Flush();
+	}
+
+	if (!bOk)
+	{
+		// The file may be half-appended; force a full rewrite next time
+		Ledgers.Remove(FilePath);
+		return ESaveResult::FailedIO;
+	}
+
+	RecordLedger(FilePath, Ledger, Entries, TableOffset, TableBytes.Num(), HeaderBytes.Num());
+	++Ledger.AppendCount;
+	return ESaveResult::Success;
+}
+
+ESaveResult FSaveChunkStore::RewriteFile(const FString& FilePath, const TArray<FSaveChunkEntry>& Entries,
+	const TArray<const FEncodedChunk*>& ToWrite, const TArray<uint8>& TableBytes, int64 TableOffset,
+	const TArray<uint8>& HeaderBytes)
+{
+	// Write beside the slot and swap it in, so a failed write never destroys the old save
+	const FString TempPath = FilePath + TEXT(".tmp");
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	{
+		TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*TempPath));
+		if (!Handle.IsValid())
+		{
+			return ESaveResult::FailedIO;
+		}
+
+		const int64 HeaderOffset = SAVE_PREAMBLE_SIZE_TRAILING + TableOffset + TableBytes.Num();
+		uint8 Preamble[SAVE_PREAMBLE_SIZE_TRAILING];
+		MakePreamble(Preamble, HeaderBytes.Num(), HeaderOffset);
+		bool bOk = Handle->Write(Preamble, SAVE_PREAMBLE_SIZE_TRAILING);
+		for (const FEncodedChunk* Chunk : ToWrite)
+		{
+			bOk = bOk && Handle->Write(Chunk->GetCompressedData(), Chunk->CompressedSize);
+		}
+		bOk = bOk && Handle->Write(TableBytes.GetData(), TableBytes.Num());
+		bOk = bOk && Handle->Write(HeaderBytes.GetData(), HeaderBytes.Num());
+		bOk = bOk && Handle->Flush(/*bFullFlush*/ true);
+
+		if (!bOk)
+		{
+			Handle.Reset();
+			PlatformFile.DeleteFile(*TempPath);
+			return ESaveResult::FailedIO;
+		}
+	}
+
+	if (!IFileManager::Get().Move(*FilePath, *TempPath, /*Replace*/ true, /*EvenIfReadOnly*/ true))
+	{
+		PlatformFile.DeleteFile(*TempPath);
+		Ledgers.Remove(FilePath);
+		return ESaveResult::FailedIO;
+	}
+
+	FFileLedger& Ledger = Ledgers.FindOrAdd(FilePath);
+	Ledger = FFileLedger();
+	RecordLedger(FilePath, Ledger, Entries, TableOffset, TableBytes.Num(), HeaderBytes.Num());
+	return ESaveResult::Success;
+}
+
+void FSaveChunkStore::RecordLedger(const FString& FilePath, FFileLedger& Ledger, const TArray<FSaveChunkEntry>& Entries,
+	int64 TableOffset, int32 TableSize, int32 HeaderSize) const
+{
+	Ledger.Chunks.Reset();
+	Ledger.LiveBytes = TableSize + HeaderSize;
+
+	for (const FSaveChunkEntry& Entry : Entries)
+	{
+		const uint64 Id = MakeChunkId(Entry.Type, Entry.Key);
+
+		FChunkLocation& Location = Ledger.Chunks.Add(Id);
+		Location.Generation = Chunks.FindChecked(Id).Generation;
+		Location.Offset = Entry.Offset;
+		Location.Size = Entry.CompressedSize;
+
+		Ledger.LiveBytes += Entry.CompressedSize;
+	}
+
+	// The header directly follows the table
+	Ledger.DataEnd = TableOffset + TableSize + HeaderSize;
+	Ledger.TableSize = TableSize;
+	Ledger.DeadBytes = Ledger.DataEnd - Ledger.LiveBytes;
+
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FilePath);
+	Ledger.FileSize = Stat.FileSize;
+	Ledger.ModificationTime = Stat.ModificationTime;
+}
+
+// ============================================================================
+// Format Helpers
+// ============================================================================
+
+uint64 FSaveChunkStore::MakeChunkId(ESaveChunkType Type, int32 Key)
+{
+	return (static_cast<uint64>(Type) << 32) | static_cast<uint32>(Key);
+}
+
+FString FSaveChunkStore::ComputeChecksum(const uint8* Data, int64 Size)
+{
+	FSHA256Signature Signature;
+	FSHA256::HashBuffer(Data, Size, Signature.Signature);
+
+	FString Result;
+	for (int32 i = 0; i < 32; ++i)
+	{
+		Result += FString::Printf(TEXT("%02x"), Signature.Signature[i]);
+	}
+	return FString::Printf(TEXT("sha256:%s"), *Result);
+}
+
+bool FSaveChunkStore::ParseChunkTable(const uint8* TableData, int32 TableSize, TArray<FSaveChunkEntry>& OutEntries)
+{
+	if (TableSize < static_cast<int32>(sizeof(int32)))
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader(MakeArrayView(TableData, TableSize));
+
+	int32 NumEntries = 0;
+	Reader << NumEntries;
+	if (NumEntries < 0 || NumEntries > (TableSize - static_cast<int32>(sizeof(int32))) / SAVE_CHUNK_ENTRY_SIZE)
+	{
+		return false;
+	}
+
+	OutEntries.SetNum(NumEntries);
+	for (FSaveChunkEntry& Entry : OutEntries)
+	{
+		Reader << Entry;
+	}
+	return !Reader.IsError();
+}
+
+bool FSaveChunkStore::DecodeChunk(const FSaveChunkEntry& Entry, const uint8* CompressedData,
+	TArray<uint8>& OutBytes, bool& bOutHashValid)
+{
+	bOutHashValid = false;
+	if (Entry.CompressedSize < 0 || Entry.UncompressedSize < 0)
+	{
+		return false;
+	}
+
+	OutBytes.SetNumUninitialized(Entry.UncompressedSize);
+	if (!FCompression::UncompressMemory(
+		NAME_LZ4,
+		OutBytes.GetData(),
+		Entry.UncompressedSize,
+		CompressedData,
+		Entry.CompressedSize))
+	{
+		return false;
+	}
+
+	FSHA256Signature Signature;
+	FSHA256::HashBuffer(OutBytes.GetData(), OutBytes.Num(), Signature.Signature);
+	bOutHashValid = FMemory::Memcmp(Signature.Signature, Entry.Hash.Signature, sizeof(Signature.Signature)) == 0;
+	return true;
+}
+
+bool FSaveChunkStore::DeserializeChunk(ESaveChunkType Type, const TArray<uint8>& Bytes, int32 FormatVersion, FSaveGameData& OutData)
+{
+	FMemoryReader Reader(Bytes);
+	SaveEncoding::SetFormatVersion(Reader, FormatVersion);
+
+	switch (Type)
+	{
+	case ESaveChunkType::Global:
+		Reader << OutData.GlobalState;
+		break;
+	case ESaveChunkType::Player:
+		Reader << OutData.PlayerState;
+		break;
+	case ESaveChunkType::Car:
+		Reader << OutData.ModifiedCars.AddDefaulted_GetRef();
+		break;
+	case ESaveChunkType::NPCs:
+	{
+		int32 NumNPCs = 0;
+		Reader << NumNPCs;
+		if (NumNPCs < 0 || NumNPCs > Bytes.Num())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < NumNPCs; ++i)
+		{
+			Reader << OutData.NPCStates.AddDefaulted_GetRef();
+		}
+		break;
+	}
+	case ESaveChunkType::Quests:
+		Reader << OutData.QuestStates;
+		break;
+	case ESaveChunkType::Companions:
+		Reader << OutData.CompanionStates;
+		break;
+	default:
+		// Unknown chunk from a newer build — skip rather than fail the whole load
+		return true;
+	}
+
+	return !Reader.IsError();
+}
+
+// ============================================================================
+// FSaveMappedFile
+// ============================================================================
+
+TSharedPtr<FSaveMappedFile, ESPMode::ThreadSafe> FSaveMappedFile::Open(const FString& InFilePath)
+{
+	TSharedPtr<FSaveMappedFile, ESPMode::ThreadSafe> File = MakeShared<FSaveMappedFile, ESPMode::ThreadSafe>();
+	File->FilePath = InFilePath;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	File->Handle.Reset(PlatformFile.OpenMapped(*InFilePath));
+	if (File->Handle.IsValid())
+	{
+		File->Region.Reset(File->Handle->MapRegion());
+	}
+
+	if (!File->Region.IsValid())
+	{
+		// Mapping unsupported here (e.g. packaged or virtual file systems) — read it once instead
+		File->Handle.Reset();
+		if (!FFileHelper::LoadFileToArray(File->FallbackBytes, *InFilePath))
+		{
+			return nullptr;
+		}
+	}
+
+	return File;
+}
+
+const uint8* FSaveMappedFile::GetData() const
+{
+	return Region.IsValid() ? Region->GetMappedPtr() : FallbackBytes.GetData();
+}
+
+int64 FSaveMappedFile::Num() const
+{
+	return Region.IsValid() ? Region->GetMappedSize() : FallbackBytes.Num();
+}
+
+// ============================================================================
+// FSaveLazyLoad
+// ============================================================================
+
+bool FSaveLazyLoad::IsPending(ESaveChunkType Type, int32 Key) const
+{
+	return Pending.Contains(FSaveChunkStore::MakeChunkId(Type, Key));
+}
+
+bool FSaveLazyLoad::DecodePending(ESaveChunkType Type, int32 Key, FSaveGameData& OutData,
+	uint32& OutSourceRevision, bool& bOutHashValid)
+{
+	const uint64 Id = FSaveChunkStore::MakeChunkId(Type, Key);
+	FPendingChunk* Chunk = Pending.Find(Id);
+	if (!Chunk)
+	{
+		return false;
+	}
+
+	const uint8* CompressedData = File.IsValid()
+		? File->GetData() + DataStart + Chunk->Entry.Offset
+		: Chunk->Detached.GetData();
+
+	TArray<uint8> Bytes;
+	const bool bDecoded = FSaveChunkStore::DecodeChunk(Chunk->Entry, CompressedData, Bytes, bOutHashValid) &&
+		FSaveChunkStore::DeserializeChunk(Type, Bytes, SAVE_FORMAT_VERSION, OutData);
+
+	OutSourceRevision = Chunk->SourceRevision;
+	Pending.Remove(Id);
+
+	// Nothing left to decode — let go of our reference to the mapping
+	if (Pending.Num() == 0)
+	{
+		File.Reset();
+	}
+
+	return bDecoded;
+}
+
+void FSaveLazyLoad::Discard(ESaveChunkType Type, int32 Key)
+{
+	Pending.Remove(FSaveChunkStore::MakeChunkId(Type, Key));
+	if (Pending.Num() == 0)
+	{
+		File.Reset();
+	}
+}
+
+void FSaveLazyLoad::DetachFrom(const FString& FilePath)
+{
+	if (!File.IsValid() || File->FilePath != FilePath)
+	{
+		return;
+	}
+
+	for (TPair<uint64, FPendingChunk>& Pair : Pending)
+	{
+		FPendingChunk& Chunk = Pair.Value;
+		Chunk.Detached.SetNumUninitialized(Chunk.Entry.CompressedSize);
+		FMemory::Memcpy(Chunk.Detached.GetData(), File->GetData() + DataStart + Chunk.Entry.Offset, Chunk.Entry.CompressedSize);
+	}
+	File.Reset();
+}
+
+void FSaveLazyLoad::Reset()
+{
+	File.Reset();
+	Entries.Reset();
+	Pending.Reset();
+}
@@ -0,0 +1,252 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/SecureHash.h"
+#include "SaveTypes.h"
+
+/** One entry of the on-disk chunk table. Offsets are relative to the start of chunk data. */
+struct FSaveChunkEntry
+{
+	ESaveChunkType Type = ESaveChunkType::Global;
+	int32 Key = 0;
+	int64 Offset = 0;
+	int32 CompressedSize = 0;
+	int32 UncompressedSize = 0;
+
+	// SHA-256 of the uncompressed chunk bytes
+	FSHA256Signature Hash;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveChunkEntry& Entry);
+};
+
+using FSaveCarStateRef = TSharedRef<const FSaveCarState, ESPMode::ThreadSafe>;
+
+/**
+ * Immutable input to one save write, published by the game thread and read by
+ * the save worker. Car states are shared with the subsystem's copy-on-write
+ * cache rather than copied; nothing here is modified after publishing.
+ */
+struct TRAINGAME_API FSaveSnapshot
+{
+	FSaveHeaderData Header;
+	FSaveGlobalState GlobalState;
+	FSavePlayerState PlayerState;
+	TArray<FSaveQuestState> QuestStates;
+	TArray<FSaveCompanionState> CompanionStates;
+
+	TSharedPtr<const TArray<FSaveCarStateRef>, ESPMode::ThreadSafe> Cars;
+	TSharedPtr<const TArray<FSaveNPCState>, ESPMode::ThreadSafe> NPCStates;
+
+	// See FSaveGameData::CarriedChunkIds
+	TArray<uint64> CarriedChunkIds;
+};
+
+/**
+ * A save file opened for reading. Memory-mapped where the platform supports
+ * it, otherwise read into memory once. Shared by every chunk that still
+ * points into it, and released when the last one lets go.
+ */
+struct TRAINGAME_API FSaveMappedFile
+{
+	static TSharedPtr<FSaveMappedFile, ESPMode::ThreadSafe> Open(const FString& InFilePath);
+
+	const uint8* GetData() const;
+	int64 Num() const;
+
+	FString FilePath;
+
+	// Declared before Region so the region is unmapped first
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+	TArray<uint8> FallbackBytes;
+};
+
+/**
+ * Car and NPC chunks of a loaded save that have not been decoded yet. They stay
+ * compressed in the mapped file until the subsystem first asks for that car.
+ * Only files already in SAVE_FORMAT_VERSION are loaded lazily, since pending
+ * chunks are carried into new saves byte-for-byte.
+ */
+struct TRAINGAME_API FSaveLazyLoad
+{
+	struct FPendingChunk
+	{
+		FSaveChunkEntry Entry;
+
+		// Revision the car will carry once decoded, so the writer can reuse the loaded bytes
+		uint32 SourceRevision = 0;
+
+		// Owned copy of the compressed bytes once the mapping has been released
+		TArray<uint8> Detached;
+	};
+
+	TSharedPtr<FSaveMappedFile, ESPMode::ThreadSafe> File;
+	int64 DataStart = 0;
+	int64 HeaderOffset = 0;
+	int32 HeaderLength = 0;
+	int64 TableOffset = 0;
+	int32 TableSize = 0;
+
+	// Full chunk table of the loaded file, for the writer's append ledger
+	TArray<FSaveChunkEntry> Entries;
+
+	TMap<uint64, FPendingChunk> Pending;
+
+	bool HasPending() const { return Pending.Num() > 0; }
+	bool IsPending(ESaveChunkType Type, int32 Key) const;
+
+	/** Decode a pending chunk into OutData and drop it from the pending set. */
+	bool DecodePending(ESaveChunkType Type, int32 Key, FSaveGameData& OutData,
+		uint32& OutSourceRevision, bool& bOutHashValid);
+
+	/** Forget a pending chunk whose state has been replaced wholesale. */
+	void Discard(ESaveChunkType Type, int32 Key);
+
+	/** Copy pending bytes out of the mapping if it is FilePath, so that file can be rewritten. */
+	void DetachFrom(const FString& FilePath);
+
+	void Reset();
+};
+
+// ============================================================================
+// FSaveChunkStore
+//
+// Owns the encoded (serialized, LZ4-compressed, SHA-256 hashed) form of every
+// payload chunk between saves. Car chunks are only re-encoded when their
+// SaveRevision changes; the small global sections are re-serialized each save
+// but only recompressed when their bytes actually differ.
+//
+// Slot files are append-only between compactions: a save appends the chunks
+// that file has not seen yet, a fresh chunk table and a fresh JSON header, all
+// past the previous save's bytes. Only then is the preamble rewritten to point
+// at the new header; that one small write at offset 0 is the commit point, so
+// a crash before it lands leaves the previous save readable. A slot is
+// rewritten from scratch every SAVE_COMPACTION_INTERVAL appends, or as soon as
+// superseded bytes outweigh live ones.
+//
+// Write() may run on any thread; calls are serialized internally. The store is
+// shared with in-flight save tasks so it outlives the subsystem if need be.
+// ============================================================================
+class TRAINGAME_API FSaveChunkStore
+{
+public:
+	/**
+	 * Write Snapshot to FilePath, reusing cached chunk encodings where possible.
+	 * BuildHeaderJson receives Snapshot.Header with Checksum and chunk table fields filled in.
+	 */
+	ESaveResult Write(const FSaveSnapshot& Snapshot, const FString& FilePath,
+		TFunctionRef<FString(const FSaveHeaderData&)> BuildHeaderJson);
+
+	/** Drop cached encodings and per-file ledgers (after a load replaces in-memory state). */
+	void Reset();
+
+	/**
+	 * Take over the still-encoded chunks of a lazily loaded file without copying them,
+	 * and record the file's layout so the next save to it can append.
+	 */
+	void AdoptLoadedFile(const FSaveLazyLoad& Loaded);
+
+	/** Copy adopted chunks out of FilePath's mapping and forget its ledger, so the file can be deleted. */
+	void ReleaseFile(const FString& FilePath);
+
+	// --- Format helpers shared with the load path ---
+
+	static uint64 MakeChunkId(ESaveChunkType Type, int32 Key);
+
+	/** "sha256:<hex>" of a byte range. */
+	static FString ComputeChecksum(const uint8* Data, int64 Size);
+
+	static bool ParseChunkTable(const uint8* TableData, int32 TableSize, TArray<FSaveChunkEntry>& OutEntries);
+
+	/** Decompress one chunk and verify its hash. Returns false only if the bytes cannot be decompressed. */
+	static bool DecodeChunk(const FSaveChunkEntry& Entry, const uint8* CompressedData,
+		TArray<uint8>& OutBytes, bool& bOutHashValid);
+
+	/** Deserialize a decoded chunk, written in FormatVersion, into the matching section of OutData. */
+	static bool DeserializeChunk(ESaveChunkType Type, const TArray<uint8>& Bytes, int32 FormatVersion, FSaveGameData& OutData);
+
+private:
+	struct FEncodedChunk
+	{
+		ESaveChunkType Type = ESaveChunkType::Global;
+		int32 Key = 0;
+
+		// Store-wide counter, bumped every time the chunk is re-encoded (0 = never)
+		uint32 Generation = 0;
+
+		// FSaveCarState::SaveRevision the encoding was made from (car chunks only)
+		uint32 SourceRevision = 0;
+
+		int32 UncompressedSize = 0;
+		int32 CompressedSize = 0;
+
+		// SHA-256 of the uncompressed bytes; also how unchanged sections skip recompression
+		FSHA256Signature Hash;
+
+		// Either owned bytes, or a view into a loaded file adopted from a lazy load
+		TArray<uint8> Compressed;
+		TSharedPtr<FSaveMappedFile, ESPMode::ThreadSafe> Mapping;
+		int64 MappedOffset = 0;
+
+		const uint8* GetCompressedData() const
+		{
+			return Mapping.IsValid() ? Mapping->GetData() + MappedOffset : Compressed.GetData();
+		}
+	};
+
+	struct FChunkLocation
+	{
+		uint32 Generation = 0;
+		int64 Offset = 0;
+		int32 Size = 0;
+	};
+
+	/** What we last wrote to a slot file, so the next save can append instead of rewrite. */
+	struct FFileLedger
+	{
+		int64 FileSize = 0;
+		FDateTime ModificationTime;
+
+		// Relative offset where the next append starts (end of the current header)
+		int64 DataEnd = 0;
+		int32 TableSize = 0;
+
+		int64 LiveBytes = 0;
+		int64 DeadBytes = 0;
+		int32 AppendCount = 0;
+
+		TMap<uint64, FChunkLocation> Chunks;
+	};
+
+	bool EncodeSections(const FSaveSnapshot& Snapshot, TArray<uint64>& OutLiveIds);
+	bool RefreshChunk(ESaveChunkType Type, int32 Key, const TArray<uint8>& RawBytes, uint32 SourceRevision);
+	bool CanAppend(const FFileLedger& Ledger, const FString& FilePath) const;
+
+	/** Copy adopted chunks out of FilePath's mapping before that file is written. */
+	void DetachChunksMappedFrom(const FString& FilePath);
+
+	/** Assign offsets to live chunks starting at BaseOffset; chunks Ledger already holds keep theirs. */
+	void LayoutChunks(const TArray<uint64>& LiveIds, const FFileLedger* Ledger, int64 BaseOffset,
+		TArray<FSaveChunkEntry>& OutEntries, TArray<const FEncodedChunk*>& OutToWrite, int64& OutTableOffset) const;
+
+	ESaveResult AppendToFile(const FString& FilePath, FFileLedger& Ledger, const TArray<FSaveChunkEntry>& Entries,
+		const TArray<const FEncodedChunk*>& ToWrite, const TArray<uint8>& TableBytes, int64 TableOffset,
+		const TArray<uint8>& HeaderBytes);
+
+	ESaveResult RewriteFile(const FString& FilePath, const TArray<FSaveChunkEntry>& Entries,
+		const TArray<const FEncodedChunk*>& ToWrite, const TArray<uint8>& TableBytes, int64 TableOffset,
+		const TArray<uint8>& HeaderBytes);
+
+	void RecordLedger(const FString& FilePath, FFileLedger& Ledger, const TArray<FSaveChunkEntry>& Entries,
+		int64 TableOffset, int32 TableSize, int32 HeaderSize) const;
+
+	TMap<uint64, FEncodedChunk> Chunks;
+	TMap<FString, FFileLedger> Ledgers;
+	uint32 NextGeneration = 0;
+
+	FCriticalSection Mutex;
+};
@@ -3,11 +3,11 @@
 #include "SaveGameSubsystem.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "Misc/SecureHash.h"
 #include "Async/Async.h"
 #include "TimerManager.h"
 #include "Engine/GameInstance.h"
@@ -45,24 +45,14 @@ void USEESaveGameSubsystem::SaveToManualSlot(int32 SlotIndex, const FString& Slo
 		return;
 	}
 
-	FSaveGameData Data = GatherCurrentState();
-	Data.Header.SlotType = ESaveSlotType::Manual;
-	Data.Header.SlotName = SlotName;
-
-	const FString FilePath = GetSlotFilePath(SlotIndex);
-	PerformAsyncSave(MoveTemp(Data), FilePath, SlotIndex);
+	RequestSave(ESaveSlotType::Manual, SlotName, SlotIndex);
 }
 
 void USEESaveGameSubsystem::QuickSave()
 {
 	const int32 AbsoluteIndex = SlotConfig.ManualSlotCount + NextQuickSaveSlot;
 
-	FSaveGameData Data = GatherCurrentState();
-	Data.Header.SlotType = ESaveSlotType::QuickSave;
-	Data.Header.SlotName = FString::Printf(TEXT("Quick Save %d"), NextQuickSaveSlot + 1);
-
-	const FString FilePath = GetSlotFilePath(AbsoluteIndex);
-	PerformAsyncSave(MoveTemp(Data), FilePath, AbsoluteIndex);
+	RequestSave(ESaveSlotType::QuickSave, FString::Printf(TEXT("Quick Save %d"), NextQuickSaveSlot + 1), AbsoluteIndex);
 
 	NextQuickSaveSlot = (NextQuickSaveSlot + 1) % SlotConfig.QuickSaveSlotCount;
 }
@@ -87,14 +77,14 @@ void USEESaveGameSubsystem::TriggerAutosave(EAutosaveTrigger Trigger)
 
 	const int32 AbsoluteIndex = SlotConfig.ManualSlotCount + SlotConfig.QuickSaveSlotCount + NextAutosaveSlot;
 
-	FSaveGameData Data = GatherCurrentState();
-	Data.Header.SlotType = ESaveSlotType::Autosave;
-	Data.Header.SlotName = FString::Printf(TEXT("Autosave %d"), NextAutosaveSlot + 1);
-
-	const FString FilePath = GetSlotFilePath(AbsoluteIndex);
-	PerformAsyncSave(MoveTemp(Data), FilePath, AbsoluteIndex);
+	const bool bCoalesced = RequestSave(ESaveSlotType::Autosave,
+		FString::Printf(TEXT("Autosave %d"), NextAutosaveSlot + 1), AbsoluteIndex);
 
-	NextAutosaveSlot = (NextAutosaveSlot + 1) % SlotConfig.AutosaveSlotCount;
+	// Merged into an autosave still waiting to be written: that one keeps its slot
+	if (!bCoalesced)
+	{
+		NextAutosaveSlot = (NextAutosaveSlot + 1) % SlotConfig.AutosaveSlotCount;
+	}
 	AutosaveCooldownRemaining = SlotConfig.AutosaveCooldownSeconds;
 
 	OnAutosaveTriggered.Broadcast(Trigger);
@@ -105,55 +95,74 @@ void USEESaveGameSubsystem::TriggerAutosave(EAutosaveTrigger Trigger)
 // ============================================================================
 
 void USEESaveGameSubsystem::LoadFromSlot(int32 AbsoluteSlotIndex)
+{
+	OnLoadComplete.Broadcast(TryLoadSlot(AbsoluteSlotIndex), AbsoluteSlotIndex);
+}
+
+ELoadResult USEESaveGameSubsystem::TryLoadSlot(int32 AbsoluteSlotIndex)
 {
 	const FString FilePath = GetSlotFilePath(AbsoluteSlotIndex);
 
 	FSaveGameData Data;
-	ELoadResult Result = ReadSaveFile(FilePath, Data);
+	FSaveLazyLoad Lazy;
+	ELoadResult Result = ReadSaveFile(FilePath, Data, &Lazy);
 
 	if (Result == ELoadResult::Success || Result == ELoadResult::SuccessModded)
 	{
 		ApplyLoadedState(Data);
+
+		// Cars stay encoded until first asked for; hand their bytes to the writer
+		// so saving before then does not need to decode them either
+		for (TPair<uint64, FSaveLazyLoad::FPendingChunk>& Pair : Lazy.Pending)
+		{
+			if (Pair.Value.Entry.Type == ESaveChunkType::Car)
+			{
+				Pair.Value.SourceRevision = ++CarRevisionCounter;
+			}
+		}
+		ChunkStore->AdoptLoadedFile(Lazy);
+		LazyLoad = MoveTemp(Lazy);
+
 		ActiveSaveData = MoveTemp(Data);
 		bIsPermadeathSave = (ActiveSaveData->GlobalState.DifficultyTier == 3);
 	}
 
-	OnLoadComplete.Broadcast(Result, AbsoluteSlotIndex);
+	return Result;
 }
 
 void USEESaveGameSubsystem::LoadMostRecentAutosave()
 {
-	FDateTime MostRecentTime = FDateTime::MinValue();
-	int32 MostRecentSlot = -1;
-
+	// Header timestamps are enough to order the slots; the payload is only read when loading
+	TArray<FSaveSlotInfo> Candidates;
 	const int32 AutosaveStart = SlotConfig.ManualSlotCount + SlotConfig.QuickSaveSlotCount;
 	for (int32 i = 0; i < SlotConfig.AutosaveSlotCount; ++i)
 	{
-		const int32 AbsIndex = AutosaveStart + i;
-		const FString FilePath = GetSlotFilePath(AbsIndex);
-
-		if (FPaths::FileExists(FilePath))
+		FSaveSlotInfo Info = GetSlotInfo(AutosaveStart + i);
+		if (!Info.bIsEmpty)
 		{
-			FSaveGameData Data;
-			if (ReadSaveFile(FilePath, Data) == ELoadResult::Success)
-			{
-				if (Data.Header.Timestamp > MostRecentTime)
-				{
-					MostRecentTime = Data.Header.Timestamp;
-					MostRecentSlot = AbsIndex;
-				}
-			}
+			Candidates.Add(MoveTemp(Info));
 		}
 	}
 
-	if (MostRecentSlot >= 0)
+	Candidates.Sort([](const FSaveSlotInfo& A, const FSaveSlotInfo& B)
 	{
-		LoadFromSlot(MostRecentSlot);
-	}
-	else
+		return A.Header.Timestamp > B.Header.Timestamp;
+	});
+
+	// Newest first; a corrupt autosave falls back to the next newest
+	ELoadResult Result = ELoadResult::FailedNotFound;
+	for (const FSaveSlotInfo& Info : Candidates)
 	{
-		OnLoadComplete.Broadcast(ELoadResult::FailedNotFound, -1);
+		Result = TryLoadSlot(Info.SlotIndex);
+		if (Result == ELoadResult::Success || Result == ELoadResult::SuccessModded)
+		{
+			OnLoadComplete.Broadcast(Result, Info.SlotIndex);
+			return;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("SaveGameSubsystem: autosave slot %d failed to load, trying the next newest"), Info.SlotIndex);
 	}
+
+	OnLoadComplete.Broadcast(Result, -1);
 }
 
 // ============================================================================
@@ -181,37 +190,27 @@ FSaveSlotInfo USEESaveGameSubsystem::GetSlotInfo(int32 AbsoluteSlotIndex) const
 	Info.bIsEmpty = true;
 
 	const FString FilePath = GetSlotFilePath(AbsoluteSlotIndex);
-	if (FPaths::FileExists(FilePath))
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FilePath);
+	if (!Stat.bIsValid || Stat.bIsDirectory)
 	{
-		// Read only the JSON header without deserializing the full payload
-		TArray<uint8> FileData;
-		if (FFileHelper::LoadFileToArray(FileData, *FilePath))
-		{
-			if (FileData.Num() >= 12)
-			{
-				// Validate magic bytes
-				if (FileData[0] == SAVE_MAGIC[0] && FileData[1] == SAVE_MAGIC[1] &&
-					FileData[2] == SAVE_MAGIC[2] && FileData[3] == SAVE_MAGIC[3])
-				{
-					// Read JSON header length
-					int32 HeaderLength = 0;
-					FMemory::Memcpy(&HeaderLength, &FileData[8], sizeof(int32));
-
-					if (HeaderLength > 0 && 12 + HeaderLength <= FileData.Num())
-					{
-						FString JsonStr;
-						const auto Converter = FUTF8ToTCHAR(
-							reinterpret_cast<const ANSICHAR*>(&FileData[12]), HeaderLength);
-						JsonStr = FString(Converter.Length(), Converter.Get());
-
-						if (DeserializeHeader(JsonStr, Info.Header))
-						{
-							Info.bIsEmpty = false;
-						}
-					}
-				}
-			}
-		}
+		SlotHeaderCache.Remove(AbsoluteSlotIndex);
+		return Info;
+	}
+
+	// Only hit the disk when the file changed since we last parsed its header
+	FCachedSlotHeader& Cached = SlotHeaderCache.FindOrAdd(AbsoluteSlotIndex);
+	if (Cached.FileSize != Stat.FileSize || Cached.ModificationTime != Stat.ModificationTime)
+	{
+		Cached.FileSize = Stat.FileSize;
+		Cached.ModificationTime = Stat.ModificationTime;
+		Cached.Header = FSaveHeaderData();
+		Cached.bValid = ReadSlotHeader(FilePath, Cached.Header);
+	}
+
+	if (Cached.bValid)
+	{
+		Info.Header = Cached.Header;
+		Info.bIsEmpty = false;
 	}
 
 	return Info;
@@ -222,10 +221,25 @@ bool USEESaveGameSubsystem::IsSlotOccupied(int32 AbsoluteSlotIndex) const
 	return FPaths::FileExists(GetSlotFilePath(AbsoluteSlotIndex));
 }
 
-void USEESaveGameSubsystem::DeleteSlot(int32 AbsoluteSlotIndex)
+bool USEESaveGameSubsystem::DeleteSlot(int32 AbsoluteSlotIndex)
 {
 	const FString FilePath = GetSlotFilePath(AbsoluteSlotIndex);
-	IFileManager::Get().Delete(*FilePath);
+	SlotHeaderCache.Remove(AbsoluteSlotIndex);
+
+	// A lazily loaded slot is still memory-mapped, and Windows will not delete a mapped file
+	LazyLoad.DetachFrom(FilePath);
+	ChunkStore->ReleaseFile(FilePath);
+
+	if (!FPaths::FileExists(FilePath))
+	{
+		return true;
+	}
+	if (!IFileManager::Get().Delete(*FilePath, /*RequireExists*/ false, /*EvenReadOnly*/ true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("SaveGameSubsystem: could not delete slot %d (%s)"), AbsoluteSlotIndex, *FilePath);
+		return false;
+	}
+	return true;
 }
 
 // ============================================================================
@@ -242,7 +256,18 @@ FSaveGameData USEESaveGameSubsystem::GatherCurrentState() const
 	Data.Header.Timestamp = FDateTime::UtcNow();
 
 	// Per-car state from cache
-	CarStateCache.GenerateValueArray(Data.ModifiedCars);
+	Data.ModifiedCars.Reserve(CarStateCache.Num());
+	for (const TPair<int32, TSharedRef<FSaveCarState, ESPMode::ThreadSafe>>& Pair : CarStateCache)
+	{
+		Data.ModifiedCars.Add(*Pair.Value);
+	}
+
+	// NPCs decoded since the last load, plus chunks nobody has decoded yet
+	if (ActiveSaveData.IsSet())
+	{
+		Data.NPCStates = ActiveSaveData->NPCStates;
+	}
+	LazyLoad.Pending.GenerateKeyArray(Data.CarriedChunkIds);
 
 	// Global state, player state, NPC state, quest state, companion state
 	// are gathered from their respective subsystems/components at save time.
@@ -258,8 +283,20 @@ void USEESaveGameSubsystem::ApplyLoadedState(const FSaveGameData& Data)
 	CarStateCache.Empty();
 	for (const FSaveCarState& CarState : Data.ModifiedCars)
 	{
-		CarStateCache.Add(CarState.CarIndex, CarState);
+		TSharedRef<FSaveCarState, ESPMode::ThreadSafe> Cached = MakeShared<FSaveCarState, ESPMode::ThreadSafe>(CarState);
+		Cached->SaveRevision = ++CarRevisionCounter;
+		CarStateCache.Add(CarState.CarIndex, Cached);
+	}
+
+	// Cached encodings, pending chunks and published snapshots describe the state we just replaced
+	ChunkStore->Reset();
+	LazyLoad.Reset();
+	for (FCarSnapshotBuffer& Buffer : CarSnapshotBuffers)
+	{
+		Buffer.bNeedsRebuild = true;
+		Buffer.DirtyCars.Reset();
 	}
+	PublishedNPCStates.Reset();
 
 	// Other subsystems listen to OnLoadComplete to restore their own state.
 }
@@ -270,19 +307,20 @@ void USEESaveGameSubsystem::ApplyLoadedState(const FSaveGameData& Data)
 
 void USEESaveGameSubsystem::MarkCarModified(int32 CarIndex)
 {
-	if (!CarStateCache.Contains(CarIndex))
-	{
-		FSaveCarState NewState;
-		NewState.CarIndex = CarIndex;
-		CarStateCache.Add(CarIndex, NewState);
-	}
+	// Modify the saved delta, not a blank one
+	ResolveLazyCar(CarIndex);
+
+	FSaveCarState& State = EditCarState(CarIndex);
+	State.SaveRevision = ++CarRevisionCounter;
 }
 
-bool USEESaveGameSubsystem::GetCarState(int32 CarIndex, FSaveCarState& OutState) const
+bool USEESaveGameSubsystem::GetCarState(int32 CarIndex, FSaveCarState& OutState)
 {
-	if (const FSaveCarState* Found = CarStateCache.Find(CarIndex))
+	ResolveLazyCar(CarIndex);
+
+	if (const TSharedRef<FSaveCarState, ESPMode::ThreadSafe>* Found = CarStateCache.Find(CarIndex))
 	{
-		OutState = *Found;
+		OutState = **Found;
 		return true;
 	}
 	return false;
@@ -290,7 +328,116 @@ bool USEESaveGameSubsystem::GetCarState(int32 CarIndex, FSaveCarState& OutState)
 
 void USEESaveGameSubsystem::UpdateCarState(const FSaveCarState& CarState)
 {
-	CarStateCache.Add(CarState.CarIndex, CarState);
+	// The whole delta is being replaced; the loaded one no longer matters
+	LazyLoad.Discard(ESaveChunkType::Car, CarState.CarIndex);
+
+	FSaveCarState Replacement = CarState;
+	Replacement.SaveRevision = ++CarRevisionCounter;
+	ReplaceCarState(MoveTemp(Replacement));
+}
+
+FSaveCarState& USEESaveGameSubsystem::EditCarState(int32 CarIndex)
+{
+	TSharedRef<FSaveCarState, ESPMode::ThreadSafe>* Found = CarStateCache.Find(CarIndex);
+	if (!Found)
+	{
+		Found = &CarStateCache.Add(CarIndex, MakeShared<FSaveCarState, ESPMode::ThreadSafe>());
+		(*Found)->CarIndex = CarIndex;
+	}
+	else if (!Found->IsUnique())
+	{
+		// A published snapshot still reads the old state
+		*Found = MakeShared<FSaveCarState, ESPMode::ThreadSafe>(**Found);
+	}
+
+	MarkCarDirty(CarIndex);
+	return **Found;
+}
+
+void USEESaveGameSubsystem::ReplaceCarState(FSaveCarState&& CarState)
+{
+	const int32 CarIndex = CarState.CarIndex;
+	CarStateCache.Add(CarIndex, MakeShared<FSaveCarState, ESPMode::ThreadSafe>(MoveTemp(CarState)));
+	MarkCarDirty(CarIndex);
+}
+
+void USEESaveGameSubsystem::MarkCarDirty(int32 CarIndex)
+{
+	for (FCarSnapshotBuffer& Buffer : CarSnapshotBuffers)
+	{
+		Buffer.DirtyCars.Add(CarIndex);
+	}
+}
+
+void USEESaveGameSubsystem::GetNPCStatesInCar(int32 CarIndex, TArray<FSaveNPCState>& OutStates)
+{
+	ResolveLazyCar(CarIndex);
+
+	OutStates.Reset();
+	if (ActiveSaveData.IsSet())
+	{
+		for (const FSaveNPCState& NPC : ActiveSaveData->NPCStates)
+		{
+			if (NPC.CurrentCarIndex == CarIndex)
+			{
+				OutStates.Add(NPC);
+			}
+		}
+	}
+}
+
+void USEESaveGameSubsystem::ResolveLazyCar(int32 CarIndex)
+{
+	if (!LazyLoad.HasPending())
+	{
+		return;
+	}
+
+	uint32 SourceRevision = 0;
+	bool bHashValid = true;
+
+	if (LazyLoad.IsPending(ESaveChunkType::Car, CarIndex))
+	{
+		FSaveGameData Decoded;
+		if (LazyLoad.DecodePending(ESaveChunkType::Car, CarIndex, Decoded, SourceRevision, bHashValid) &&
+			Decoded.ModifiedCars.Num() == 1)
+		{
+			// Keep the revision the writer adopted, so an untouched car is saved from the loaded bytes
+			Decoded.ModifiedCars[0].SaveRevision = SourceRevision;
+			ReplaceCarState(MoveTemp(Decoded.ModifiedCars[0]));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("SaveGameSubsystem: car %d chunk failed to decode; treating car as unvisited"), CarIndex);
+		}
+
+		if (!bHashValid)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveGameSubsystem: car %d chunk checksum mismatch (modded save?)"), CarIndex);
+		}
+	}
+
+	if (LazyLoad.IsPending(ESaveChunkType::NPCs, CarIndex))
+	{
+		FSaveGameData Decoded;
+		if (LazyLoad.DecodePending(ESaveChunkType::NPCs, CarIndex, Decoded, SourceRevision, bHashValid))
+		{
+			if (ActiveSaveData.IsSet())
+			{
+				ActiveSaveData->NPCStates.Append(MoveTemp(Decoded.NPCStates));
+				PublishedNPCStates.Reset();
+			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("SaveGameSubsystem: NPC chunk for car %d failed to decode"), CarIndex);
+		}
+
+		if (!bHashValid)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveGameSubsystem: NPC chunk for car %d checksum mismatch (modded save?)"), CarIndex);
+		}
+	}
 }
 
 // ============================================================================
@@ -329,18 +476,31 @@ void USEESaveGameSubsystem::OnTimedAutosaveTick()
 // Permadeath (Mr. Wilford)
 // ============================================================================
 
-void USEESaveGameSubsystem::DeletePermadeathSave()
+bool USEESaveGameSubsystem::DeletePermadeathSave()
 {
-	if (bIsPermadeathSave && ActiveSaveData.IsSet())
+	if (!bIsPermadeathSave || !ActiveSaveData.IsSet())
+	{
+		return true;
+	}
+
+	// The run is over; drop every mapping into its files rather than copying chunks out
+	LazyLoad.Reset();
+	ChunkStore->Reset();
+
+	// Delete all save files for this permadeath run
+	bool bAllDeleted = true;
+	const int32 Total = SlotConfig.GetTotalSlotCount();
+	for (int32 i = 0; i < Total; ++i)
+	{
+		bAllDeleted &= DeleteSlot(i);
+	}
+
+	// Keep the run marked as permadeath so a failed delete can be retried
+	if (bAllDeleted)
 	{
-		// Delete all save files for this permadeath run
-		const int32 Total = SlotConfig.GetTotalSlotCount();
-		for (int32 i = 0; i < Total; ++i)
-		{
-			DeleteSlot(i);
-		}
 		ActiveSaveData.Reset();
 	}
+	return bAllDeleted;
 }
 
 bool USEESaveGameSubsystem::IsPermadeathSave() const
@@ -352,116 +512,24 @@ bool USEESaveGameSubsystem::IsPermadeathSave() const
 // Internal File I/O
 // ============================================================================
 
-ESaveResult USEESaveGameSubsystem::WriteSaveFile(const FSaveGameData& Data, const FString& FilePath)
-{
-	// Serialize binary payload
-	TArray<uint8> PayloadBytes;
-	FMemoryWriter PayloadWriter(PayloadBytes);
-
-	// Write all payload sections via FArchive
-	// Global state
-	FSaveGlobalState GlobalCopy = Data.GlobalState;
-	PayloadWriter << GlobalCopy.WorldTimeSeconds;
-	PayloadWriter << GlobalCopy.DifficultyTier;
-	PayloadWriter << GlobalCopy.RevolutionFlags;
-	PayloadWriter << GlobalCopy.FactionReputations;
-	PayloadWriter << GlobalCopy.DiscoveredCars;
-
-	// Player state
-	FSavePlayerState PlayerCopy = Data.PlayerState;
-	PayloadWriter << PlayerCopy.Position;
-	PayloadWriter << PlayerCopy.Rotation;
-	PayloadWriter << PlayerCopy.CurrentCarIndex;
-	PayloadWriter << PlayerCopy.Stats;
-	PayloadWriter << PlayerCopy.Level;
-	PayloadWriter << PlayerCopy.XP;
-
-	// Car states
-	int32 NumCars = Data.ModifiedCars.Num();
-	PayloadWriter << NumCars;
-	for (const FSaveCarState& Car : Data.ModifiedCars)
-	{
-		FSaveCarState CarCopy = Car;
-		PayloadWriter << CarCopy.CarIndex;
-		PayloadWriter << CarCopy.LootedContainers;
-		PayloadWriter << CarCopy.DoorStates;
-		PayloadWriter << CarCopy.DestroyedDestructibles;
-		PayloadWriter << CarCopy.ClutterSeed;
-	}
-
-	// Compute checksum of uncompressed payload
-	const FString Checksum = ComputePayloadChecksum(PayloadBytes);
-
-	// LZ4 compression
-	TArray<uint8> CompressedPayload;
-	const int32 UncompressedSize = PayloadBytes.Num();
-	CompressedPayload.SetNum(FCompression::CompressMemoryBound(NAME_LZ4, UncompressedSize));
-
-	int32 CompressedSize = CompressedPayload.Num();
-	if (!FCompression::CompressMemory(
-		NAME_LZ4,
-		CompressedPayload.GetData(),
-		CompressedSize,
-		PayloadBytes.GetData(),
-		UncompressedSize))
-	{
-		return ESaveResult::FailedCompress;
-	}
-	CompressedPayload.SetNum(CompressedSize);
-
-	// Build header JSON
-	FSaveHeaderData HeaderCopy = Data.Header;
-	HeaderCopy.Checksum = Checksum;
-	const FString HeaderJson = SerializeHeader(HeaderCopy);
-	const FTCHARToUTF8 HeaderUtf8(*HeaderJson);
-	const int32 HeaderLength = HeaderUtf8.Length();
-
-	// Assemble final file
-	TArray<uint8> FileData;
-	FMemoryWriter FileWriter(FileData);
-
-	// Magic bytes
-	FileWriter.Serialize(const_cast<uint8*>(SAVE_MAGIC), 4);
-
-	// Format version
-	int32 Version = SAVE_FORMAT_VERSION;
-	FileWriter << Version;
-
-	// Header length
-	FileWriter << const_cast<int32&>(HeaderLength);
-
-	// JSON header
-	FileData.Append(reinterpret_cast<const uint8*>(HeaderUtf8.Get()), HeaderLength);
-
-	// Uncompressed size (for decompression)
-	FileData.Append(reinterpret_cast<const uint8*>(&UncompressedSize), sizeof(int32));
-
-	// Compressed payload
-	FileData.Append(CompressedPayload);
-
-	// Write to disk
-	if (!FFileHelper::SaveArrayToFile(FileData, *FilePath))
-	{
-		return ESaveResult::FailedIO;
-	}
-
-	return ESaveResult::Success;
-}
-
-ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGameData& OutData)
+ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGameData& OutData, FSaveLazyLoad* OutLazy)
 {
 	if (!FPaths::FileExists(FilePath))
 	{
 		return ELoadResult::FailedNotFound;
 	}
 
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	// Mapped rather than read: a lazy load only touches the pages it decodes
+	TSharedPtr<FSaveMappedFile, ESPMode::ThreadSafe> File = FSaveMappedFile::Open(FilePath);
+	if (!File.IsValid())
 	{
 		return ELoadResult::FailedCorrupt;
 	}
 
-	if (FileData.Num() < 12)
+	const uint8* FileData = File->GetData();
+	const int64 FileSize = File->Num();
+
+	if (FileSize < SAVE_PREAMBLE_SIZE)
 	{
 		return ELoadResult::FailedCorrupt;
 	}
@@ -475,18 +543,34 @@ ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGa
 
 	// Read version
 	int32 Version = 0;
-	FMemory::Memcpy(&Version, &FileData[4], sizeof(int32));
+	FMemory::Memcpy(&Version, FileData + 4, sizeof(int32));
 	if (Version > SAVE_FORMAT_VERSION)
 	{
 		return ELoadResult::FailedVersion;
 	}
 
-	// Read header length
+	// Older chunk encodings are decoded up front and rewritten in the current format on the next save
+	if (Version != SAVE_FORMAT_VERSION)
+	{
+		OutLazy = nullptr;
+	}
+
+	// Read header length, and from format 4 on where the header sits
 	int32 HeaderLength = 0;
-	FMemory::Memcpy(&HeaderLength, &FileData[8], sizeof(int32));
+	FMemory::Memcpy(&HeaderLength, FileData + 8, sizeof(int32));
+
+	int64 HeaderOffset = SAVE_PREAMBLE_SIZE;
+	if (Version >= SAVE_FORMAT_VERSION_TRAILING_HEADER)
+	{
+		if (FileSize < SAVE_PREAMBLE_SIZE_TRAILING)
+		{
+			return ELoadResult::FailedCorrupt;
+		}
+		FMemory::Memcpy(&HeaderOffset, FileData + SAVE_PREAMBLE_SIZE, sizeof(int64));
+	}
 
-	const int32 PayloadOffset = 12 + HeaderLength;
-	if (PayloadOffset + static_cast<int32>(sizeof(int32)) > FileData.Num())
+	if (HeaderLength <= 0 || HeaderLength > SAVE_MAX_HEADER_SIZE ||
+		HeaderOffset < SAVE_PREAMBLE_SIZE || HeaderOffset + HeaderLength > FileSize)
 	{
 		return ELoadResult::FailedCorrupt;
 	}
@@ -494,7 +578,7 @@ ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGa
 	// Parse JSON header
 	FString HeaderJson;
 	const auto Converter = FUTF8ToTCHAR(
-		reinterpret_cast<const ANSICHAR*>(&FileData[12]), HeaderLength);
+		reinterpret_cast<const ANSICHAR*>(FileData + HeaderOffset), HeaderLength);
 	HeaderJson = FString(Converter.Length(), Converter.Get());
 
 	if (!DeserializeHeader(HeaderJson, OutData.Header))
@@ -502,13 +586,88 @@ ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGa
 		return ELoadResult::FailedCorrupt;
 	}
 
+	if (Version == SAVE_FORMAT_VERSION_LEGACY)
+	{
+		return ReadLegacyPayload(FileData, FileSize, SAVE_PREAMBLE_SIZE + HeaderLength, OutData);
+	}
+
+	// Chunk data starts after the preamble (format 4) or the header region (formats 2-3);
+	// the table sits at an offset within it
+	const int64 DataStart = Version >= SAVE_FORMAT_VERSION_TRAILING_HEADER
+		? SAVE_PREAMBLE_SIZE_TRAILING
+		: SAVE_PREAMBLE_SIZE + FMath::Max(HeaderLength, SAVE_HEADER_RESERVE);
+	const int64 TableStart = DataStart + OutData.Header.ChunkTableOffset;
+	const int32 TableSize = OutData.Header.ChunkTableSize;
+	if (OutData.Header.ChunkTableOffset < 0 || TableSize <= 0 || TableStart + TableSize > FileSize)
+	{
+		return ELoadResult::FailedCorrupt;
+	}
+
+	// The header checksum covers the table, which in turn holds every chunk's hash
+	bool bChecksumValid = ValidateChecksum(OutData.Header.Checksum, FileData + TableStart, TableSize);
+
+	TArray<FSaveChunkEntry> Entries;
+	if (!FSaveChunkStore::ParseChunkTable(FileData + TableStart, TableSize, Entries))
+	{
+		return ELoadResult::FailedCorrupt;
+	}
+
+	TArray<uint8> ChunkBytes;
+	for (const FSaveChunkEntry& Entry : Entries)
+	{
+		const int64 ChunkStart = DataStart + Entry.Offset;
+		if (Entry.Offset < 0 || ChunkStart + Entry.CompressedSize > FileSize)
+		{
+			return ELoadResult::FailedCorrupt;
+		}
+
+		// Per-car chunks are decoded on first access; their hashes are checked then
+		const bool bPerCar = Entry.Type == ESaveChunkType::Car || Entry.Type == ESaveChunkType::NPCs;
+		if (OutLazy && bPerCar)
+		{
+			FSaveLazyLoad::FPendingChunk& PendingChunk =
+				OutLazy->Pending.Add(FSaveChunkStore::MakeChunkId(Entry.Type, Entry.Key));
+			PendingChunk.Entry = Entry;
+			continue;
+		}
+
+		bool bHashValid = false;
+		if (!FSaveChunkStore::DecodeChunk(Entry, FileData + ChunkStart, ChunkBytes, bHashValid) ||
+			!FSaveChunkStore::DeserializeChunk(Entry.Type, ChunkBytes, Version, OutData))
+		{
+			return ELoadResult::FailedCorrupt;
+		}
+		bChecksumValid &= bHashValid;
+	}
+
+	if (OutLazy)
+	{
+		OutLazy->File = MoveTemp(File);
+		OutLazy->DataStart = DataStart;
+		OutLazy->HeaderOffset = HeaderOffset;
+		OutLazy->HeaderLength = HeaderLength;
+		OutLazy->TableOffset = OutData.Header.ChunkTableOffset;
+		OutLazy->TableSize = TableSize;
+		OutLazy->Entries = MoveTemp(Entries);
+	}
+
+	return bChecksumValid ? ELoadResult::Success : ELoadResult::SuccessModded;
+}
+
+ELoadResult USEESaveGameSubsystem::ReadLegacyPayload(const uint8* FileData, int64 FileSize, int32 PayloadOffset, FSaveGameData& OutData)
+{
+	if (PayloadOffset + static_cast<int64>(sizeof(int32)) > FileSize)
+	{
+		return ELoadResult::FailedCorrupt;
+	}
+
 	// Read uncompressed size
 	int32 UncompressedSize = 0;
-	FMemory::Memcpy(&UncompressedSize, &FileData[PayloadOffset], sizeof(int32));
+	FMemory::Memcpy(&UncompressedSize, FileData + PayloadOffset, sizeof(int32));
 
 	// Decompress payload
 	const int32 CompressedDataOffset = PayloadOffset + sizeof(int32);
-	const int32 CompressedSize = FileData.Num() - CompressedDataOffset;
+	const int32 CompressedSize = static_cast<int32>(FileSize - CompressedDataOffset);
 
 	TArray<uint8> PayloadBytes;
 	PayloadBytes.SetNum(UncompressedSize);
@@ -517,17 +676,18 @@ ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGa
 		NAME_LZ4,
 		PayloadBytes.GetData(),
 		UncompressedSize,
-		&FileData[CompressedDataOffset],
+		FileData + CompressedDataOffset,
 		CompressedSize))
 	{
 		return ELoadResult::FailedCorrupt;
 	}
 
 	// Validate checksum
-	bool bChecksumValid = ValidateChecksum(OutData.Header.Checksum, PayloadBytes);
+	bool bChecksumValid = ValidateChecksum(OutData.Header.Checksum, PayloadBytes.GetData(), PayloadBytes.Num());
 
 	// Deserialize payload
 	FMemoryReader PayloadReader(PayloadBytes);
+	SaveEncoding::SetFormatVersion(PayloadReader, SAVE_FORMAT_VERSION_LEGACY);
 
 	// Global state
 	PayloadReader << OutData.GlobalState.WorldTimeSeconds;
@@ -560,21 +720,177 @@ ELoadResult USEESaveGameSubsystem::ReadSaveFile(const FString& FilePath, FSaveGa
 	return bChecksumValid ? ELoadResult::Success : ELoadResult::SuccessModded;
 }
 
-void USEESaveGameSubsystem::PerformAsyncSave(FSaveGameData Data, FString FilePath, int32 SlotIndex)
+bool USEESaveGameSubsystem::RequestSave(ESaveSlotType SlotType, const FString& SlotName, int32 SlotIndex)
+{
+	// A newer autosave supersedes one still waiting: keep its slot, take the newer state.
+	// The old snapshot is dropped first so its car buffer can be reused in place.
+	bool bCoalesced = false;
+	int32 QueueIndex = INDEX_NONE;
+	FString QueuedSlotName;
+	FString QueuedFilePath;
+	int32 QueuedSlotIndex = INDEX_NONE;
+	if (bSaveInFlight)
+	{
+		QueueIndex = QueuedSaves.IndexOfByPredicate([SlotType, SlotIndex](const FQueuedSave& Queued)
+		{
+			return Queued.SlotIndex == SlotIndex ||
+				(SlotType == ESaveSlotType::Autosave && Queued.Snapshot.Header.SlotType == ESaveSlotType::Autosave);
+		});
+		if (QueueIndex != INDEX_NONE)
+		{
+			// Keep the queued save's slot before its snapshot (and header) is dropped
+			FQueuedSave& Queued = QueuedSaves[QueueIndex];
+			bCoalesced = Queued.SlotIndex != SlotIndex;
+			QueuedSlotName = MoveTemp(Queued.Snapshot.Header.SlotName);
+			QueuedFilePath = MoveTemp(Queued.FilePath);
+			QueuedSlotIndex = Queued.SlotIndex;
+			Queued.Snapshot = FSaveSnapshot();
+		}
+	}
+
+	FQueuedSave Save;
+	Save.Snapshot = PublishSnapshot();
+	Save.Snapshot.Header.SlotType = SlotType;
+	Save.Snapshot.Header.SlotName = SlotName;
+	Save.FilePath = GetSlotFilePath(SlotIndex);
+	Save.SlotIndex = SlotIndex;
+
+	if (QueueIndex != INDEX_NONE)
+	{
+		if (bCoalesced)
+		{
+			Save.SlotIndex = QueuedSlotIndex;
+			Save.FilePath = MoveTemp(QueuedFilePath);
+			Save.Snapshot.Header.SlotName = MoveTemp(QueuedSlotName);
+		}
+		QueuedSaves[QueueIndex] = MoveTemp(Save);
+	}
+	else if (bSaveInFlight)
+	{
+		QueuedSaves.Add(MoveTemp(Save));
+	}
+	else
+	{
+		LaunchSave(MoveTemp(Save));
+	}
+
+	return bCoalesced;
+}
+
+void USEESaveGameSubsystem::LaunchSave(FQueuedSave&& Save)
 {
-	// Run save on background thread
-	Async(EAsyncExecution::TaskGraph, [this, Data = MoveTemp(Data), FilePath = MoveTemp(FilePath), SlotIndex]()
+	bSaveInFlight = true;
+
+	// Overwriting the slot we lazily loaded from: stop reading pending chunks out of it first
+	LazyLoad.DetachFrom(Save.FilePath);
+
+	// The worker owns the snapshot and a reference to the store; it never touches the subsystem
+	Async(EAsyncExecution::TaskGraph,
+		[Store = ChunkStore, Save = MoveTemp(Save), WeakThis = TWeakObjectPtr<USEESaveGameSubsystem>(this)]()
 	{
-		ESaveResult Result = WriteSaveFile(Data, FilePath);
+		const ESaveResult Result = Store->Write(Save.Snapshot, Save.FilePath, &USEESaveGameSubsystem::SerializeHeader);
 
 		// Broadcast result on game thread
-		AsyncTask(ENamedThreads::GameThread, [this, Result, SlotIndex]()
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Result, SlotIndex = Save.SlotIndex]()
 		{
-			OnSaveComplete.Broadcast(Result, SlotIndex);
+			if (USEESaveGameSubsystem* This = WeakThis.Get())
+			{
+				This->OnSaveWritten(Result, SlotIndex);
+			}
 		});
 	});
 }
 
+void USEESaveGameSubsystem::OnSaveWritten(ESaveResult Result, int32 SlotIndex)
+{
+	bSaveInFlight = false;
+	SlotHeaderCache.Remove(SlotIndex);
+
+	if (QueuedSaves.Num() > 0)
+	{
+		FQueuedSave Next = MoveTemp(QueuedSaves[0]);
+		QueuedSaves.RemoveAt(0);
+		LaunchSave(MoveTemp(Next));
+	}
+
+	OnSaveComplete.Broadcast(Result, SlotIndex);
+}
+
+FSaveSnapshot USEESaveGameSubsystem::PublishSnapshot()
+{
+	FSaveSnapshot Snapshot;
+	Snapshot.Header.FormatVersion = SAVE_FORMAT_VERSION;
+	Snapshot.Header.GameVersion = FApp::GetBuildVersion();
+	Snapshot.Header.Timestamp = FDateTime::UtcNow();
+
+	// Patch whichever buffer no in-flight or queued save still reads
+	FCarSnapshotBuffer* Buffer = nullptr;
+	for (FCarSnapshotBuffer& Candidate : CarSnapshotBuffers)
+	{
+		if (!Candidate.Cars.IsValid() || Candidate.Cars.IsUnique())
+		{
+			Buffer = &Candidate;
+			break;
+		}
+	}
+
+	TSharedPtr<TArray<FSaveCarStateRef>, ESPMode::ThreadSafe> Cars;
+	if (!Buffer || Buffer->bNeedsRebuild || !Buffer->Cars.IsValid())
+	{
+		Cars = MakeShared<TArray<FSaveCarStateRef>, ESPMode::ThreadSafe>();
+		Cars->Reserve(CarStateCache.Num());
+
+		TMap<int32, int32> SlotByCar;
+		for (const TPair<int32, TSharedRef<FSaveCarState, ESPMode::ThreadSafe>>& Pair : CarStateCache)
+		{
+			SlotByCar.Add(Pair.Key, Cars->Add(Pair.Value));
+		}
+
+		if (Buffer)
+		{
+			Buffer->SlotByCar = MoveTemp(SlotByCar);
+			Buffer->bNeedsRebuild = false;
+		}
+	}
+	else
+	{
+		Cars = Buffer->Cars;
+		for (const int32 CarIndex : Buffer->DirtyCars)
+		{
+			const TSharedRef<FSaveCarState, ESPMode::ThreadSafe>* State = CarStateCache.Find(CarIndex);
+			if (!State)
+			{
+				continue;
+			}
+			if (const int32* Slot = Buffer->SlotByCar.Find(CarIndex))
+			{
+				(*Cars)[*Slot] = *State;
+			}
+			else
+			{
+				Buffer->SlotByCar.Add(CarIndex, Cars->Add(*State));
+			}
+		}
+	}
+
+	if (Buffer)
+	{
+		Buffer->Cars = Cars;
+		Buffer->DirtyCars.Reset();
+	}
+	Snapshot.Cars = Cars;
+
+	// NPCs decoded since the last load, plus chunks nobody has decoded yet
+	if (!PublishedNPCStates.IsValid() && ActiveSaveData.IsSet())
+	{
+		PublishedNPCStates = MakeShared<const TArray<FSaveNPCState>, ESPMode::ThreadSafe>(ActiveSaveData->NPCStates);
+	}
+	Snapshot.NPCStates = PublishedNPCStates;
+	LazyLoad.Pending.GenerateKeyArray(Snapshot.CarriedChunkIds);
+
+	return Snapshot;
+}
+
 // ============================================================================
 // Path Helpers
 // ============================================================================
@@ -636,7 +952,7 @@ int32 USEESaveGameSubsystem::GetSlotSubIndex(int32 AbsoluteSlotIndex) const
 // JSON Header
 // ============================================================================
 
-FString USEESaveGameSubsystem::SerializeHeader(const FSaveHeaderData& Header) const
+FString USEESaveGameSubsystem::SerializeHeader(const FSaveHeaderData& Header)
 {
 	TSharedRef<FJsonObject> JsonObj = MakeShared<FJsonObject>();
 
@@ -651,6 +967,8 @@ FString USEESaveGameSubsystem::SerializeHeader(const FSaveHeaderData& Header) co
 	JsonObj->SetNumberField(TEXT("completionPct"), Header.CompletionPercent);
 	JsonObj->SetStringField(TEXT("checksum"), Header.Checksum);
 	JsonObj->SetNumberField(TEXT("slotType"), static_cast<int32>(Header.SlotType));
+	JsonObj->SetNumberField(TEXT("chunkTable"), static_cast<double>(Header.ChunkTableOffset));
+	JsonObj->SetNumberField(TEXT("chunkTableSize"), Header.ChunkTableSize);
 
 	FString OutputString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -658,7 +976,7 @@ FString USEESaveGameSubsystem::SerializeHeader(const FSaveHeaderData& Header) co
 	return OutputString;
 }
 
-bool USEESaveGameSubsystem::DeserializeHeader(const FString& JsonStr, FSaveHeaderData& OutHeader) const
+bool USEESaveGameSubsystem::DeserializeHeader(const FString& JsonStr, FSaveHeaderData& OutHeader)
 {
 	TSharedPtr<FJsonObject> JsonObj;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonStr);
@@ -680,28 +998,87 @@ bool USEESaveGameSubsystem::DeserializeHeader(const FString& JsonStr, FSaveHeade
 	OutHeader.Checksum = JsonObj->GetStringField(TEXT("checksum"));
 	OutHeader.SlotType = static_cast<ESaveSlotType>(JsonObj->GetIntegerField(TEXT("slotType")));
 
+	// Absent in format 1 headers
+	JsonObj->TryGetNumberField(TEXT("chunkTable"), OutHeader.ChunkTableOffset);
+	JsonObj->TryGetNumberField(TEXT("chunkTableSize"), OutHeader.ChunkTableSize);
+
 	return true;
 }
 
+bool USEESaveGameSubsystem::ReadSlotHeader(const FString& FilePath, FSaveHeaderData& OutHeader) const
+{
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	const int64 FileSize = Handle->Size();
+	if (FileSize < SAVE_PREAMBLE_SIZE)
+	{
+		return false;
+	}
+
+	uint8 Preamble[SAVE_PREAMBLE_SIZE];
+	if (!Handle->Read(Preamble, SAVE_PREAMBLE_SIZE))
+	{
+		return false;
+	}
+
+	// Validate magic bytes
+	if (Preamble[0] != SAVE_MAGIC[0] || Preamble[1] != SAVE_MAGIC[1] ||
+		Preamble[2] != SAVE_MAGIC[2] || Preamble[3] != SAVE_MAGIC[3])
+	{
+		return false;
+	}
+
+	int32 Version = 0;
+	int32 HeaderLength = 0;
+	FMemory::Memcpy(&Version, &Preamble[4], sizeof(int32));
+	FMemory::Memcpy(&HeaderLength, &Preamble[8], sizeof(int32));
+
+	// Format 4 keeps the header after the chunk table; the preamble says where
+	int64 HeaderOffset = SAVE_PREAMBLE_SIZE;
+	if (Version >= SAVE_FORMAT_VERSION_TRAILING_HEADER)
+	{
+		if (FileSize < SAVE_PREAMBLE_SIZE_TRAILING ||
+			!Handle->Read(reinterpret_cast<uint8*>(&HeaderOffset), sizeof(int64)))
+		{
+			return false;
+		}
+	}
+
+	if (HeaderLength <= 0 || HeaderLength > SAVE_MAX_HEADER_SIZE ||
+		HeaderOffset < SAVE_PREAMBLE_SIZE || HeaderOffset + HeaderLength > FileSize ||
+		!Handle->Seek(HeaderOffset))
+	{
+		return false;
+	}
+
+	// Read just the header bytes — a few hundred bytes instead of the whole file
+	TArray<uint8> HeaderBytes;
+	HeaderBytes.SetNumUninitialized(HeaderLength);
+	if (!Handle->Read(HeaderBytes.GetData(), HeaderLength))
+	{
+		return false;
+	}
+
+	const auto Converter = FUTF8ToTCHAR(
+		reinterpret_cast<const ANSICHAR*>(HeaderBytes.GetData()), HeaderLength);
+	return DeserializeHeader(FString(Converter.Length(), Converter.Get()), OutHeader);
+}
+
 // ============================================================================
 // Checksum
 // ============================================================================
 
-FString USEESaveGameSubsystem::ComputePayloadChecksum(const TArray<uint8>& PayloadBytes) const
+FString USEESaveGameSubsystem::ComputePayloadChecksum(const uint8* PayloadBytes, int64 PayloadSize)
 {
-	FSHA256Signature Signature;
-	FSHA256::HashBuffer(PayloadBytes.GetData(), PayloadBytes.Num(), Signature.Signature);
-
-	FString Result;
-	for (int32 i = 0; i < 32; ++i)
-	{
-		Result += FString::Printf(TEXT("%02x"), Signature.Signature[i]);
-	}
-	return FString::Printf(TEXT("sha256:%s"), *Result);
+	return FSaveChunkStore::ComputeChecksum(PayloadBytes, PayloadSize);
 }
 
-bool USEESaveGameSubsystem::ValidateChecksum(const FString& Expected, const TArray<uint8>& PayloadBytes) const
+bool USEESaveGameSubsystem::ValidateChecksum(const FString& Expected, const uint8* PayloadBytes, int64 PayloadSize)
 {
-	const FString Computed = ComputePayloadChecksum(PayloadBytes);
+	const FString Computed = ComputePayloadChecksum(PayloadBytes, PayloadSize);
 	return Expected == Computed;
 }
@@ -5,19 +5,24 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "SaveTypes.h"
+#include "SaveChunkStore.h"
 #include "SaveGameSubsystem.generated.h"
 
 // ============================================================================
 // USEESaveGameSubsystem
 //
 // Game instance subsystem managing save/load operations.
-// Binary format with JSON header, LZ4-compressed payload.
+// Binary format with JSON header and LZ4-compressed payload chunks; only
+// chunks that changed since a slot was last written are appended to it.
 // Supports manual saves, quick saves, rotating autosaves.
 //
 // Autosave fires on: car transition, quest completion, companion recruitment,
 // major choice, timed interval, pre-combat — with a 60-second cooldown.
 //
-// Save/load is asynchronous; the game does not pause during autosave.
+// Save/load is asynchronous; the game does not pause during autosave. Each
+// save publishes an immutable snapshot that shares unchanged car states with
+// the cache, and only one write runs at a time: requests made meanwhile are
+// queued, with overlapping autosaves merged into one.
 // ============================================================================
 UCLASS()
 class TRAINGAME_API USEESaveGameSubsystem : public UGameInstanceSubsystem
@@ -68,9 +73,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Save")
 	bool IsSlotOccupied(int32 AbsoluteSlotIndex) const;
 
-	/** Delete a save slot. */
+	/** Delete a save slot. Returns false if the file exists but could not be deleted. */
 	UFUNCTION(BlueprintCallable, Category = "Save")
-	void DeleteSlot(int32 AbsoluteSlotIndex);
+	bool DeleteSlot(int32 AbsoluteSlotIndex);
 
 	// --- State Gathering ---
 
@@ -84,13 +89,17 @@ public:
 
 	// --- Per-Car State ---
 
-	/** Register a car's modified state for persistence. */
+	/** Register a car's modified state for persistence; its chunk is re-encoded on the next save. */
 	UFUNCTION(BlueprintCallable, Category = "Save|Car")
 	void MarkCarModified(int32 CarIndex);
 
-	/** Get the persisted delta for a car, or empty if unvisited. */
+	/** Get the persisted delta for a car, or empty if unvisited. Decodes the car on first access after a load. */
 	UFUNCTION(BlueprintCallable, Category = "Save|Car")
-	bool GetCarState(int32 CarIndex, FSaveCarState& OutState) const;
+	bool GetCarState(int32 CarIndex, FSaveCarState& OutState);
+
+	/** Get the saved state of every NPC currently in a car. Decodes them on first access after a load. */
+	UFUNCTION(BlueprintCallable, Category = "Save|Car")
+	void GetNPCStatesInCar(int32 CarIndex, TArray<FSaveNPCState>& OutStates);
 
 	/** Update a car's state delta (called when loot opened, door broken, NPC killed, etc). */
 	UFUNCTION(BlueprintCallable, Category = "Save|Car")
@@ -107,14 +116,22 @@ public:
 
 	// --- Mr. Wilford Permadeath ---
 
-	/** For Mr. Wilford difficulty: delete the save file on player death. */
+	/** For Mr. Wilford difficulty: delete the save file on player death. Returns false if any slot survived. */
 	UFUNCTION(BlueprintCallable, Category = "Save|Permadeath")
-	void DeletePermadeathSave();
+	bool DeletePermadeathSave();
 
 	/** Check if current save is a permadeath (Mr. Wilford) save. */
 	UFUNCTION(BlueprintPure, Category = "Save|Permadeath")
 	bool IsPermadeathSave() const;
 
+	// --- File Access ---
+
+	/** Read and decode a save file without applying it. With OutLazy, car and NPC chunks are left encoded in the mapped file. */
+	static ELoadResult ReadSaveFile(const FString& FilePath, FSaveGameData& OutData, FSaveLazyLoad* OutLazy = nullptr);
+
+	/** The JSON header written into every save file. */
+	static FString SerializeHeader(const FSaveHeaderData& Header);
+
 	// --- Delegates ---
 
 	UPROPERTY(BlueprintAssignable, Category = "Save")
@@ -134,27 +151,91 @@ protected:
 private:
 	// --- Internal Save/Load ---
 
-	ESaveResult WriteSaveFile(const FSaveGameData& Data, const FString& FilePath);
-	ELoadResult ReadSaveFile(const FString& FilePath, FSaveGameData& OutData);
+	// Format 1: one LZ4 block holding every section back to back
+	static ELoadResult ReadLegacyPayload(const uint8* FileData, int64 FileSize, int32 PayloadOffset, FSaveGameData& OutData);
+
+	// Read a slot and make it the active save; LoadFromSlot adds the completion broadcast
+	ELoadResult TryLoadSlot(int32 AbsoluteSlotIndex);
+
+	// Decode a car's chunk and its NPC chunk if they are still pending from a lazy load
+	void ResolveLazyCar(int32 CarIndex);
 
 	FString GetSlotFilePath(int32 AbsoluteSlotIndex) const;
 	FString GetSaveDirectory() const;
 	ESaveSlotType GetSlotType(int32 AbsoluteSlotIndex) const;
 	int32 GetSlotSubIndex(int32 AbsoluteSlotIndex) const;
 
-	// JSON header serialization
-	FString SerializeHeader(const FSaveHeaderData& Header) const;
-	bool DeserializeHeader(const FString& JsonStr, FSaveHeaderData& OutHeader) const;
+	// JSON header deserialization
+	static bool DeserializeHeader(const FString& JsonStr, FSaveHeaderData& OutHeader);
+
+	/** Read only the preamble and JSON header of a save file; the payload is never touched. */
+	bool ReadSlotHeader(const FString& FilePath, FSaveHeaderData& OutHeader) const;
 
 	// Checksum
-	FString ComputePayloadChecksum(const TArray<uint8>& PayloadBytes) const;
-	bool ValidateChecksum(const FString& Expected, const TArray<uint8>& PayloadBytes) const;
+	static FString ComputePayloadChecksum(const uint8* PayloadBytes, int64 PayloadSize);
+	static bool ValidateChecksum(const FString& Expected, const uint8* PayloadBytes, int64 PayloadSize);
+
+	// --- Async Save Pipeline ---
+
+	struct FQueuedSave
+	{
+		FSaveSnapshot Snapshot;
+		FString FilePath;
+		int32 SlotIndex = -1;
+	};
+
+	/** Snapshot current state and write it, or queue it behind the write in flight. Returns true if merged into a queued autosave. */
+	bool RequestSave(ESaveSlotType SlotType, const FString& SlotName, int32 SlotIndex);
+	void LaunchSave(FQueuedSave&& Save);
+	void OnSaveWritten(ESaveResult Result, int32 SlotIndex);
+
+	/** O(cars changed since this buffer was last published); unchanged cars are shared, not copied. */
+	FSaveSnapshot PublishSnapshot();
 
-	// Async save support
-	void PerformAsyncSave(FSaveGameData Data, FString FilePath, int32 SlotIndex);
+	// Copy-on-write access: a car still referenced by a snapshot is cloned before it is modified
+	FSaveCarState& EditCarState(int32 CarIndex);
+	void ReplaceCarState(FSaveCarState&& CarState);
+	void MarkCarDirty(int32 CarIndex);
 
 	// Per-car state cache (in-memory, flushed to save file)
-	TMap<int32, FSaveCarState> CarStateCache;
+	TMap<int32, TSharedRef<FSaveCarState, ESPMode::ThreadSafe>> CarStateCache;
+
+	// Two published car arrays, alternated so one can be patched in place while
+	// the other is still being written. Each tracks the cars changed since it was last published.
+	struct FCarSnapshotBuffer
+	{
+		TSharedPtr<TArray<FSaveCarStateRef>, ESPMode::ThreadSafe> Cars;
+		TMap<int32, int32> SlotByCar;
+		TSet<int32> DirtyCars;
+		bool bNeedsRebuild = true;
+	};
+	FCarSnapshotBuffer CarSnapshotBuffers[2];
+
+	// NPC states as last published; rebuilt only when lazily decoded NPCs are added
+	TSharedPtr<const TArray<FSaveNPCState>, ESPMode::ThreadSafe> PublishedNPCStates;
+
+	bool bSaveInFlight = false;
+	TArray<FQueuedSave> QueuedSaves;
+
+	// Source of FSaveCarState::SaveRevision; bumped on every car change
+	uint32 CarRevisionCounter = 0;
+
+	// Encoded chunks and per-slot append ledgers, shared by all save writes
+	TSharedRef<FSaveChunkStore, ESPMode::ThreadSafe> ChunkStore = MakeShared<FSaveChunkStore, ESPMode::ThreadSafe>();
+
+	// Car/NPC chunks of the last loaded save that nobody has asked for yet
+	FSaveLazyLoad LazyLoad;
+
+	// Slot header cache for the save/load UI. Keyed by file size + modification
+	// time so a slot is only re-read from disk after it has been rewritten.
+	struct FCachedSlotHeader
+	{
+		int64 FileSize = -1;
+		FDateTime ModificationTime;
+		bool bValid = false;
+		FSaveHeaderData Header;
+	};
+	mutable TMap<int32, FCachedSlotHeader> SlotHeaderCache;
 
 	// Autosave management
 	float AutosaveCooldownRemaining = 0.f;
@@ -0,0 +1,224 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "SaveTypes.h"
+#include "Serialization/CustomVersion.h"
+
+const FGuid FSaveFormatCustomVersion::GUID(0x5350EE00, 0x7B1A4C2D, 0x9E3F6A81, 0x2C4D5E6F);
+
+// ============================================================================
+// SaveEncoding
+// ============================================================================
+
+namespace SaveEncoding
+{
+	void SetFormatVersion(FArchive& Ar, int32 FormatVersion)
+	{
+		Ar.SetCustomVersion(FSaveFormatCustomVersion::GUID, FormatVersion, TEXT("SaveFormat"));
+	}
+
+	int32 GetFormatVersion(const FArchive& Ar)
+	{
+		const FCustomVersion* Version = Ar.GetCustomVersions().GetVersion(FSaveFormatCustomVersion::GUID);
+		return Version ? Version->Version : SAVE_FORMAT_VERSION;
+	}
+
+	void SerializeVarUInt(FArchive& Ar, uint32& Value)
+	{
+		if (Ar.IsLoading())
+		{
+			Value = 0;
+			for (int32 Shift = 0; Shift < 35; Shift += 7)
+			{
+				uint8 Byte = 0;
+				Ar << Byte;
+				Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0)
+				{
+					return;
+				}
+			}
+
+			// More than 5 bytes cannot come from a uint32
+			Ar.SetError();
+			return;
+		}
+
+		uint32 Remaining = Value;
+		do
+		{
+			uint8 Byte = Remaining & 0x7F;
+			Remaining >>= 7;
+			if (Remaining != 0)
+			{
+				Byte |= 0x80;
+			}
+			Ar << Byte;
+		}
+		while (Remaining != 0);
+	}
+
+	void SerializeInt(FArchive& Ar, int32& Value)
+	{
+		if (GetFormatVersion(Ar) < SAVE_FORMAT_VERSION_PACKED)
+		{
+			Ar << Value;
+			return;
+		}
+
+		// Zigzag keeps small negatives (-1 "unset" indices, negative rep) to one byte
+		uint32 Encoded = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+		SerializeVarUInt(Ar, Encoded);
+		Value = static_cast<int32>(Encoded >> 1) ^ -static_cast<int32>(Encoded & 1);
+	}
+
+	void SerializeIntArray(FArchive& Ar, TArray<int32>& Values)
+	{
+		if (GetFormatVersion(Ar) < SAVE_FORMAT_VERSION_PACKED)
+		{
+			Ar << Values;
+			return;
+		}
+
+		uint32 Count = Values.Num();
+		SerializeVarUInt(Ar, Count);
+
+		if (Ar.IsLoading())
+		{
+			// Every element takes at least a byte, so a count past the remaining bytes is corrupt
+			if (Ar.IsError() || (Ar.TotalSize() >= 0 && Count > static_cast<uint64>(Ar.TotalSize() - Ar.Tell())))
+			{
+				Ar.SetError();
+				return;
+			}
+			Values.SetNumUninitialized(Count);
+		}
+
+		for (int32& Value : Values)
+		{
+			SerializeInt(Ar, Value);
+		}
+	}
+}
+
+// ============================================================================
+// FSaveBitField
+// ============================================================================
+
+void FSaveBitField::SetNum(int32 InNumBits)
+{
+	InNumBits = FMath::Max(InNumBits, 0);
+	Words.SetNumZeroed((InNumBits + 31) >> 5);
+	NumBits = InNumBits;
+
+	// Clear bits past the new end so shrinking then growing never resurrects them
+	if ((NumBits & 31) != 0)
+	{
+		Words.Last() &= (1u << (NumBits & 31)) - 1;
+	}
+}
+
+void FSaveBitField::Set(int32 Index, bool bValue)
+{
+	if (Index < 0)
+	{
+		return;
+	}
+	if (Index >= NumBits)
+	{
+		if (!bValue)
+		{
+			return;
+		}
+		SetNum(Index + 1);
+	}
+
+	const uint32 Mask = 1u << (Index & 31);
+	if (bValue)
+	{
+		Words[Index >> 5] |= Mask;
+	}
+	else
+	{
+		Words[Index >> 5] &= ~Mask;
+	}
+}
+
+int32 FSaveBitField::CountSetBits() const
+{
+	int32 Count = 0;
+	for (const uint32 Word : Words)
+	{
+		Count += FPlatformMath::CountBits(Word);
+	}
+	return Count;
+}
+
+FArchive& operator<<(FArchive& Ar, FSaveBitField& Field)
+{
+	if (SaveEncoding::GetFormatVersion(Ar) < SAVE_FORMAT_VERSION_PACKED)
+	{
+		// Older formats wrote the flags as TArray<bool>
+		TArray<bool> Flags;
+		if (Ar.IsSaving())
+		{
+			Flags.SetNumUninitialized(Field.NumBits);
+			for (int32 i = 0; i < Field.NumBits; ++i)
+			{
+				Flags[i] = Field.Get(i);
+			}
+		}
+		Ar << Flags;
+		if (Ar.IsLoading())
+		{
+			Field.SetNum(Flags.Num());
+			for (int32 i = 0; i < Flags.Num(); ++i)
+			{
+				Field.Set(i, Flags[i]);
+			}
+		}
+		return Ar;
+	}
+
+	uint32 NumBits = Field.NumBits;
+	SaveEncoding::SerializeVarUInt(Ar, NumBits);
+
+	// Trailing zero bytes are implied, so sparse fields (few cars discovered yet) stay tiny
+	const uint32 MaxBytes = (NumBits + 7) >> 3;
+	uint32 NumBytes = 0;
+	if (Ar.IsSaving())
+	{
+		const uint8* Bytes = reinterpret_cast<const uint8*>(Field.Words.GetData());
+		NumBytes = MaxBytes;
+		while (NumBytes > 0 && Bytes[NumBytes - 1] == 0)
+		{
+			--NumBytes;
+		}
+	}
+	SaveEncoding::SerializeVarUInt(Ar, NumBytes);
+
+	if (Ar.IsLoading())
+	{
+		// Trailing zeros are implied, so only the stored bytes have to be present in the
+		// archive; the bit count itself is capped so a corrupt save cannot force a huge allocation
+		const int64 Remaining = Ar.TotalSize() >= 0 ? Ar.TotalSize() - Ar.Tell() : MAX_int64;
+		if (Ar.IsError() || NumBits > SAVE_MAX_BITFIELD_BITS || NumBytes > MaxBytes ||
+			static_cast<int64>(NumBytes) > Remaining)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+		// Start from empty so bytes the archive leaves implied never inherit the old contents
+		Field.Words.Reset();
+		Field.NumBits = 0;
+		Field.SetNum(static_cast<int32>(NumBits));
+	}
+
+	// Words are little-endian on every platform we ship, so the byte view is the bit order on disk
+	Ar.Serialize(Field.Words.GetData(), NumBytes);
+
+	if (Ar.IsLoading() && (NumBits & 31) != 0)
+	{
+		Field.Words.Last() &= (1u << (NumBits & 31)) - 1;
+	}
+	return Ar;
+}
@@ -9,12 +9,126 @@
 
 // ============================================================================
 // Save System Type Definitions
-// Binary format with JSON header (.sav), LZ4-compressed payload
+// Binary format with JSON header (.sav), LZ4-compressed payload chunks
 // ============================================================================
 
 // Magic bytes for save file validation
 inline constexpr uint8 SAVE_MAGIC[4] = { 'S', 'P', 'E', 'E' };
-inline constexpr int32 SAVE_FORMAT_VERSION = 1;
+
+// 1 = single LZ4 payload, 2 = per-section chunks with a chunk table,
+// 3 = bit-packed flag arrays and varint-encoded integers inside chunks,
+// 4 = JSON header written after the chunk table and located by the preamble
+inline constexpr int32 SAVE_FORMAT_VERSION = 4;
+inline constexpr int32 SAVE_FORMAT_VERSION_LEGACY = 1;
+inline constexpr int32 SAVE_FORMAT_VERSION_PACKED = 3;
+inline constexpr int32 SAVE_FORMAT_VERSION_TRAILING_HEADER = 4;
+
+// Fixed preamble: magic (4) + format version (4) + JSON header length (4)
+inline constexpr int32 SAVE_PREAMBLE_SIZE = 12;
+
+// Format 4 appends the header's file offset (8); chunk data starts right after.
+// The preamble is the last thing an append writes, in a single write at offset 0,
+// so replacing it is what commits the new chunks, table and header.
+inline constexpr int32 SAVE_PREAMBLE_SIZE_TRAILING = 20;
+
+// Sanity cap on the JSON header; anything larger is treated as corrupt
+inline constexpr int32 SAVE_MAX_HEADER_SIZE = 64 * 1024;
+
+// Formats 2-3 only: space reserved for the JSON header after the preamble.
+// Chunk data in those files starts after max(header, reserve).
+inline constexpr int32 SAVE_HEADER_RESERVE = 2048;
+
+// Sanity cap on a loaded FSaveBitField; the largest real one is a flag per car
+inline constexpr uint32 SAVE_MAX_BITFIELD_BITS = 1u << 20;
+
+// Appends to the same slot file before it is rewritten from scratch
+inline constexpr int32 SAVE_COMPACTION_INTERVAL = 8;
+
+/** Payload chunk kinds. Car and NPC chunks are keyed by car index; the rest use key 0. */
+enum class ESaveChunkType : uint8
+{
+	Global		= 0,
+	Player		= 1,
+	Car			= 2,
+	NPCs		= 3,
+	Quests		= 4,
+	Companions	= 5
+};
+
+// ============================================================================
+// Compact Encoding
+//
+// Struct serializers read the save format version from the archive's custom
+// version, so the same operator<< reads every format. Archives that never had
+// it set are treated as the current format.
+// ============================================================================
+
+struct TRAINGAME_API FSaveFormatCustomVersion
+{
+	static const FGuid GUID;
+};
+
+namespace SaveEncoding
+{
+	/** Tag Ar with the save format version its bytes are (or will be) in. */
+	TRAINGAME_API void SetFormatVersion(FArchive& Ar, int32 FormatVersion);
+	TRAINGAME_API int32 GetFormatVersion(const FArchive& Ar);
+
+	/** LEB128 varint: 1 byte below 128, at most 5. */
+	TRAINGAME_API void SerializeVarUInt(FArchive& Ar, uint32& Value);
+
+	/** Zigzag varint in packed formats, raw 4 bytes before them. */
+	TRAINGAME_API void SerializeInt(FArchive& Ar, int32& Value);
+
+	/** Varint count then SerializeInt per element in packed formats, plain TArray serialization before them. */
+	TRAINGAME_API void SerializeIntArray(FArchive& Ar, TArray<int32>& Values);
+}
+
+/**
+ * Fixed-size flag array stored one bit per flag, in memory and on disk.
+ * Replaces TArray<bool>, which costs a byte per flag in both.
+ */
+USTRUCT(BlueprintType)
+struct TRAINGAME_API FSaveBitField
+{
+	GENERATED_BODY()
+
+	FSaveBitField() = default;
+	explicit FSaveBitField(int32 InNumBits) { SetNum(InNumBits); }
+
+	int32 Num() const { return NumBits; }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < NumBits; }
+
+	/** Resize; new bits start cleared, and shrinking clears the dropped bits so growing again never brings them back. */
+	void SetNum(int32 InNumBits);
+
+	/** Out-of-range reads return false. */
+	bool Get(int32 Index) const
+	{
+		return IsValidIndex(Index) && (Words[Index >> 5] & (1u << (Index & 31))) != 0;
+	}
+
+	/** Grows the field if Index is past the end. */
+	void Set(int32 Index, bool bValue);
+
+	int32 CountSetBits() const;
+
+	SIZE_T GetAllocatedSize() const { return Words.GetAllocatedSize(); }
+
+	bool operator==(const FSaveBitField& Other) const { return NumBits == Other.NumBits && Words == Other.Words; }
+	bool operator!=(const FSaveBitField& Other) const { return !(*this == Other); }
+
+	/** Packed: varint bit count, varint byte count, then bytes up to the last non-zero one. Before: TArray<bool>. */
+	friend TRAINGAME_API FArchive& operator<<(FArchive& Ar, FSaveBitField& Field);
+
+private:
+	// Bits beyond NumBits in the last word are always zero
+	UPROPERTY()
+	TArray<uint32> Words;
+
+	UPROPERTY()
+	int32 NumBits = 0;
+};
 
 UENUM(BlueprintType)
 enum class ESaveSlotType : uint8
@@ -103,6 +217,10 @@ struct FSaveHeaderData
 
 	UPROPERTY(BlueprintReadWrite)
 	ESaveSlotType SlotType = ESaveSlotType::Manual;
+
+	// Chunk table location, relative to the start of chunk data (format 2+)
+	int64 ChunkTableOffset = 0;
+	int32 ChunkTableSize = 0;
 };
 
 /** Global state — world time, difficulty, story flags, faction rep */
@@ -121,13 +239,13 @@ struct FSaveGlobalState
 	bool bAdaptiveDifficultyEnabled = false;
 
 	UPROPERTY(BlueprintReadWrite)
-	TArray<bool> RevolutionFlags;
+	FSaveBitField RevolutionFlags;
 
 	UPROPERTY(BlueprintReadWrite)
 	TArray<int32> FactionReputations; // 8 factions, -1000 to +1000
 
 	UPROPERTY(BlueprintReadWrite)
-	TArray<bool> DiscoveredCars; // bitfield: which cars visited
+	FSaveBitField DiscoveredCars; // which cars visited
 
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FName> GlobalEventLog;
@@ -138,6 +256,70 @@ struct FSaveGlobalState
 		FactionReputations.SetNumZeroed(8);
 		DiscoveredCars.SetNum(128);
 	}
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveGlobalState& State)
+	{
+		Ar << State.WorldTimeSeconds;
+		Ar << State.DifficultyTier;
+		Ar << State.bAdaptiveDifficultyEnabled;
+		Ar << State.RevolutionFlags;
+		SaveEncoding::SerializeIntArray(Ar, State.FactionReputations);
+		Ar << State.DiscoveredCars;
+		Ar << State.GlobalEventLog;
+		return Ar;
+	}
+};
+
+/** A single inventory item in save data */
+USTRUCT(BlueprintType)
+struct FSaveItemEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite)
+	FName ItemID = NAME_None;
+
+	UPROPERTY(BlueprintReadWrite)
+	int32 StackCount = 1;
+
+	UPROPERTY(BlueprintReadWrite)
+	float Durability = 1.0f;
+
+	UPROPERTY(BlueprintReadWrite)
+	float DegradationProgress = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveItemEntry& Item)
+	{
+		Ar << Item.ItemID;
+		SaveEncoding::SerializeInt(Ar, Item.StackCount);
+		Ar << Item.Durability;
+		Ar << Item.DegradationProgress;
+		return Ar;
+	}
+};
+
+/** An active buff/debuff in save data */
+USTRUCT(BlueprintType)
+struct FSaveActiveEffect
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite)
+	FName EffectID = NAME_None;
+
+	UPROPERTY(BlueprintReadWrite)
+	float RemainingDuration = 0.f;
+
+	UPROPERTY(BlueprintReadWrite)
+	float Intensity = 1.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveActiveEffect& Effect)
+	{
+		Ar << Effect.EffectID;
+		Ar << Effect.RemainingDuration;
+		Ar << Effect.Intensity;
+		return Ar;
+	}
 };
 
 /** Player state — position, stats, inventory, equipment, effects */
@@ -191,41 +373,63 @@ struct FSavePlayerState
 	{
 		Stats.SetNumZeroed(6);
 	}
+
+	friend FArchive& operator<<(FArchive& Ar, FSavePlayerState& State)
+	{
+		Ar << State.Position;
+		Ar << State.Rotation;
+		SaveEncoding::SerializeInt(Ar, State.CurrentCarIndex);
+		Ar << State.Stats;
+		Ar << State.Level;
+		SaveEncoding::SerializeInt(Ar, State.XP);
+
+		FSurvivalSnapshot& Survival = State.SurvivalState;
+		Ar << Survival.Hunger;
+		Ar << Survival.Cold;
+		Ar << Survival.Morale;
+		Ar << Survival.Health;
+		Ar << Survival.Stamina;
+		Ar << Survival.KronoleAddictionLevel;
+		Ar << Survival.TimeSinceLastKronoleDose;
+		Ar << Survival.Influence;
+		Ar << Survival.Scrap;
+
+		Ar << State.InventoryItems;
+		Ar << State.ActivePerks;
+		Ar << State.ActiveEffects;
+		Ar << State.EquippedWeaponID;
+		Ar << State.EquippedArmorID;
+		Ar << State.ActiveDisguiseID;
+		return Ar;
+	}
 };
 
-/** A single inventory item in save data */
+/** NPC override within a car's delta state */
 USTRUCT(BlueprintType)
-struct FSaveItemEntry
+struct FSaveNPCOverride
 {
 	GENERATED_BODY()
 
 	UPROPERTY(BlueprintReadWrite)
-	FName ItemID = NAME_None;
-
-	UPROPERTY(BlueprintReadWrite)
-	int32 StackCount = 1;
-
-	UPROPERTY(BlueprintReadWrite)
-	float Durability = 1.0f;
+	FName NPCID = NAME_None;
 
 	UPROPERTY(BlueprintReadWrite)
-	float DegradationProgress = 0.f;
-};
-
-/** An active buff/debuff in save data */
-USTRUCT(BlueprintType)
-struct FSaveActiveEffect
-{
-	GENERATED_BODY()
+	bool bDead = false;
 
 	UPROPERTY(BlueprintReadWrite)
-	FName EffectID = NAME_None;
+	bool bAlerted = false;
 
 	UPROPERTY(BlueprintReadWrite)
-	float RemainingDuration = 0.f;
+	int32 OverrideCarIndex = -1; // -1 = default position
 
-	UPROPERTY(BlueprintReadWrite)
-	float Intensity = 1.f;
+	friend FArchive& operator<<(FArchive& Ar, FSaveNPCOverride& Override)
+	{
+		Ar << Override.NPCID;
+		Ar << Override.bDead;
+		Ar << Override.bAlerted;
+		SaveEncoding::SerializeInt(Ar, Override.OverrideCarIndex);
+		return Ar;
+	}
 };
 
 /** Per-car state delta — only modified cars are stored */
@@ -237,17 +441,17 @@ struct FSaveCarState
 	UPROPERTY(BlueprintReadWrite)
 	int32 CarIndex = 0;
 
-	// Bitfield: which containers looted
+	// Which containers looted
 	UPROPERTY(BlueprintReadWrite)
-	TArray<bool> LootedContainers;
+	FSaveBitField LootedContainers;
 
 	// Per-door state: 0=default, 1=open, 2=locked, 3=broken
 	UPROPERTY(BlueprintReadWrite)
 	TArray<uint8> DoorStates;
 
-	// Bitfield: which destructibles destroyed
+	// Which destructibles destroyed
 	UPROPERTY(BlueprintReadWrite)
-	TArray<bool> DestroyedDestructibles;
+	FSaveBitField DestroyedDestructibles;
 
 	// NPC overrides for this car (dead, moved, alerted)
 	UPROPERTY(BlueprintReadWrite)
@@ -264,25 +468,23 @@ struct FSaveCarState
 	// Faction that currently controls this car
 	UPROPERTY(BlueprintReadWrite)
 	FName ControllingFaction = NAME_None;
-};
-
-/** NPC override within a car's delta state */
-USTRUCT(BlueprintType)
-struct FSaveNPCOverride
-{
-	GENERATED_BODY()
-
-	UPROPERTY(BlueprintReadWrite)
-	FName NPCID = NAME_None;
-
-	UPROPERTY(BlueprintReadWrite)
-	bool bDead = false;
 
-	UPROPERTY(BlueprintReadWrite)
-	bool bAlerted = false;
+	// Bumped by the save subsystem on every change; lets the chunk writer skip
+	// re-encoding cars that have not changed since the last save. Not serialized.
+	uint32 SaveRevision = 0;
 
-	UPROPERTY(BlueprintReadWrite)
-	int32 OverrideCarIndex = -1; // -1 = default position
+	friend FArchive& operator<<(FArchive& Ar, FSaveCarState& State)
+	{
+		SaveEncoding::SerializeInt(Ar, State.CarIndex);
+		Ar << State.LootedContainers;
+		Ar << State.DoorStates;
+		Ar << State.DestroyedDestructibles;
+		Ar << State.NPCOverrides;
+		Ar << State.ClutterSeed;
+		Ar << State.CustomFlags;
+		Ar << State.ControllingFaction;
+		return Ar;
+	}
 };
 
 /** Global NPC state — tracked independently from per-car */
@@ -311,6 +513,18 @@ struct FSaveNPCState
 
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FName> SeenDialogueNodes;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveNPCState& State)
+	{
+		Ar << State.NPCID;
+		Ar << State.bAlive;
+		SaveEncoding::SerializeInt(Ar, State.CurrentCarIndex);
+		SaveEncoding::SerializeInt(Ar, State.Disposition);
+		Ar << State.MemoryTags;
+		Ar << State.ActiveSchedule;
+		Ar << State.SeenDialogueNodes;
+		return Ar;
+	}
 };
 
 /** Quest state */
@@ -330,10 +544,20 @@ struct FSaveQuestState
 	int32 CurrentStep = 0;
 
 	UPROPERTY(BlueprintReadWrite)
-	TArray<bool> StepFlags;
+	FSaveBitField StepFlags;
 
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FName> RecordedChoices;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveQuestState& State)
+	{
+		Ar << State.QuestID;
+		Ar << State.Status;
+		SaveEncoding::SerializeInt(Ar, State.CurrentStep);
+		Ar << State.StepFlags;
+		Ar << State.RecordedChoices;
+		return Ar;
+	}
 };
 
 /** Companion state */
@@ -370,6 +594,20 @@ struct FSaveCompanionState
 
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FName> GiftHistory;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveCompanionState& State)
+	{
+		Ar << State.CompanionIndex;
+		Ar << State.bRecruited;
+		Ar << State.bAlive;
+		SaveEncoding::SerializeInt(Ar, State.Loyalty);
+		Ar << State.InternalState;
+		Ar << State.bInParty;
+		SaveEncoding::SerializeInt(Ar, State.PersonalQuestStep);
+		Ar << State.RomanceState;
+		Ar << State.GiftHistory;
+		return Ar;
+	}
 };
 
 /** Complete save data — all sections combined */
@@ -398,6 +636,10 @@ struct FSaveGameData
 
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FSaveCompanionState> CompanionStates;
+
+	// Chunks from a lazily loaded file that have not been decoded yet.
+	// The chunk writer carries them over byte-for-byte instead of re-encoding.
+	TArray<uint64> CarriedChunkIds;
 };
 
 /** Slot info displayed in the save/load UI without full deserialization */
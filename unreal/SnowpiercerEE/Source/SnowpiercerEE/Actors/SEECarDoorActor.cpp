@@ -0,0 +1,73 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "SEECarDoorActor.h"
+#include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/Pawn.h"
+#include "SEECarStreamingSubsystem.h"
+
+ASEECarDoorActor::ASEECarDoorActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	DoorMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("DoorMesh"));
+	SetRootComponent(DoorMesh);
+
+	ApproachVolume = CreateDefaultSubobject<UBoxComponent>(TEXT("ApproachVolume"));
+	ApproachVolume->SetupAttachment(DoorMesh);
+	ApproachVolume->InitBoxExtent(FVector(400.0f, 150.0f, 150.0f));
+	ApproachVolume->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	ApproachVolume->SetCollisionResponseToAllChannels(ECR_Ignore);
+	ApproachVolume->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	ApproachVolume->OnComponentBeginOverlap.AddDynamic(this, &ASEECarDoorActor::HandleApproachBegin);
+}
+
+int32 ASEECarDoorActor::GetTargetCarIndex() const
+{
+	const USEECarStreamingSubsystem* Streaming = GetWorld() ? GetWorld()->GetSubsystem<USEECarStreamingSubsystem>() : nullptr;
+	if (!Streaming)
+	{
+		return INDEX_NONE;
+	}
+
+	return Streaming->GetCurrentCarIndex() == CarIndex ? CarIndex + 1 : CarIndex;
+}
+
+void ASEECarDoorActor::OpenDoor(AActor* Opener)
+{
+	// Usually already sent by the approach volume; the streamer ignores repeats
+	NotifyApproach();
+	OnDoorOpened(Opener);
+}
+
+void ASEECarDoorActor::HandleApproachBegin(
+	UPrimitiveComponent* OverlappedComponent,
+	AActor* OtherActor,
+	UPrimitiveComponent* OtherComp,
+	int32 OtherBodyIndex,
+	bool bFromSweep,
+	const FHitResult& SweepResult)
+{
+	const APawn* Pawn = Cast<APawn>(OtherActor);
+	if (!Pawn || !Pawn->IsPlayerControlled())
+	{
+		return;
+	}
+
+	NotifyApproach();
+}
+
+void ASEECarDoorActor::NotifyApproach() const
+{
+	USEECarStreamingSubsystem* Streaming = GetWorld() ? GetWorld()->GetSubsystem<USEECarStreamingSubsystem>() : nullptr;
+	if (!Streaming)
+	{
+		return;
+	}
+
+	const int32 TargetCarIndex = GetTargetCarIndex();
+	if (TargetCarIndex != Streaming->GetCurrentCarIndex())
+	{
+		Streaming->NotifyDoorApproach(TargetCarIndex);
+	}
+}
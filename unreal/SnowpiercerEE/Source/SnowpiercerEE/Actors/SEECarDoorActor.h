@@ -0,0 +1,59 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SEECarDoorActor.generated.h"
+
+class UBoxComponent;
+class UPrimitiveComponent;
+class UStaticMeshComponent;
+
+/**
+ * Door between two cars. Walking into the approach volume, or interacting
+ * with the door, tells the car streaming subsystem which car is next so its
+ * sublevel is already loading before the door animation and load mask start.
+ */
+UCLASS(Blueprintable)
+class SNOWPIERCEREE_API ASEECarDoorActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASEECarDoorActor();
+
+	/** Car on the far side of the door from the player's current car */
+	UFUNCTION(BlueprintPure, Category = "Door")
+	int32 GetTargetCarIndex() const;
+
+	/** Prefetch the far car, then play the door animation */
+	UFUNCTION(BlueprintCallable, Category = "Door")
+	void OpenDoor(AActor* Opener);
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Door")
+	void OnDoorOpened(AActor* Opener);
+
+protected:
+	UFUNCTION()
+	void HandleApproachBegin(
+		UPrimitiveComponent* OverlappedComponent,
+		AActor* OtherActor,
+		UPrimitiveComponent* OtherComp,
+		int32 OtherBodyIndex,
+		bool bFromSweep,
+		const FHitResult& SweepResult);
+
+	void NotifyApproach() const;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UStaticMeshComponent> DoorMesh;
+
+	/** Should reach far enough ahead of the door to cover the car's load time */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UBoxComponent> ApproachVolume;
+
+	/** Car on the tail side of the door; the door leads into CarIndex + 1 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Door")
+	int32 CarIndex = 0;
+};
@@ -2,6 +2,7 @@
 
 #include "SEECombatAIController.h"
 #include "SnowpiercerEE/SEECombatComponent.h"
+#include "TrainGame/AI/PawnQuerySubsystem.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Navigation/PathFollowingComponent.h"
@@ -18,6 +19,21 @@ void ASEECombatAIController::OnPossess(APawn* InPawn)
 
 	CombatComp = InPawn->FindComponentByClass<USEECombatComponent>();
 	ApplyProfileModifiers();
+
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->RegisterPawn(InPawn, EPawnQueryTag::Combatant);
+	}
+}
+
+void ASEECombatAIController::OnUnPossess()
+{
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->UnregisterPawn(GetPawn(), EPawnQueryTag::Combatant);
+	}
+
+	Super::OnUnPossess();
 }
 
 void ASEECombatAIController::Tick(float DeltaTime)
@@ -150,22 +166,16 @@ int32 ASEECombatAIController::GetEngagingAICount() const
 {
 	if (!CurrentTarget) return 0;
 
-	int32 Count = 0;
-	TArray<AActor*> AllPawns;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), AllPawns);
-
-	for (AActor* Actor : AllPawns)
-	{
-		if (Actor == GetPawn()) continue;
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery) return 0;
 
-		APawn* OtherPawn = Cast<APawn>(Actor);
-		if (!OtherPawn) continue;
+	TArray<APawn*> NearbyPawns;
+	PawnQuery->QueryRadius(CurrentTarget->GetActorLocation(), PreferredCombatRange * 1.5f, EPawnQueryTag::Combatant, NearbyPawns, GetPawn());
 
-		ASEECombatAIController* OtherAI = Cast<ASEECombatAIController>(OtherPawn->GetController());
-		if (!OtherAI) continue;
-
-		float Dist = FVector::Dist(OtherPawn->GetActorLocation(), CurrentTarget->GetActorLocation());
-		if (Dist <= PreferredCombatRange * 1.5f)
+	int32 Count = 0;
+	for (APawn* OtherPawn : NearbyPawns)
+	{
+		if (Cast<ASEECombatAIController>(OtherPawn->GetController()))
 		{
 			Count++;
 		}
@@ -46,6 +46,7 @@ public:
 	ASEECombatAIController();
 
 	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
 	virtual void Tick(float DeltaTime) override;
 
 protected:
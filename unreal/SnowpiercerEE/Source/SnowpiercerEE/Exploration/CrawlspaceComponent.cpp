@@ -1,5 +1,5 @@
 #include "CrawlspaceComponent.h"
-#include "EngineUtils.h"
+#include "TrainGame/Stealth/NoisePropagationSubsystem.h"
 
 UCrawlspaceComponent::UCrawlspaceComponent()
 {
@@ -134,23 +134,19 @@ void UCrawlspaceComponent::GenerateNoise(float Radius)
 {
     if (Radius <= 0.0f) return;
 
-    // Alert nearby NPCs within noise radius
     AActor* Owner = GetOwner();
     if (!Owner) return;
 
-    TArray<AActor*> OverlappingActors;
-    // Use a simple distance check for NPCs in range
-    for (TActorIterator<APawn> It(GetWorld()); It; ++It)
-    {
-        APawn* NPC = *It;
-        if (NPC == Owner) continue;
+    UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>();
+    if (!Noise) return;
 
-        float Dist = FVector::Dist(Owner->GetActorLocation(), NPC->GetActorLocation());
-        if (Dist <= Radius * 100.0f) // Convert meters to cm
-        {
-            // NPC detection system will handle the alert via hearing range
-        }
-    }
+    // The noise bus finds listeners in range and applies masking and bulkheads
+    FNoiseEvent Event;
+    Event.Origin = Owner->GetActorLocation();
+    Event.Radius = Radius * 100.0f; // Meters to cm
+    Event.Intensity = ESoundIntensity::High; // Only raised by a failed crossing
+    Event.Instigator = Owner;
+    Noise->ReportNoise(Event);
 }
 
 void UCrawlspaceComponent::UpdateCarTracking()
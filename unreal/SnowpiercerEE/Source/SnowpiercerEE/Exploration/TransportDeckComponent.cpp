@@ -1,5 +1,5 @@
 #include "TransportDeckComponent.h"
-#include "EngineUtils.h"
+#include "TrainGame/Stealth/NoisePropagationSubsystem.h"
 
 UTransportDeckComponent::UTransportDeckComponent()
 {
@@ -247,18 +247,16 @@ void UTransportDeckComponent::GenerateNoise(float Radius)
 	AActor* Owner = GetOwner();
 	if (!Owner) return;
 
-	// Alert nearby NPCs within noise radius (same pattern as CrawlspaceComponent)
-	for (TActorIterator<APawn> It(GetWorld()); It; ++It)
-	{
-		APawn* NPC = *It;
-		if (NPC == Owner) continue;
+	UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>();
+	if (!Noise) return;
 
-		float Dist = FVector::Dist(Owner->GetActorLocation(), NPC->GetActorLocation());
-		if (Dist <= Radius * 100.0f) // meters to cm
-		{
-			// NPC AI detection system handles the alert via hearing
-		}
-	}
+	// Routed through the noise bus, same as CrawlspaceComponent
+	FNoiseEvent Event;
+	Event.Origin = Owner->GetActorLocation();
+	Event.Radius = Radius * 100.0f; // meters to cm
+	Event.Intensity = ESoundIntensity::Medium;
+	Event.Instigator = Owner;
+	Noise->ReportNoise(Event);
 }
 
 void UTransportDeckComponent::TriggerSecurity(EDeckSecurityType Device)
@@ -0,0 +1,245 @@
+#include "SkillTreeBenchmark.h"
+#include "SkillTreeComponent.h"
+#include "SEEStatsComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+namespace SkillLookupBenchmark
+{
+	// ========================================================================
+	// Reference
+	// ========================================================================
+
+	// The per-query walks USEESkillTreeComponent made before its modifier table
+
+	static float LinearEffectBonus(const TArray<FSEESkillNode>& Nodes, const TArray<FSEEPerk>& Perks,
+		const TSet<FName>& Unlocked, const TSet<FName>& Active, ESkillNodeEffect EffectType, FName OptionalStat)
+	{
+		float Total = 0.0f;
+		for (const FSEESkillNode& Node : Nodes)
+		{
+			if (Node.EffectType == EffectType && Unlocked.Contains(Node.NodeID)
+				&& (OptionalStat == NAME_None || Node.AffectedStat == OptionalStat))
+			{
+				Total += Node.EffectValue;
+			}
+		}
+		for (const FSEEPerk& Perk : Perks)
+		{
+			if (Perk.EffectType == EffectType && Active.Contains(Perk.PerkID)
+				&& (OptionalStat == NAME_None || Perk.AffectedStat == OptionalStat))
+			{
+				Total += Perk.EffectValue;
+			}
+		}
+		return Total;
+	}
+
+	static bool LinearHasAbility(const TArray<FSEESkillNode>& Nodes, const TArray<FSEEPerk>& Perks,
+		const TSet<FName>& Unlocked, const TSet<FName>& Active, FName AbilityTag)
+	{
+		for (const FSEESkillNode& Node : Nodes)
+		{
+			if (Node.UnlockTag == AbilityTag && Unlocked.Contains(Node.NodeID))
+			{
+				return true;
+			}
+		}
+		for (const FSEEPerk& Perk : Perks)
+		{
+			if (Perk.AffectedStat == AbilityTag && Active.Contains(Perk.PerkID))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// ========================================================================
+	// Measurement
+	// ========================================================================
+
+	static double PerSecond(int64 Count, double StartSeconds)
+	{
+		const double Elapsed = FPlatformTime::Seconds() - StartSeconds;
+		return Elapsed > 0.0 ? Count / Elapsed : 0.0;
+	}
+
+	FLookupReport MeasureLookups(const USEESkillTreeComponent& SkillTree, const USEEStatsComponent* Stats, int32 Iterations)
+	{
+		const TArray<FSEESkillNode>& Nodes = SkillTree.GetAllNodes();
+		const TArray<FSEEPerk>& Perks = SkillTree.GetAllPerks();
+
+		TSet<FName> Unlocked;
+		TSet<FName> Active;
+		TArray<TPair<ESkillNodeEffect, FName>> EffectQueries;
+		TArray<FName> AbilityQueries;
+		for (int32 Effect = 0; Effect < NumSkillNodeEffects; ++Effect)
+		{
+			EffectQueries.Add({ static_cast<ESkillNodeEffect>(Effect), NAME_None });
+		}
+		for (const FSEESkillNode& Node : Nodes)
+		{
+			if (SkillTree.IsNodeUnlocked(Node.NodeID))
+			{
+				Unlocked.Add(Node.NodeID);
+			}
+			EffectQueries.AddUnique({ Node.EffectType, Node.AffectedStat });
+			AbilityQueries.AddUnique(Node.UnlockTag);
+		}
+		for (const FSEEPerk& Perk : Perks)
+		{
+			if (SkillTree.IsPerkActive(Perk.PerkID))
+			{
+				Active.Add(Perk.PerkID);
+			}
+			EffectQueries.AddUnique({ Perk.EffectType, Perk.AffectedStat });
+			AbilityQueries.AddUnique(Perk.AffectedStat);
+		}
+		AbilityQueries.Add(TEXT("Ability_NotInAnyTree"));
+
+		FLookupReport Report;
+		Report.NumQueries = EffectQueries.Num() + AbilityQueries.Num() + NumSEEStats;
+
+		for (const TPair<ESkillNodeEffect, FName>& Query : EffectQueries)
+		{
+			if (LinearEffectBonus(Nodes, Perks, Unlocked, Active, Query.Key, Query.Value)
+				!= SkillTree.GetTotalEffectBonus(Query.Key, Query.Value))
+			{
+				UE_LOG(LogTemp, Error, TEXT("SkillLookupBenchmark: effect %d / %s differs"), static_cast<int32>(Query.Key), *Query.Value.ToString());
+				Report.Mismatches++;
+			}
+		}
+		for (const FName& Tag : AbilityQueries)
+		{
+			if (LinearHasAbility(Nodes, Perks, Unlocked, Active, Tag) != SkillTree.HasUnlockedAbility(Tag))
+			{
+				UE_LOG(LogTemp, Error, TEXT("SkillLookupBenchmark: ability %s differs"), *Tag.ToString());
+				Report.Mismatches++;
+			}
+		}
+
+		// Keeps the optimizer from discarding the loops
+		double Sink = 0.0;
+		const int64 EffectCount = static_cast<int64>(Iterations) * EffectQueries.Num();
+		const int64 AbilityCount = static_cast<int64>(Iterations) * AbilityQueries.Num();
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			for (const TPair<ESkillNodeEffect, FName>& Query : EffectQueries)
+			{
+				Sink += LinearEffectBonus(Nodes, Perks, Unlocked, Active, Query.Key, Query.Value);
+			}
+		}
+		Report.LinearEffectPerSec = PerSecond(EffectCount, Start);
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			for (const TPair<ESkillNodeEffect, FName>& Query : EffectQueries)
+			{
+				Sink += SkillTree.GetTotalEffectBonus(Query.Key, Query.Value);
+			}
+		}
+		Report.CompiledEffectPerSec = PerSecond(EffectCount, Start);
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			for (const FName& Tag : AbilityQueries)
+			{
+				Sink += LinearHasAbility(Nodes, Perks, Unlocked, Active, Tag) ? 1.0 : 0.0;
+			}
+		}
+		Report.LinearAbilityPerSec = PerSecond(AbilityCount, Start);
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			for (const FName& Tag : AbilityQueries)
+			{
+				Sink += SkillTree.HasUnlockedAbility(Tag) ? 1.0 : 0.0;
+			}
+		}
+		Report.CompiledAbilityPerSec = PerSecond(AbilityCount, Start);
+
+		if (Stats)
+		{
+			// Base and modifier maps shaped like the component's, read the way GetStat used to
+			TMap<ESEEStat, int32> BaseStats;
+			TMap<ESEEStat, int32> StatModifiers;
+			for (int32 Stat = 0; Stat < NumSEEStats; ++Stat)
+			{
+				BaseStats.Add(static_cast<ESEEStat>(Stat), Stats->GetStat(static_cast<ESEEStat>(Stat)));
+				StatModifiers.Add(static_cast<ESEEStat>(Stat), 0);
+			}
+
+			const int64 StatCount = static_cast<int64>(Iterations) * NumSEEStats;
+
+			Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				for (int32 Index = 0; Index < NumSEEStats; ++Index)
+				{
+					const ESEEStat Stat = static_cast<ESEEStat>(Index);
+					const int32 Base = BaseStats.Contains(Stat) ? BaseStats[Stat] : 5;
+					const int32 Mod = StatModifiers.Contains(Stat) ? StatModifiers[Stat] : 0;
+					Sink += FMath::Clamp(Base + Mod, 1, 10);
+				}
+			}
+			Report.MapStatPerSec = PerSecond(StatCount, Start);
+
+			Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				for (int32 Index = 0; Index < NumSEEStats; ++Index)
+				{
+					Sink += Stats->GetStat(static_cast<ESEEStat>(Index));
+				}
+			}
+			Report.CachedStatPerSec = PerSecond(StatCount, Start);
+		}
+
+		UE_LOG(LogTemp, Verbose, TEXT("SkillLookupBenchmark: checksum %f"), Sink);
+		return Report;
+	}
+
+	void LogLookupReport(const FLookupReport& Report)
+	{
+		auto LogRow = [](const TCHAR* Label, double Before, double After)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %-14s %12.0f/s -> %12.0f/s (x%.1f)"),
+				Label, Before, After, Before > 0.0 ? After / Before : 0.0);
+		};
+
+		UE_LOG(LogTemp, Display, TEXT("SkillLookupBenchmark: %d distinct queries, %d mismatches"), Report.NumQueries, Report.Mismatches);
+		LogRow(TEXT("EffectBonus"), Report.LinearEffectPerSec, Report.CompiledEffectPerSec);
+		LogRow(TEXT("Ability"), Report.LinearAbilityPerSec, Report.CompiledAbilityPerSec);
+		LogRow(TEXT("Stat"), Report.MapStatPerSec, Report.CachedStatPerSec);
+	}
+
+	// ========================================================================
+	// Console Commands
+	// ========================================================================
+
+	static FAutoConsoleCommandWithWorldAndArgs BenchLookupsCommand(
+		TEXT("SEE.Progression.BenchLookups"),
+		TEXT("Compare skill tree and stat lookups per second against the old table walk. Usage: SEE.Progression.BenchLookups [Iterations=200000]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+			const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+			const USEESkillTreeComponent* SkillTree = Pawn ? Pawn->FindComponentByClass<USEESkillTreeComponent>() : nullptr;
+			if (!SkillTree)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("SkillLookupBenchmark: player has no skill tree component"));
+				return;
+			}
+
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 200000;
+			LogLookupReport(MeasureLookups(*SkillTree, Pawn->FindComponentByClass<USEEStatsComponent>(), Iterations));
+		}));
+}
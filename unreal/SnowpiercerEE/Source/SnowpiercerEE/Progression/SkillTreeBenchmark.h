@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USEESkillTreeComponent;
+class USEEStatsComponent;
+
+/**
+ * Lookups per second of the skill tree and stat queries combat, stealth and dialogue make,
+ * through the compiled modifier table and through the per-query table walk it replaced.
+ *
+ * Console:
+ *   SEE.Progression.BenchLookups [Iterations=200000]   benchmark the player's components
+ *
+ * Both paths answer the same query mix, and any query they disagree on is logged as an error.
+ */
+namespace SkillLookupBenchmark
+{
+	struct FLookupReport
+	{
+		int32 NumQueries = 0;
+
+		double LinearEffectPerSec = 0.0;
+		double CompiledEffectPerSec = 0.0;
+
+		double LinearAbilityPerSec = 0.0;
+		double CompiledAbilityPerSec = 0.0;
+
+		double MapStatPerSec = 0.0;
+		double CachedStatPerSec = 0.0;
+
+		int32 Mismatches = 0;
+	};
+
+	/** Run every query Iterations times each way. Stats may be null. */
+	SNOWPIERCEREE_API FLookupReport MeasureLookups(const USEESkillTreeComponent& SkillTree, const USEEStatsComponent* Stats, int32 Iterations);
+
+	SNOWPIERCEREE_API void LogLookupReport(const FLookupReport& Report);
+}
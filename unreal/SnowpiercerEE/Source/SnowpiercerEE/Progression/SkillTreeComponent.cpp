@@ -50,6 +50,9 @@ void USEESkillTreeComponent::LoadDataTables()
 	{
 		InitializeDefaultData();
 	}
+
+	BuildLookupIndices();
+	RebuildModifierTable();
 }
 
 void USEESkillTreeComponent::InitializeDefaultData()
@@ -456,6 +459,7 @@ bool USEESkillTreeComponent::UnlockNode(FName NodeID)
 
 	AvailableTreePoints -= Node->PointCost;
 	UnlockedNodes.Add(NodeID);
+	RebuildModifierTable();
 
 	ApplyNodeEffect(*Node);
 
@@ -519,15 +523,7 @@ TArray<FSEESkillNode> USEESkillTreeComponent::GetNodesForTree(ESEESkillTree Tree
 
 int32 USEESkillTreeComponent::GetUnlockedNodeCount(ESEESkillTree Tree) const
 {
-	int32 Count = 0;
-	for (const FSEESkillNode& Node : CachedNodes)
-	{
-		if (Node.Tree == Tree && UnlockedNodes.Contains(Node.NodeID))
-		{
-			Count++;
-		}
-	}
-	return Count;
+	return UnlockedNodeCounts[static_cast<int32>(Tree)];
 }
 
 void USEESkillTreeComponent::AddTreePoints(int32 Amount)
@@ -564,6 +560,7 @@ bool USEESkillTreeComponent::ActivatePerk(FName PerkID)
 	}
 
 	ActivePerks.Add(PerkID);
+	RebuildModifierTable();
 	ApplyPerkEffect(*Perk, true);
 	OnPerkActivated.Broadcast(PerkID);
 
@@ -584,6 +581,7 @@ void USEESkillTreeComponent::DeactivatePerk(FName PerkID)
 	}
 
 	ActivePerks.Remove(PerkID);
+	RebuildModifierTable();
 	OnPerkDeactivated.Broadcast(PerkID);
 }
 
@@ -675,78 +673,93 @@ int32 USEESkillTreeComponent::GetMaxActivePerks() const
 
 bool USEESkillTreeComponent::HasUnlockedAbility(FName AbilityTag) const
 {
-	for (const FSEESkillNode& Node : CachedNodes)
-	{
-		if (Node.UnlockTag == AbilityTag && UnlockedNodes.Contains(Node.NodeID))
-		{
-			return true;
-		}
-	}
+	const int32* Index = AbilityIndices.Find(AbilityTag);
+	return Index && UnlockedAbilities[*Index];
+}
 
-	for (const FSEEPerk& Perk : CachedPerks)
+float USEESkillTreeComponent::GetTotalEffectBonus(ESkillNodeEffect EffectType, FName OptionalStat) const
+{
+	const int32 Effect = static_cast<int32>(EffectType);
+	if (OptionalStat == NAME_None)
 	{
-		if (Perk.AffectedStat == AbilityTag && ActivePerks.Contains(Perk.PerkID))
-		{
-			return true;
-		}
+		return EffectTotals[Effect];
 	}
+	return EffectStatTotals[Effect].FindRef(OptionalStat);
+}
+
+// --- Internal ---
 
-	return false;
+const FSEESkillNode* USEESkillTreeComponent::FindNode(FName NodeID) const
+{
+	const int32* Index = NodeIndices.Find(NodeID);
+	return Index ? &CachedNodes[*Index] : nullptr;
 }
 
-float USEESkillTreeComponent::GetTotalEffectBonus(ESkillNodeEffect EffectType, FName OptionalStat) const
+const FSEEPerk* USEESkillTreeComponent::FindPerk(FName PerkID) const
 {
-	float Total = 0.0f;
+	const int32* Index = PerkIndices.Find(PerkID);
+	return Index ? &CachedPerks[*Index] : nullptr;
+}
 
-	for (const FSEESkillNode& Node : CachedNodes)
+void USEESkillTreeComponent::BuildLookupIndices()
+{
+	NodeIndices.Reset();
+	PerkIndices.Reset();
+	AbilityIndices.Reset();
+
+	for (int32 i = 0; i < CachedNodes.Num(); ++i)
 	{
-		if (Node.EffectType == EffectType && UnlockedNodes.Contains(Node.NodeID))
-		{
-			if (OptionalStat == NAME_None || Node.AffectedStat == OptionalStat)
-			{
-				Total += Node.EffectValue;
-			}
-		}
+		NodeIndices.FindOrAdd(CachedNodes[i].NodeID, i);
+		AbilityIndices.FindOrAdd(CachedNodes[i].UnlockTag, AbilityIndices.Num());
 	}
 
-	for (const FSEEPerk& Perk : CachedPerks)
+	for (int32 i = 0; i < CachedPerks.Num(); ++i)
 	{
-		if (Perk.EffectType == EffectType && ActivePerks.Contains(Perk.PerkID))
-		{
-			if (OptionalStat == NAME_None || Perk.AffectedStat == OptionalStat)
-			{
-				Total += Perk.EffectValue;
-			}
-		}
+		PerkIndices.FindOrAdd(CachedPerks[i].PerkID, i);
+		AbilityIndices.FindOrAdd(CachedPerks[i].AffectedStat, AbilityIndices.Num());
 	}
-
-	return Total;
 }
 
-// --- Internal ---
-
-const FSEESkillNode* USEESkillTreeComponent::FindNode(FName NodeID) const
+void USEESkillTreeComponent::RebuildModifierTable()
 {
+	// Same order as the per-query walk this replaced (nodes, then perks) so totals match bit for bit
+	UnlockedAbilities.Init(false, AbilityIndices.Num());
+	for (int32 Effect = 0; Effect < NumSkillNodeEffects; ++Effect)
+	{
+		EffectTotals[Effect] = 0.0f;
+		EffectStatTotals[Effect].Reset();
+	}
+	for (int32 Tree = 0; Tree < NumSkillTrees; ++Tree)
+	{
+		UnlockedNodeCounts[Tree] = 0;
+	}
+
 	for (const FSEESkillNode& Node : CachedNodes)
 	{
-		if (Node.NodeID == NodeID)
+		if (!UnlockedNodes.Contains(Node.NodeID))
 		{
-			return &Node;
+			continue;
 		}
+
+		const int32 Effect = static_cast<int32>(Node.EffectType);
+		EffectTotals[Effect] += Node.EffectValue;
+		EffectStatTotals[Effect].FindOrAdd(Node.AffectedStat) += Node.EffectValue;
+		UnlockedAbilities[AbilityIndices[Node.UnlockTag]] = true;
+		UnlockedNodeCounts[static_cast<int32>(Node.Tree)]++;
 	}
-	return nullptr;
-}
 
-const FSEEPerk* USEESkillTreeComponent::FindPerk(FName PerkID) const
-{
 	for (const FSEEPerk& Perk : CachedPerks)
 	{
-		if (Perk.PerkID == PerkID)
+		if (!ActivePerks.Contains(Perk.PerkID))
 		{
-			return &Perk;
+			continue;
 		}
+
+		const int32 Effect = static_cast<int32>(Perk.EffectType);
+		EffectTotals[Effect] += Perk.EffectValue;
+		EffectStatTotals[Effect].FindOrAdd(Perk.AffectedStat) += Perk.EffectValue;
+		UnlockedAbilities[AbilityIndices[Perk.AffectedStat]] = true;
 	}
-	return nullptr;
 }
 
 void USEESkillTreeComponent::ApplyNodeEffect(const FSEESkillNode& Node)
@@ -92,6 +92,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Progression|SkillTree")
 	float GetTotalEffectBonus(ESkillNodeEffect EffectType, FName OptionalStat = NAME_None) const;
 
+	// Every loaded node and perk, in table order
+	const TArray<FSEESkillNode>& GetAllNodes() const { return CachedNodes; }
+	const TArray<FSEEPerk>& GetAllPerks() const { return CachedPerks; }
+
 	// --- Delegates ---
 
 	UPROPERTY(BlueprintAssignable, Category = "Progression")
@@ -153,5 +157,26 @@ private:
 	void ApplyNodeEffect(const FSEESkillNode& Node);
 	void ApplyPerkEffect(const FSEEPerk& Perk, bool bApply);
 
+	// --- Compiled Modifiers ---
+	// Effect queries are made on every hit and every stealth/dialogue check, so unlocked
+	// nodes and active perks are flattened here whenever they change instead of walked per query.
+
+	void BuildLookupIndices();
+	void RebuildModifierTable();
+
+	// Position in CachedNodes/CachedPerks by ID (first row wins on duplicates)
+	TMap<FName, int32> NodeIndices;
+	TMap<FName, int32> PerkIndices;
+
+	// Bit per distinct node UnlockTag and perk AffectedStat, set while any source is unlocked/active
+	TMap<FName, int32> AbilityIndices;
+	TBitArray<> UnlockedAbilities;
+
+	// Summed EffectValue per effect type, overall and per AffectedStat
+	float EffectTotals[NumSkillNodeEffects] = {};
+	TMap<FName, float> EffectStatTotals[NumSkillNodeEffects];
+
+	int32 UnlockedNodeCounts[NumSkillTrees] = {};
+
 	void OnLevelUp(int32 NewLevel, int32 SkillPointsAvailable);
 };
@@ -15,6 +15,8 @@ enum class ESEESkillTree : uint8
 	Engineer	UMETA(DisplayName = "Engineer")
 };
 
+constexpr int32 NumSkillTrees = 5;
+
 // Node tier within a tree (determines cost and prerequisites)
 UENUM(BlueprintType)
 enum class ESkillNodeTier : uint8
@@ -39,6 +41,8 @@ enum class ESkillNodeEffect : uint8
 	SocialBonus			UMETA(DisplayName = "Social/Dialogue Bonus")
 };
 
+constexpr int32 NumSkillNodeEffects = 8;
+
 // Perk rarity/impact
 UENUM(BlueprintType)
 enum class EPerkTier : uint8
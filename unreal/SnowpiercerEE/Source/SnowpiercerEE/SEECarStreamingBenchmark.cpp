@@ -0,0 +1,305 @@
+#include "SEECarStreamingBenchmark.h"
+#include "SnowpiercerEEGameMode.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tickable.h"
+
+namespace CarStreamingBenchmark
+{
+    // ========================================================================
+    // Report
+    // ========================================================================
+
+    FString TransitionsToCsv(const TArray<FSEECarTransitionRecord>& Records)
+    {
+        FString Csv = TEXT("FromCar,ToCar,TimeToVisibleMs,PackageBytes,MemoryDeltaBytes,MaxFrameMs,HitchFrames,MaskExtended,TimedOut\n");
+        for (const FSEECarTransitionRecord& Record : Records)
+        {
+            Csv += FString::Printf(TEXT("%d,%d,%.2f,%lld,%lld,%.2f,%d,%d,%d\n"),
+                Record.FromCarIndex, Record.ToCarIndex, Record.TimeToVisibleMs, Record.PackageBytes,
+                Record.MemoryDeltaBytes, Record.MaxFrameMs, Record.NumHitchFrames,
+                Record.bMaskExtended ? 1 : 0, Record.bTimedOut ? 1 : 0);
+        }
+        return Csv;
+    }
+
+    void LogTransitionSummary(const TArray<FSEECarTransitionRecord>& Records, int32 WorstCount)
+    {
+        if (Records.Num() == 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("CarStreamingBenchmark: no transitions recorded"));
+            return;
+        }
+
+        TArray<float> VisibleMs;
+        int32 HitchFrames = 0;
+        int32 MaskExtensions = 0;
+        int32 Timeouts = 0;
+        for (const FSEECarTransitionRecord& Record : Records)
+        {
+            VisibleMs.Add(Record.TimeToVisibleMs);
+            HitchFrames += Record.NumHitchFrames;
+            MaskExtensions += Record.bMaskExtended ? 1 : 0;
+            Timeouts += Record.bTimedOut ? 1 : 0;
+        }
+        VisibleMs.Sort();
+
+        double TotalMs = 0.0;
+        for (float Ms : VisibleMs)
+        {
+            TotalMs += Ms;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("CarStreamingBenchmark: %d transitions, to visible avg %.0f ms, p95 %.0f ms, max %.0f ms"),
+            Records.Num(), TotalMs / Records.Num(), VisibleMs[FMath::Min(VisibleMs.Num() - 1, VisibleMs.Num() * 95 / 100)], VisibleMs.Last());
+        UE_LOG(LogTemp, Display, TEXT("  %d hitch frames, %d door mask extensions, %d timeouts"), HitchFrames, MaskExtensions, Timeouts);
+
+        TArray<const FSEECarTransitionRecord*> Worst;
+        for (const FSEECarTransitionRecord& Record : Records)
+        {
+            Worst.Add(&Record);
+        }
+        Worst.Sort([](const FSEECarTransitionRecord& A, const FSEECarTransitionRecord& B)
+        {
+            return A.NumHitchFrames != B.NumHitchFrames ? A.NumHitchFrames > B.NumHitchFrames : A.MaxFrameMs > B.MaxFrameMs;
+        });
+
+        UE_LOG(LogTemp, Display, TEXT("  %-6s %10s %8s %10s %8s %5s"), TEXT("Car"), TEXT("Visible"), TEXT("Hitches"), TEXT("WorstFrame"), TEXT("Package"), TEXT("Mask"));
+        for (int32 i = 0; i < FMath::Min(WorstCount, Worst.Num()); ++i)
+        {
+            const FSEECarTransitionRecord& Record = *Worst[i];
+            UE_LOG(LogTemp, Display, TEXT("  %-6d %8.0fms %8d %8.1fms %6lldKB %5s"),
+                Record.ToCarIndex, Record.TimeToVisibleMs, Record.NumHitchFrames, Record.MaxFrameMs,
+                Record.PackageBytes / 1024, Record.bMaskExtended ? TEXT("ext") : TEXT("ok"));
+        }
+    }
+
+    FString GetDefaultCsvPath()
+    {
+        return FPaths::Combine(FPaths::ProfilingDir(), TEXT("CarStreamingWalk.csv"));
+    }
+
+    static void WriteReport(const TArray<FSEECarTransitionRecord>& Records, const FString& Path)
+    {
+        const FString CsvPath = Path.IsEmpty() ? GetDefaultCsvPath() : Path;
+        if (FFileHelper::SaveStringToFile(TransitionsToCsv(Records), *CsvPath))
+        {
+            UE_LOG(LogTemp, Display, TEXT("CarStreamingBenchmark: wrote %s"), *CsvPath);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("CarStreamingBenchmark: could not write %s"), *CsvPath);
+        }
+        LogTransitionSummary(Records);
+    }
+
+    // ========================================================================
+    // Walker
+    // ========================================================================
+
+    /** Drives door approach, mask and EnterCar through a range of cars, one at a time. */
+    class FCarStreamingWalker : public FTickableGameObject
+    {
+    public:
+        FCarStreamingWalker(UWorld* InWorld, const FWalkConfig& InConfig)
+            : World(InWorld)
+            , Config(InConfig)
+            , CarIndex(InConfig.FirstCarIndex)
+        {
+        }
+
+        bool IsFinished() const { return Step == EStep::Done; }
+
+        virtual TStatId GetStatId() const override
+        {
+            RETURN_QUICK_DECLARE_CYCLE_STAT(FCarStreamingWalker, STATGROUP_Tickables);
+        }
+
+        virtual bool IsTickable() const override { return World.IsValid() && Step != EStep::Done; }
+
+        virtual void Tick(float DeltaTime) override
+        {
+            USEECarStreamingSubsystem* Streaming = World->GetSubsystem<USEECarStreamingSubsystem>();
+            if (!Streaming)
+            {
+                Finish(nullptr);
+                return;
+            }
+
+            StepTime += DeltaTime;
+
+            switch (Step)
+            {
+            case EStep::Start:
+                Streaming->ClearTransitionLog();
+                BeginCar(Streaming);
+                break;
+
+            case EStep::Approach:
+                if (StepTime >= Config.ApproachSeconds)
+                {
+                    Streaming->SetDoorLoadMaskActive(true);
+                    SetStep(EStep::DoorOpening);
+                }
+                break;
+
+            case EStep::DoorOpening:
+                if (StepTime >= Config.DoorSeconds * 0.75f)
+                {
+                    EnterCar(Streaming);
+                    SetStep(EStep::DoorClosing);
+                }
+                break;
+
+            case EStep::DoorClosing:
+                if (StepTime >= Config.DoorSeconds * 0.25f)
+                {
+                    Streaming->SetDoorLoadMaskActive(false);
+                    SetStep(EStep::Settle);
+                }
+                break;
+
+            case EStep::Settle:
+                if (!Streaming->IsTransitionInProgress())
+                {
+                    SetStep(EStep::Dwell);
+                }
+                break;
+
+            case EStep::Dwell:
+                if (StepTime >= Config.DwellSeconds)
+                {
+                    ++CarIndex;
+                    BeginCar(Streaming);
+                }
+                break;
+
+            case EStep::Done:
+                break;
+            }
+        }
+
+    private:
+        enum class EStep : uint8
+        {
+            Start,
+            Approach,
+            DoorOpening,
+            DoorClosing,
+            Settle,
+            Dwell,
+            Done
+        };
+
+        void SetStep(EStep NewStep)
+        {
+            Step = NewStep;
+            StepTime = 0.f;
+        }
+
+        void BeginCar(USEECarStreamingSubsystem* Streaming)
+        {
+            // Cars without a sublevel (not built yet) are skipped, not walked
+            while (CarIndex <= Config.LastCarIndex && !Streaming->IsCarRegistered(CarIndex))
+            {
+                ++Skipped;
+                ++CarIndex;
+            }
+
+            if (CarIndex > Config.LastCarIndex)
+            {
+                Finish(Streaming);
+                return;
+            }
+
+            Streaming->NotifyDoorApproach(CarIndex);
+            SetStep(EStep::Approach);
+        }
+
+        void EnterCar(USEECarStreamingSubsystem* Streaming)
+        {
+            // Through the game mode when there is one, so everything listening for car changes runs too
+            if (ASnowpiercerEEGameMode* GameMode = World->GetAuthGameMode<ASnowpiercerEEGameMode>())
+            {
+                GameMode->OnPlayerEnteredCar(CarIndex);
+            }
+            else
+            {
+                Streaming->EnterCar(CarIndex);
+            }
+        }
+
+        void Finish(USEECarStreamingSubsystem* Streaming)
+        {
+            SetStep(EStep::Done);
+
+            if (Streaming)
+            {
+                UE_LOG(LogTemp, Display, TEXT("CarStreamingBenchmark: walked cars %d-%d, %d without a sublevel skipped"),
+                    Config.FirstCarIndex, Config.LastCarIndex, Skipped);
+                WriteReport(Streaming->GetTransitionLog(), Config.CsvPath);
+            }
+
+            if (Config.bExitWhenDone)
+            {
+                FPlatformMisc::RequestExit(false);
+            }
+        }
+
+        TWeakObjectPtr<UWorld> World;
+        FWalkConfig Config;
+        int32 CarIndex = 0;
+        int32 Skipped = 0;
+        EStep Step = EStep::Start;
+        float StepTime = 0.f;
+    };
+
+    static TUniquePtr<FCarStreamingWalker> ActiveWalker;
+
+    void StartWalk(UWorld* World, const FWalkConfig& Config)
+    {
+        if (!World)
+        {
+            return;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("CarStreamingBenchmark: walking cars %d-%d"), Config.FirstCarIndex, Config.LastCarIndex);
+        ActiveWalker = MakeUnique<FCarStreamingWalker>(World, Config);
+    }
+
+    // ========================================================================
+    // Console Commands
+    // ========================================================================
+
+    static FAutoConsoleCommandWithWorldAndArgs DumpTraceCommand(
+        TEXT("SEE.Streaming.DumpTrace"),
+        TEXT("Write the car transition log as CSV and log a summary. Usage: SEE.Streaming.DumpTrace [Path]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            const USEECarStreamingSubsystem* Streaming = World ? World->GetSubsystem<USEECarStreamingSubsystem>() : nullptr;
+            if (Streaming)
+            {
+                WriteReport(Streaming->GetTransitionLog(), Args.Num() > 0 ? Args[0] : FString());
+            }
+        }));
+
+    static FAutoConsoleCommandWithWorldAndArgs WalkCommand(
+        TEXT("SEE.Streaming.Walk"),
+        TEXT("Walk through a range of cars and report transitions that hitch. Usage: SEE.Streaming.Walk [First=1] [Last=100] [ExitWhenDone=0]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            FWalkConfig Config;
+            if (Args.Num() > 0)
+            {
+                Config.FirstCarIndex = FMath::Max(FCString::Atoi(*Args[0]), 0);
+            }
+            if (Args.Num() > 1)
+            {
+                Config.LastCarIndex = FMath::Max(FCString::Atoi(*Args[1]), Config.FirstCarIndex);
+            }
+            Config.bExitWhenDone = Args.Num() > 2 && FCString::Atoi(*Args[2]) != 0;
+            StartWalk(World, Config);
+        }));
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SEECarStreamingSubsystem.h"
+
+class UWorld;
+
+/**
+ * Car streaming telemetry output and the hitch walker.
+ *
+ * Console:
+ *   SEE.Streaming.DumpTrace [Path]                 write the transition log as CSV and log a summary
+ *   SEE.Streaming.Walk [First=1] [Last=100] [Exit=0]
+ *       walk the player through every car in the range the way a door does
+ *       (approach, mask, enter, unmask), then write the CSV and summary
+ *
+ * Headless:
+ *   UnrealEditor SnowpiercerEE -game -nullrhi -unattended -ExecCmds="SEE.Streaming.Walk 1 100 1"
+ *
+ * Default output is Saved/Profiling/CarStreamingWalk.csv.
+ */
+namespace CarStreamingBenchmark
+{
+    struct FWalkConfig
+    {
+        int32 FirstCarIndex = 1;
+        int32 LastCarIndex = 100;
+
+        /** Time between NotifyDoorApproach and the door animation starting */
+        float ApproachSeconds = 0.5f;
+
+        /** Door animation length; EnterCar fires at 75%, as in the door blueprint */
+        float DoorSeconds = 0.8f;
+
+        /** Time spent in each car after it is visible, so post-load hitches are caught */
+        float DwellSeconds = 2.f;
+
+        bool bExitWhenDone = false;
+
+        /** Empty uses the default path */
+        FString CsvPath;
+    };
+
+    /** One row per transition */
+    SNOWPIERCEREE_API FString TransitionsToCsv(const TArray<FSEECarTransitionRecord>& Records);
+
+    /** Totals plus the WorstCount transitions by hitch frames, then worst frame */
+    SNOWPIERCEREE_API void LogTransitionSummary(const TArray<FSEECarTransitionRecord>& Records, int32 WorstCount = 10);
+
+    SNOWPIERCEREE_API FString GetDefaultCsvPath();
+
+    /** Start walking World's train. Replaces any walk in progress. */
+    SNOWPIERCEREE_API void StartWalk(UWorld* World, const FWalkConfig& Config);
+}
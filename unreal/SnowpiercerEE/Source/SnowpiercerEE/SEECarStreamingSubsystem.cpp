@@ -1,5 +1,22 @@
 #include "SEECarStreamingSubsystem.h"
+#include "Engine/LevelStreaming.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/PackageName.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("CarStreaming"), STATGROUP_CarStreaming, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Refresh Streaming Set"), STAT_CarStreamingRefresh, STATGROUP_CarStreaming);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Loaded Cars"), STAT_CarStreamingLoadedCars, STATGROUP_CarStreaming);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Loads"), STAT_CarStreamingPendingLoads, STATGROUP_CarStreaming);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Requested Memory (MB)"), STAT_CarStreamingMemoryMB, STATGROUP_CarStreaming);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Transition To Visible (ms)"), STAT_CarStreamingTransitionMs, STATGROUP_CarStreaming);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hitch Frames In Transition"), STAT_CarStreamingHitchFrames, STATGROUP_CarStreaming);
+
+CSV_DEFINE_CATEGORY(CarStreaming, true);
 
 void USEECarStreamingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -9,11 +26,21 @@ void USEECarStreamingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void USEECarStreamingSubsystem::Deinitialize()
 {
     CarLevelByIndex.Empty();
+    CarMemoryByIndex.Empty();
     LoadedCars.Empty();
+    LoadRequestTimes.Empty();
+    StallStartTimes.Empty();
+    ActiveTransition.Reset();
+    TransitionLog.Empty();
     CurrentCarIndex = INDEX_NONE;
     Super::Deinitialize();
 }
 
+TStatId USEECarStreamingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USEECarStreamingSubsystem, STATGROUP_CarStreaming);
+}
+
 void USEECarStreamingSubsystem::RegisterZone1Cars()
 {
     // Zone 1 (The Tail) — 15 streaming sublevels built by Scripts/build_zone1.py
@@ -45,7 +72,7 @@ void USEECarStreamingSubsystem::RegisterZone1Cars()
     UE_LOG(LogTemp, Log, TEXT("SEECarStreaming: Registered %d Zone 1 car sublevels"), CarLevelByIndex.Num());
 }
 
-void USEECarStreamingSubsystem::RegisterCarLevel(int32 CarIndex, FName LevelName)
+void USEECarStreamingSubsystem::RegisterCarLevel(int32 CarIndex, FName LevelName, float EstimatedMemoryMB)
 {
     if (CarIndex < 0 || LevelName.IsNone())
     {
@@ -53,6 +80,10 @@ void USEECarStreamingSubsystem::RegisterCarLevel(int32 CarIndex, FName LevelName
     }
 
     CarLevelByIndex.Add(CarIndex, LevelName);
+    if (EstimatedMemoryMB > 0.f)
+    {
+        CarMemoryByIndex.Add(CarIndex, EstimatedMemoryMB);
+    }
 }
 
 void USEECarStreamingSubsystem::EnterCar(int32 CarIndex)
@@ -62,8 +93,27 @@ void USEECarStreamingSubsystem::EnterCar(int32 CarIndex)
         return;
     }
 
+    const int32 PreviousCarIndex = CurrentCarIndex;
+    if (PreviousCarIndex != INDEX_NONE && CarIndex != PreviousCarIndex)
+    {
+        MovementDirection = CarIndex > PreviousCarIndex ? 1 : -1;
+        ReversedSeconds = 0.f;
+    }
     CurrentCarIndex = CarIndex;
 
+    CSV_EVENT(CarStreaming, TEXT("EnterCar %d"), CarIndex);
+    BeginTransition(PreviousCarIndex, CarIndex);
+
+    if (DoorApproachCarIndex == CarIndex)
+    {
+        DoorApproachCarIndex = INDEX_NONE;
+    }
+
+    if (CarLevelByIndex.Contains(CarIndex) && !IsCarLoaded(CarIndex))
+    {
+        StallStartTimes.Add(CarIndex, FPlatformTime::Seconds());
+    }
+
     if (bDoorLoadMaskActive)
     {
         bRefreshPending = true;
@@ -75,6 +125,13 @@ void USEECarStreamingSubsystem::EnterCar(int32 CarIndex)
 
 void USEECarStreamingSubsystem::SetDoorLoadMaskActive(bool bActive)
 {
+    // Dropping the mask on a car that is not up yet means the door has to hold
+    if (bDoorLoadMaskActive && !bActive && ActiveTransition.IsSet()
+        && !IsCarVisible(ActiveTransition->Record.ToCarIndex))
+    {
+        ActiveTransition->Record.bMaskExtended = true;
+    }
+
     bDoorLoadMaskActive = bActive;
 
     if (!bDoorLoadMaskActive && bRefreshPending)
@@ -84,6 +141,98 @@ void USEECarStreamingSubsystem::SetDoorLoadMaskActive(bool bActive)
     }
 }
 
+void USEECarStreamingSubsystem::NotifyDoorApproach(int32 TargetCarIndex)
+{
+    if (TargetCarIndex == DoorApproachCarIndex || !CarLevelByIndex.Contains(TargetCarIndex))
+    {
+        return;
+    }
+
+    DoorApproachCarIndex = TargetCarIndex;
+
+    if (bDoorLoadMaskActive)
+    {
+        bRefreshPending = true;
+        return;
+    }
+
+    RefreshStreamingSet();
+}
+
+void USEECarStreamingSubsystem::SetTravelTarget(int32 CarIndex)
+{
+    if (CarIndex == TravelTargetCarIndex)
+    {
+        return;
+    }
+
+    TravelTargetCarIndex = CarIndex;
+
+    if (bDoorLoadMaskActive)
+    {
+        bRefreshPending = true;
+        return;
+    }
+
+    RefreshStreamingSet();
+}
+
+void USEECarStreamingSubsystem::SetMemoryBudgetMB(float BudgetMB)
+{
+    MemoryBudgetMB = FMath::Max(0.f, BudgetMB);
+
+    if (bDoorLoadMaskActive)
+    {
+        bRefreshPending = true;
+        return;
+    }
+
+    RefreshStreamingSet();
+}
+
+float USEECarStreamingSubsystem::GetLoadedMemoryMB() const
+{
+    float TotalMB = 0.f;
+    for (int32 CarIndex : LoadedCars)
+    {
+        TotalMB += GetCarMemoryMB(CarIndex);
+    }
+    return TotalMB;
+}
+
+bool USEECarStreamingSubsystem::IsCarLoaded(int32 CarIndex) const
+{
+    const ULevelStreaming* Level = FindStreamingLevel(CarIndex);
+    return Level && Level->IsLevelLoaded();
+}
+
+bool USEECarStreamingSubsystem::IsCarVisible(int32 CarIndex) const
+{
+    const ULevelStreaming* Level = FindStreamingLevel(CarIndex);
+    return Level && Level->IsLevelVisible();
+}
+
+void USEECarStreamingSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    UpdateLoadTimings();
+    UpdateTransition(DeltaTime);
+
+    if (UpdateMovementDirection(DeltaTime) && !bDoorLoadMaskActive)
+    {
+        RefreshStreamingSet();
+    }
+
+    const float RequestedMB = GetLoadedMemoryMB();
+    SET_DWORD_STAT(STAT_CarStreamingLoadedCars, LoadedCars.Num());
+    SET_DWORD_STAT(STAT_CarStreamingPendingLoads, LoadRequestTimes.Num());
+    SET_FLOAT_STAT(STAT_CarStreamingMemoryMB, RequestedMB);
+    CSV_CUSTOM_STAT(CarStreaming, LoadedCars, LoadedCars.Num(), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CarStreaming, PendingLoads, LoadRequestTimes.Num(), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(CarStreaming, RequestedMemoryMB, RequestedMB, ECsvCustomStatOp::Set);
+}
+
 void USEECarStreamingSubsystem::RefreshStreamingSet()
 {
     if (CurrentCarIndex == INDEX_NONE)
@@ -91,77 +240,298 @@ void USEECarStreamingSubsystem::RefreshStreamingSet()
         return;
     }
 
-    TSet<int32> DesiredCars;
-    DesiredCars.Add(CurrentCarIndex - 1);
-    DesiredCars.Add(CurrentCarIndex);
-    DesiredCars.Add(CurrentCarIndex + 1);
+    SCOPE_CYCLE_COUNTER(STAT_CarStreamingRefresh);
 
-    for (int32 CarIndex : LoadedCars)
+    struct FCandidate
     {
-        if (!DesiredCars.Contains(CarIndex))
+        int32 CarIndex;
+        float Score;
+    };
+
+    TArray<FCandidate, TInlineAllocator<2 * PlannerLookahead + 3>> Candidates;
+    auto AddCandidate = [this, &Candidates](int32 CarIndex)
+    {
+        if (CarLevelByIndex.Contains(CarIndex)
+            && !Candidates.ContainsByPredicate([CarIndex](const FCandidate& C) { return C.CarIndex == CarIndex; }))
         {
-            if (const FName* Level = CarLevelByIndex.Find(CarIndex))
-            {
-                StreamLevel(*Level, false);
-            }
+            Candidates.Add({ CarIndex, ScoreCar(CarIndex) });
         }
+    };
+
+    for (int32 Offset = -PlannerLookahead; Offset <= PlannerLookahead; ++Offset)
+    {
+        AddCandidate(CurrentCarIndex + Offset);
     }
+    AddCandidate(DoorApproachCarIndex);
+    AddCandidate(TravelTargetCarIndex);
+
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.Score > B.Score; });
 
-    for (int32 CarIndex : DesiredCars)
+    // Best first until the budget is spent; a smaller car further down may still fit
+    TSet<int32> DesiredCars;
+    float SpentMB = 0.f;
+    for (int32 Rank = 0; Rank < Candidates.Num(); ++Rank)
     {
-        if (LoadedCars.Contains(CarIndex))
+        const int32 CarIndex = Candidates[Rank].CarIndex;
+        const float CarMB = GetCarMemoryMB(CarIndex);
+        if (CarIndex != CurrentCarIndex && SpentMB + CarMB > MemoryBudgetMB)
         {
             continue;
         }
 
-        if (const FName* Level = CarLevelByIndex.Find(CarIndex))
-        {
-            StreamLevel(*Level, true);
-            LoadedCars.Add(CarIndex);
-        }
+        SpentMB += CarMB;
+        DesiredCars.Add(CarIndex);
+
+        const bool bVisible = FMath::Abs(CarIndex - CurrentCarIndex) <= 1;
+        StreamLevel(CarIndex, true, bVisible, Candidates.Num() - Rank);
     }
 
     for (int32 CarIndex : LoadedCars.Array())
     {
         if (!DesiredCars.Contains(CarIndex))
         {
-            LoadedCars.Remove(CarIndex);
+            StreamLevel(CarIndex, false, false, 0);
+        }
+    }
+}
+
+float USEECarStreamingSubsystem::ScoreCar(int32 CarIndex) const
+{
+    if (CarIndex == CurrentCarIndex)
+    {
+        return MAX_flt;
+    }
+
+    const int32 Offset = CarIndex - CurrentCarIndex;
+    float Score = 1.f / FMath::Abs(Offset);
+
+    if (MovementDirection != 0 && FMath::Sign(Offset) == MovementDirection)
+    {
+        Score *= DirectionBias;
+    }
+    if (CarIndex == DoorApproachCarIndex)
+    {
+        Score += DoorApproachBonus;
+    }
+    if (CarIndex == TravelTargetCarIndex)
+    {
+        Score += TravelTargetBonus;
+    }
+    return Score;
+}
+
+float USEECarStreamingSubsystem::GetCarMemoryMB(int32 CarIndex) const
+{
+    const float* EstimateMB = CarMemoryByIndex.Find(CarIndex);
+    return EstimateMB ? *EstimateMB : DefaultCarMemoryMB;
+}
+
+bool USEECarStreamingSubsystem::UpdateMovementDirection(float DeltaTime)
+{
+    const APawn* Player = UGameplayStatics::GetPlayerPawn(this, 0);
+    if (!Player)
+    {
+        return false;
+    }
+
+    // Car indices increase along +X
+    const float SpeedAlongTrain = Player->GetVelocity().X;
+    if (FMath::Abs(SpeedAlongTrain) < DirectionSpeedThreshold)
+    {
+        ReversedSeconds = 0.f;
+        return false;
+    }
+
+    const int32 NewDirection = SpeedAlongTrain > 0.f ? 1 : -1;
+    if (NewDirection == MovementDirection)
+    {
+        ReversedSeconds = 0.f;
+        return false;
+    }
+
+    // The first direction is taken at once; a reversal has to be held
+    ReversedSeconds += DeltaTime;
+    if (MovementDirection != 0 && ReversedSeconds < DirectionDwellSeconds)
+    {
+        return false;
+    }
+
+    MovementDirection = NewDirection;
+    ReversedSeconds = 0.f;
+    return true;
+}
+
+void USEECarStreamingSubsystem::UpdateLoadTimings()
+{
+    if (LoadRequestTimes.Num() == 0 && StallStartTimes.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+
+    for (auto It = LoadRequestTimes.CreateIterator(); It; ++It)
+    {
+        if (!IsCarLoaded(It.Key()))
+        {
+            continue;
         }
+
+        const float Seconds = static_cast<float>(Now - It.Value());
+        FSEECarLoadStats& Stats = LoadStatsByCar.FindOrAdd(It.Key());
+        Stats.LastLoadSeconds = Seconds;
+        Stats.AverageLoadSeconds = (Stats.AverageLoadSeconds * Stats.NumLoads + Seconds) / (Stats.NumLoads + 1);
+        Stats.MaxLoadSeconds = FMath::Max(Stats.MaxLoadSeconds, Seconds);
+        ++Stats.NumLoads;
+
+        UE_LOG(LogTemp, Log, TEXT("SEECarStreaming: Car %d loaded in %.2fs"), It.Key(), Seconds);
+        It.RemoveCurrent();
     }
 
-    while (LoadedCars.Num() > MaxLoadedCars)
+    for (auto It = StallStartTimes.CreateIterator(); It; ++It)
     {
-        LoadedCars.Remove(*LoadedCars.CreateIterator());
+        if (!IsCarLoaded(It.Key()))
+        {
+            continue;
+        }
+
+        const float Seconds = static_cast<float>(Now - It.Value());
+        FSEECarLoadStats& Stats = LoadStatsByCar.FindOrAdd(It.Key());
+        ++Stats.NumStalls;
+        Stats.MaxStallSeconds = FMath::Max(Stats.MaxStallSeconds, Seconds);
+
+        UE_LOG(LogTemp, Warning, TEXT("SEECarStreaming: Player waited %.2fs for car %d to load"), Seconds, It.Key());
+        It.RemoveCurrent();
     }
 }
 
-void USEECarStreamingSubsystem::StreamLevel(FName LevelName, bool bShouldLoad)
+// --- Telemetry ---
+
+void USEECarStreamingSubsystem::BeginTransition(int32 FromCarIndex, int32 ToCarIndex)
 {
-    if (LevelName.IsNone() || !GetWorld())
+    if (ActiveTransition.IsSet())
+    {
+        EndTransition(true);
+    }
+
+    FActiveTransition& Transition = ActiveTransition.Emplace();
+    Transition.Record.FromCarIndex = FromCarIndex;
+    Transition.Record.ToCarIndex = ToCarIndex;
+    Transition.Record.PackageBytes = GetCarPackageBytes(ToCarIndex);
+    Transition.StartTime = FPlatformTime::Seconds();
+    Transition.StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+    // Walking in without a mask onto a car that is not up yet is the same failure
+    if (!bDoorLoadMaskActive && !IsCarVisible(ToCarIndex))
+    {
+        Transition.Record.bMaskExtended = true;
+    }
+}
+
+void USEECarStreamingSubsystem::UpdateTransition(float DeltaTime)
+{
+    if (!ActiveTransition.IsSet())
     {
         return;
     }
 
-    FLatentActionInfo LatentInfo;
-    LatentInfo.CallbackTarget = nullptr;
-    LatentInfo.ExecutionFunction = NAME_None;
-    LatentInfo.Linkage = 0;
-    LatentInfo.UUID = GetTypeHash(LevelName);
+    FSEECarTransitionRecord& Record = ActiveTransition->Record;
+    const float FrameMs = DeltaTime * 1000.f;
+    Record.MaxFrameMs = FMath::Max(Record.MaxFrameMs, FrameMs);
+    if (FrameMs > HitchThresholdMs)
+    {
+        ++Record.NumHitchFrames;
+        INC_DWORD_STAT(STAT_CarStreamingHitchFrames);
+        CSV_EVENT(CarStreaming, TEXT("Hitch %.1fms entering car %d"), FrameMs, Record.ToCarIndex);
+    }
 
-    if (bShouldLoad)
+    if (IsCarVisible(Record.ToCarIndex))
     {
-        UGameplayStatics::LoadStreamLevel(this, LevelName, true, false, LatentInfo);
+        EndTransition(false);
     }
-    else
+    else if (FPlatformTime::Seconds() - ActiveTransition->StartTime > TransitionTimeoutSeconds)
+    {
+        EndTransition(true);
+    }
+}
+
+void USEECarStreamingSubsystem::EndTransition(bool bTimedOut)
+{
+    FSEECarTransitionRecord Record = ActiveTransition->Record;
+    Record.bTimedOut = bTimedOut;
+    Record.TimeToVisibleMs = static_cast<float>((FPlatformTime::Seconds() - ActiveTransition->StartTime) * 1000.0);
+    Record.MemoryDeltaBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(ActiveTransition->StartUsedPhysical);
+    ActiveTransition.Reset();
+
+    SET_FLOAT_STAT(STAT_CarStreamingTransitionMs, Record.TimeToVisibleMs);
+    CSV_CUSTOM_STAT(CarStreaming, TransitionToVisibleMs, Record.TimeToVisibleMs, ECsvCustomStatOp::Set);
+
+    if (bTimedOut || Record.bMaskExtended || Record.NumHitchFrames > 0)
     {
-        UGameplayStatics::UnloadStreamLevel(this, LevelName, LatentInfo, false);
-        for (int32 CarIndex : LoadedCars.Array())
+        UE_LOG(LogTemp, Warning, TEXT("SEECarStreaming: Car %d -> %d visible after %.0f ms, %d hitch frames (worst %.1f ms)%s%s"),
+            Record.FromCarIndex, Record.ToCarIndex, Record.TimeToVisibleMs, Record.NumHitchFrames, Record.MaxFrameMs,
+            Record.bMaskExtended ? TEXT(", door mask extended") : TEXT(""),
+            bTimedOut ? TEXT(", timed out") : TEXT(""));
+    }
+
+    TransitionLog.Add(Record);
+}
+
+int64 USEECarStreamingSubsystem::GetCarPackageBytes(int32 CarIndex) const
+{
+    const ULevelStreaming* Level = FindStreamingLevel(CarIndex);
+    FString Filename;
+    if (!Level || !FPackageName::DoesPackageExist(Level->GetWorldAssetPackageName(), &Filename))
+    {
+        return 0;
+    }
+
+    const int64 Size = IFileManager::Get().FileSize(*Filename);
+    return Size > 0 ? Size : 0;
+}
+
+ULevelStreaming* USEECarStreamingSubsystem::FindStreamingLevel(int32 CarIndex) const
+{
+    const FName* LevelName = CarLevelByIndex.Find(CarIndex);
+    if (!LevelName || !GetWorld())
+    {
+        return nullptr;
+    }
+    return UGameplayStatics::GetStreamingLevel(GetWorld(), *LevelName);
+}
+
+void USEECarStreamingSubsystem::StreamLevel(int32 CarIndex, bool bShouldLoad, bool bShouldBeVisible, int32 Priority)
+{
+    ULevelStreaming* Level = FindStreamingLevel(CarIndex);
+    if (!Level)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SEECarStreaming: No streaming level for car %d"), CarIndex);
+        LoadedCars.Remove(CarIndex);
+        return;
+    }
+
+    if (bShouldLoad)
+    {
+        if (!LoadedCars.Contains(CarIndex))
         {
-            if (CarLevelByIndex.FindRef(CarIndex) == LevelName)
+            LoadedCars.Add(CarIndex);
+            if (!Level->IsLevelLoaded())
             {
-                LoadedCars.Remove(CarIndex);
-                break;
+                LoadRequestTimes.Add(CarIndex, FPlatformTime::Seconds());
             }
         }
+
+        Level->SetPriority(Priority);
+        Level->SetShouldBeLoaded(true);
+        Level->SetShouldBeVisible(bShouldBeVisible);
+    }
+    else
+    {
+        Level->SetShouldBeVisible(false);
+        Level->SetShouldBeLoaded(false);
+
+        LoadedCars.Remove(CarIndex);
+        LoadRequestTimes.Remove(CarIndex);
+        StallStartTimes.Remove(CarIndex);
     }
 }
@@ -4,17 +4,113 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "SEECarStreamingSubsystem.generated.h"
 
+class ULevelStreaming;
+
+/** Load latency history for one car sublevel, for tuning the door mask. */
+USTRUCT(BlueprintType)
+struct FSEECarLoadStats
+{
+    GENERATED_BODY()
+
+    /** Completed loads of this car */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int32 NumLoads = 0;
+
+    /** Seconds from load request to level loaded */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    float LastLoadSeconds = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    float AverageLoadSeconds = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    float MaxLoadSeconds = 0.f;
+
+    /** Times the player entered this car before it finished loading */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int32 NumStalls = 0;
+
+    /** Longest wait between entering the car and it finishing loading */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    float MaxStallSeconds = 0.f;
+};
+
+/** One car transition, from EnterCar until the car's sublevel was visible. */
+USTRUCT(BlueprintType)
+struct FSEECarTransitionRecord
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int32 FromCarIndex = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int32 ToCarIndex = INDEX_NONE;
+
+    /** EnterCar until the level was visible; one frame if it already was */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    float TimeToVisibleMs = 0.f;
+
+    /** On-disk size of the car's level package */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int64 PackageBytes = 0;
+
+    /** Change in used physical memory over the transition */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int64 MemoryDeltaBytes = 0;
+
+    /** Worst frame during the transition */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    float MaxFrameMs = 0.f;
+
+    /** Frames over HitchThresholdMs during the transition */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    int32 NumHitchFrames = 0;
+
+    /** The car was still not visible when the door mask came down */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    bool bMaskExtended = false;
+
+    /** Not visible after TransitionTimeoutSeconds, or the player moved on first */
+    UPROPERTY(BlueprintReadOnly, Category="Streaming")
+    bool bTimedOut = false;
+};
+
+/**
+ * Streams car sublevels around the player.
+ *
+ * Rather than a fixed window, each refresh scores the cars around the current
+ * one and loads the best of them until the memory budget is spent:
+ *   - nearer cars score higher, and cars ahead of the player's movement
+ *     along the train score DirectionBias times more than those behind;
+ *   - a door the player is approaching (NotifyDoorApproach) boosts the car
+ *     beyond it, so its packages are already in flight before the door
+ *     animation and load mask start;
+ *   - a mini-rail travel target (SetTravelTarget) is prefetched hidden.
+ * Higher scores also get a higher streaming priority. The current car and its
+ * neighbours are made visible; anything further is loaded hidden.
+ *
+ * Every load is timed from request to completion, and entering a car that
+ * has not finished loading counts as a stall (GetCarLoadStats). Each
+ * EnterCar also opens a transition record that closes once the car is
+ * visible; records accumulate in GetTransitionLog, counters go to the
+ * CarStreaming stat group ("stat CarStreaming") and events to the CSV
+ * profiler. See SEECarStreamingBenchmark.h for the trace dump and walker.
+ */
 UCLASS()
-class SNOWPIERCEREE_API USEECarStreamingSubsystem : public UWorldSubsystem
+class SNOWPIERCEREE_API USEECarStreamingSubsystem : public UTickableWorldSubsystem
 {
     GENERATED_BODY()
 
 public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
 
+    /** EstimatedMemoryMB <= 0 uses DefaultCarMemoryMB */
     UFUNCTION(BlueprintCallable, Category="Streaming")
-    void RegisterCarLevel(int32 CarIndex, FName LevelName);
+    void RegisterCarLevel(int32 CarIndex, FName LevelName, float EstimatedMemoryMB = 0.f);
 
     /** Register all Zone 1 car sublevels from the built-in registry.
      *  Call once at level startup (e.g. from a Level Blueprint or GameMode). */
@@ -27,33 +123,144 @@ public:
     UFUNCTION(BlueprintCallable, Category="Streaming")
     void SetDoorLoadMaskActive(bool bActive);
 
+    /** The player is closing on the door into TargetCarIndex; call before the door animation starts */
+    UFUNCTION(BlueprintCallable, Category="Streaming")
+    void NotifyDoorApproach(int32 TargetCarIndex);
+
+    /** The player is travelling (mini-rail, transport deck) toward CarIndex; INDEX_NONE clears it */
+    UFUNCTION(BlueprintCallable, Category="Streaming")
+    void SetTravelTarget(int32 CarIndex);
+
+    UFUNCTION(BlueprintCallable, Category="Streaming")
+    void SetMemoryBudgetMB(float BudgetMB);
+
     UFUNCTION(BlueprintPure, Category="Streaming")
     int32 GetCurrentCarIndex() const { return CurrentCarIndex; }
 
     UFUNCTION(BlueprintPure, Category="Streaming")
     int32 GetNumRegisteredCars() const { return CarLevelByIndex.Num(); }
 
+    UFUNCTION(BlueprintPure, Category="Streaming")
+    bool IsCarRegistered(int32 CarIndex) const { return CarLevelByIndex.Contains(CarIndex); }
+
+    UFUNCTION(BlueprintPure, Category="Streaming")
+    int32 GetNumLoadedCars() const { return LoadedCars.Num(); }
+
+    /** Estimated memory of the cars currently requested */
+    UFUNCTION(BlueprintPure, Category="Streaming")
+    float GetLoadedMemoryMB() const;
+
+    /** Whether the car's sublevel has finished loading */
+    UFUNCTION(BlueprintPure, Category="Streaming")
+    bool IsCarLoaded(int32 CarIndex) const;
+
+    UFUNCTION(BlueprintPure, Category="Streaming")
+    FSEECarLoadStats GetCarLoadStats(int32 CarIndex) const { return LoadStatsByCar.FindRef(CarIndex); }
+
+    /** Whether the car's sublevel is loaded and visible */
+    UFUNCTION(BlueprintPure, Category="Streaming")
+    bool IsCarVisible(int32 CarIndex) const;
+
+    // --- Telemetry ---
+
+    /** Completed car transitions, oldest first */
+    const TArray<FSEECarTransitionRecord>& GetTransitionLog() const { return TransitionLog; }
+
+    void ClearTransitionLog() { TransitionLog.Reset(); }
+
+    bool IsTransitionInProgress() const { return ActiveTransition.IsSet(); }
+
+    /** Frame time that counts as a hitch */
+    static constexpr float HitchThresholdMs = 33.4f;
+
+    /** A transition that has not become visible after this long is closed as timed out */
+    static constexpr double TransitionTimeoutSeconds = 10.0;
+
+    // Planner weights
+    static constexpr int32 PlannerLookahead = 3;
+    static constexpr float DirectionBias = 2.f;
+    static constexpr float DoorApproachBonus = 4.f;
+    static constexpr float TravelTargetBonus = 2.f;
+
+    /** Player speed along the train (cm/s) below which the last known direction is kept */
+    static constexpr float DirectionSpeedThreshold = 50.f;
+
+    /** How long a reversal must be held before the set is re-planned, so sidestepping an NPC or backing off a door does not churn loads */
+    static constexpr float DirectionDwellSeconds = 1.5f;
+
 private:
     void RefreshStreamingSet();
-    void StreamLevel(FName LevelName, bool bShouldLoad);
+    void StreamLevel(int32 CarIndex, bool bShouldLoad, bool bShouldBeVisible, int32 Priority);
+    ULevelStreaming* FindStreamingLevel(int32 CarIndex) const;
+
+    /** Planner score for a candidate car; higher loads first */
+    float ScoreCar(int32 CarIndex) const;
+
+    float GetCarMemoryMB(int32 CarIndex) const;
+
+    /** Track the player's direction along the train; true once a reversal has been held for DirectionDwellSeconds */
+    bool UpdateMovementDirection(float DeltaTime);
+
+    /** Close out load timings for requests that have completed */
+    void UpdateLoadTimings();
+
+    void BeginTransition(int32 FromCarIndex, int32 ToCarIndex);
+    void UpdateTransition(float DeltaTime);
+    void EndTransition(bool bTimedOut);
+
+    int64 GetCarPackageBytes(int32 CarIndex) const;
 
     UPROPERTY()
     TMap<int32, FName> CarLevelByIndex;
 
+    UPROPERTY()
+    TMap<int32, float> CarMemoryByIndex;
+
     UPROPERTY()
     TSet<int32> LoadedCars;
 
     UPROPERTY()
     int32 CurrentCarIndex = INDEX_NONE;
 
-    // 3-car window is sufficient even at 10x scale — larger cars mean
-    // longer traversal time, giving more streaming headroom.
+    // Replaces the old fixed 3-car window. The default fits the current car,
+    // both neighbours and one prefetch at the typical per-car footprint
+    // (docs/technical/car-streaming.md).
+    UPROPERTY()
+    float MemoryBudgetMB = 240.f;
+
     UPROPERTY()
-    int32 MaxLoadedCars = 3;
+    float DefaultCarMemoryMB = 60.f;
 
     UPROPERTY()
     bool bDoorLoadMaskActive = false;
 
     UPROPERTY()
     bool bRefreshPending = false;
+
+    /** +1 toward the engine (higher car index), -1 toward the tail, 0 unknown */
+    int32 MovementDirection = 0;
+
+    /** Time spent moving against MovementDirection */
+    float ReversedSeconds = 0.f;
+
+    int32 DoorApproachCarIndex = INDEX_NONE;
+    int32 TravelTargetCarIndex = INDEX_NONE;
+
+    /** Real time each outstanding load was requested */
+    TMap<int32, double> LoadRequestTimes;
+
+    /** Real time the player entered a car that was still loading */
+    TMap<int32, double> StallStartTimes;
+
+    TMap<int32, FSEECarLoadStats> LoadStatsByCar;
+
+    struct FActiveTransition
+    {
+        FSEECarTransitionRecord Record;
+        double StartTime = 0.0;
+        uint64 StartUsedPhysical = 0;
+    };
+
+    TOptional<FActiveTransition> ActiveTransition;
+    TArray<FSEECarTransitionRecord> TransitionLog;
 };
@@ -4,6 +4,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Exploration/CollectibleComponent.h"
+#include "Actors/SEECarDoorActor.h"
 #include "SEEHealthComponent.h"
 #include "SEEStatsComponent.h"
 #include "SEECombatComponent.h"
@@ -109,6 +110,14 @@ void ASEECharacter::Tick(float DeltaTime)
 			StopSprint();
 		}
 	}
+
+	const float StaminaPercent = MaxStamina > 0.0f ? CurrentStamina / MaxStamina : 0.0f;
+	const int32 StaminaStep = FMath::RoundToInt32(StaminaPercent * 100.0f);
+	if (StaminaStep != LastStaminaStep)
+	{
+		LastStaminaStep = StaminaStep;
+		OnStaminaChanged.Broadcast(StaminaPercent);
+	}
 }
 
 void ASEECharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -254,6 +263,12 @@ void ASEECharacter::Interact()
 				return;
 			}
 
+			if (ASEECarDoorActor* Door = Cast<ASEECarDoorActor>(HitActor))
+			{
+				Door->OpenDoor(this);
+				return;
+			}
+
 			// Generic interaction — call interface or delegate on hit actor
 			// Future: IInteractable interface check
 		}
@@ -14,6 +14,8 @@ class USEESkillTreeComponent;
 class UClimbingComponent;
 class USwimmingComponent;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStaminaChanged, float, StaminaPercent);
+
 UCLASS()
 class SNOWPIERCEREE_API ASEECharacter : public ACharacter
 {
@@ -64,6 +66,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stats")
 	float GetMaxStamina() const { return MaxStamina; }
 
+	/** Fires when stamina crosses a whole percent, not on every frame of drain or regen */
+	UPROPERTY(BlueprintAssignable, Category = "Stats")
+	FOnStaminaChanged OnStaminaChanged;
+
 	virtual void Tick(float DeltaTime) override;
 
 protected:
@@ -157,6 +163,7 @@ private:
 
 	float CurrentStamina = 100.0f;
 	float StaminaRegenTimer = 0.0f;
+	int32 LastStaminaStep = INDEX_NONE;
 	bool bIsRunning = false;
 	bool bFirstPersonActive = true;
 	bool bHeavyAttackCharging = false;
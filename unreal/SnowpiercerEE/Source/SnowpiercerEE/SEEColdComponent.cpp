@@ -3,65 +3,109 @@
 
 USEEColdComponent::USEEColdComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Simulated by USurvivalSimulationSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	CurrentTemperature = BodyTemperature;
 }
 
-void USEEColdComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void USEEColdComponent::BeginPlay()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::BeginPlay();
 
-	float PrevTemp = CurrentTemperature;
+	USurvivalSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USurvivalSimulationSubsystem>();
+	if (!Sim) return;
 
-	if (bInColdZone && !bNearFire)
-	{
-		float EffectiveCooling = CoolingRate * (1.0f - ColdSuitBonus);
-		CurrentTemperature = FMath::Max(ZoneTemperature, CurrentTemperature - EffectiveCooling * DeltaTime);
-	}
-	else
-	{
-		CurrentTemperature = FMath::Min(BodyTemperature, CurrentTemperature + WarmingRate * DeltaTime);
-	}
+	// Bands 1-3 are the frostbite stages
+	FSurvivalMeterDesc Desc;
+	Desc.Value = CurrentTemperature;
+	Desc.Ceiling = BodyTemperature;
+	Desc.RiseRate = WarmingRate;
+	Desc.Thresholds = { ShiverThreshold, NumbnessThreshold, BlackoutThreshold };
+	Desc.NotifyStep = 0.1f;
+	Desc.DamageBand = static_cast<int32>(ESEEFrostbiteStage::Blackout);
 
-	if (FMath::Abs(PrevTemp - CurrentTemperature) > 0.1f)
+	Simulation = Sim;
+	MeterHandle = Sim->RegisterMeter(this, this, Desc);
+	UpdateMeterMotion();
+}
+
+void USEEColdComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
 	{
-		OnTemperatureChanged.Broadcast(CurrentTemperature);
+		CurrentTemperature = Sim->GetMeterValue(MeterHandle);
+		Sim->UnregisterMeter(MeterHandle);
 	}
+	Simulation.Reset();
+	MeterHandle = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USEEColdComponent::OnMeterChanged(float NewValue)
+{
+	OnTemperatureChanged.Broadcast(NewValue);
+}
 
-	UpdateFrostbiteStage();
+void USEEColdComponent::OnMeterBandChanged(int32 OldBand, int32 NewBand)
+{
+	CurrentStage = static_cast<ESEEFrostbiteStage>(NewBand);
+	OnFrostbiteStageChanged.Broadcast(CurrentStage);
+}
 
+void USEEColdComponent::OnMeterDamageStep(float StepSeconds)
+{
 	// Blackout stage = health drain
-	if (CurrentStage == ESEEFrostbiteStage::Blackout)
+	if (AActor* Owner = GetOwner())
 	{
-		if (AActor* Owner = GetOwner())
+		if (USEEHealthComponent* Health = Owner->FindComponentByClass<USEEHealthComponent>())
 		{
-			if (USEEHealthComponent* Health = Owner->FindComponentByClass<USEEHealthComponent>())
-			{
-				Health->TakeDamage(BlackoutHealthDrain * DeltaTime, ESEEDamageType::Cold, nullptr);
-			}
+			Health->TakeDamage(BlackoutHealthDrain * StepSeconds, ESEEDamageType::Cold, nullptr);
 		}
 	}
 }
 
+float USEEColdComponent::GetTemperature() const
+{
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetMeterValue(MeterHandle) : CurrentTemperature;
+}
+
 void USEEColdComponent::EnterColdZone(float InZoneTemperature)
 {
+	const bool bWasInColdZone = bInColdZone;
 	bInColdZone = true;
 	ZoneTemperature = InZoneTemperature;
+	UpdateMeterMotion();
+
+	if (!bWasInColdZone)
+	{
+		OnColdZoneChanged.Broadcast(true);
+	}
 }
 
 void USEEColdComponent::ExitColdZone()
 {
+	const bool bWasInColdZone = bInColdZone;
 	bInColdZone = false;
+	UpdateMeterMotion();
+
+	if (bWasInColdZone)
+	{
+		OnColdZoneChanged.Broadcast(false);
+	}
 }
 
 void USEEColdComponent::SetNearFireSource(bool bNearFire_In)
 {
 	bNearFire = bNearFire_In;
+	UpdateMeterMotion();
 }
 
 void USEEColdComponent::SetColdSuitBonus(float Bonus)
 {
 	ColdSuitBonus = FMath::Clamp(Bonus, 0.0f, 0.9f);
+	UpdateMeterMotion();
 }
 
 float USEEColdComponent::GetMoveSpeedModifier() const
@@ -74,26 +118,12 @@ float USEEColdComponent::GetMoveSpeedModifier() const
 	}
 }
 
-void USEEColdComponent::UpdateFrostbiteStage()
+void USEEColdComponent::UpdateMeterMotion()
 {
-	ESEEFrostbiteStage NewStage = ESEEFrostbiteStage::None;
-
-	if (CurrentTemperature <= BlackoutThreshold)
-	{
-		NewStage = ESEEFrostbiteStage::Blackout;
-	}
-	else if (CurrentTemperature <= NumbnessThreshold)
-	{
-		NewStage = ESEEFrostbiteStage::Numbness;
-	}
-	else if (CurrentTemperature <= ShiverThreshold)
-	{
-		NewStage = ESEEFrostbiteStage::Shivers;
-	}
-
-	if (NewStage != CurrentStage)
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
 	{
-		CurrentStage = NewStage;
-		OnFrostbiteStageChanged.Broadcast(CurrentStage);
+		// Cools toward the zone temperature, otherwise warms back to body temperature
+		const float EffectiveCooling = CoolingRate * (1.0f - ColdSuitBonus);
+		Sim->SetMeterMotion(MeterHandle, bInColdZone && !bNearFire, ZoneTemperature, EffectiveCooling);
 	}
 }
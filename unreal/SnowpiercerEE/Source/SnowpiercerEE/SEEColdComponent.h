@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "SnowyEngine/Survival/SurvivalSimulationSubsystem.h"
 #include "SEEColdComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -15,16 +16,23 @@ enum class ESEEFrostbiteStage : uint8
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFrostbiteStageChanged, ESEEFrostbiteStage, NewStage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTemperatureChanged, float, Temperature);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnColdZoneChanged, bool, bInColdZone);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class SNOWPIERCEREE_API USEEColdComponent : public UActorComponent
+class SNOWPIERCEREE_API USEEColdComponent : public UActorComponent, public ISurvivalMeterClient
 {
 	GENERATED_BODY()
 
 public:
 	USEEColdComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Body temperature is a meter of USurvivalSimulationSubsystem; its bands are the frostbite stages
+	virtual void OnMeterChanged(float NewValue) override;
+	virtual void OnMeterBandChanged(int32 OldBand, int32 NewBand) override;
+	virtual void OnMeterDamageStep(float StepSeconds) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Cold")
 	void EnterColdZone(float ZoneTemperature = -30.0f);
@@ -39,7 +47,7 @@ public:
 	void SetColdSuitBonus(float Bonus);
 
 	UFUNCTION(BlueprintPure, Category = "Cold")
-	float GetTemperature() const { return CurrentTemperature; }
+	float GetTemperature() const;
 
 	UFUNCTION(BlueprintPure, Category = "Cold")
 	ESEEFrostbiteStage GetFrostbiteStage() const { return CurrentStage; }
@@ -56,6 +64,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Cold")
 	FOnTemperatureChanged OnTemperatureChanged;
 
+	UPROPERTY(BlueprintAssignable, Category = "Cold")
+	FOnColdZoneChanged OnColdZoneChanged;
+
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Cold")
 	float BodyTemperature = 37.0f;
@@ -86,5 +97,9 @@ private:
 	bool bNearFire = false;
 	ESEEFrostbiteStage CurrentStage = ESEEFrostbiteStage::None;
 
-	void UpdateFrostbiteStage();
+	TWeakObjectPtr<USurvivalSimulationSubsystem> Simulation;
+	int32 MeterHandle = INDEX_NONE;
+
+	/** Push zone, fire and suit changes to the simulated meter */
+	void UpdateMeterMotion();
 };
@@ -199,6 +199,7 @@ void USEECombatComponent::EquipWeapon(ASEEWeaponBase* Weapon)
 			Cast<ACharacter>(GetOwner())->GetMesh(),
 			FAttachmentTransformRules::SnapToTargetNotIncludingScale,
 			FName("weapon_r"));
+		OnWeaponChanged.Broadcast(EquippedWeapon);
 	}
 }
 
@@ -208,6 +209,7 @@ void USEECombatComponent::UnequipWeapon()
 	{
 		EquippedWeapon->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 		EquippedWeapon = nullptr;
+		OnWeaponChanged.Broadcast(nullptr);
 	}
 }
 
@@ -24,6 +24,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttackHit, AActor*, HitActor, fl
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnParrySuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBlockBroken);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombatStateChanged, ESEECombatState, NewState);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWeaponChanged, ASEEWeaponBase*, Weapon);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class SNOWPIERCEREE_API USEECombatComponent : public UActorComponent
@@ -91,6 +92,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Combat")
 	FOnCombatStateChanged OnCombatStateChanged;
 
+	/** Fires on equip and unequip; Weapon is null when unarmed */
+	UPROPERTY(BlueprintAssignable, Category = "Combat")
+	FOnWeaponChanged OnWeaponChanged;
+
 protected:
 	void SetCombatState(ESEECombatState NewState);
 	void PerformWeaponTrace(float DamageMultiplier);
@@ -3,7 +3,6 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "SEECharacterAnimInstance.h"
 
 ASEECompanionCharacter::ASEECompanionCharacter()
@@ -157,21 +156,20 @@ void ASEECompanionCharacter::UpdateCompanionCombat(float DeltaTime)
 		if (!PlayerPawn) return;
 
 		// Only auto-engage enemies near the player
-		TArray<AActor*> NearbyActors;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASEENPCCharacter::StaticClass(), NearbyActors);
+		UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+		if (!PawnQuery) return;
 
-		for (AActor* Actor : NearbyActors)
+		TArray<APawn*> NearbyPawns;
+		PawnQuery->QueryRadius(GetActorLocation(), AggressiveEngageRange, EPawnQueryTag::NPC, NearbyPawns, this);
+
+		for (APawn* Pawn : NearbyPawns)
 		{
-			ASEENPCCharacter* OtherNPC = Cast<ASEENPCCharacter>(Actor);
-			if (OtherNPC && OtherNPC != this && OtherNPC->GetCurrentState() == ENPCAIState::Combat)
+			ASEENPCCharacter* OtherNPC = Cast<ASEENPCCharacter>(Pawn);
+			if (OtherNPC && OtherNPC->GetCurrentState() == ENPCAIState::Combat)
 			{
-				float DistToNPC = FVector::Dist(GetActorLocation(), OtherNPC->GetActorLocation());
-				if (DistToNPC <= AggressiveEngageRange)
-				{
-					CommandedTarget = OtherNPC;
-					SetState(ENPCAIState::Combat);
-					return;
-				}
+				CommandedTarget = OtherNPC;
+				SetState(ENPCAIState::Combat);
+				return;
 			}
 		}
 	}
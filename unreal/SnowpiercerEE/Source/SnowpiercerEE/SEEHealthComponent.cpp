@@ -121,12 +121,20 @@ void USEEHealthComponent::ApplyInjury(ESEEInjuryType InjuryType, float Severity)
 
 void USEEHealthComponent::HealInjury(ESEEInjuryType InjuryType)
 {
-	ActiveInjuries.RemoveAll([InjuryType](const FSEEInjury& Injury) { return Injury.Type == InjuryType; });
+	if (ActiveInjuries.RemoveAll([InjuryType](const FSEEInjury& Injury) { return Injury.Type == InjuryType; }) > 0)
+	{
+		OnInjuryHealed.Broadcast(InjuryType);
+	}
 }
 
 void USEEHealthComponent::HealAllInjuries()
 {
-	ActiveInjuries.Empty();
+	TArray<FSEEInjury> Healed = MoveTemp(ActiveInjuries);
+	ActiveInjuries.Reset();
+	for (const FSEEInjury& Injury : Healed)
+	{
+		OnInjuryHealed.Broadcast(Injury.Type);
+	}
 }
 
 bool USEEHealthComponent::HasInjury(ESEEInjuryType InjuryType) const
@@ -47,6 +47,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeath);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDowned);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRevived);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInjuryApplied, ESEEInjuryType, InjuryType);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInjuryHealed, ESEEInjuryType, InjuryType);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHealthChanged, float, NewHealthPercent);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -125,6 +126,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Health")
 	FOnInjuryApplied OnInjuryApplied;
 
+	UPROPERTY(BlueprintAssignable, Category = "Health")
+	FOnInjuryHealed OnInjuryHealed;
+
 	UPROPERTY(BlueprintAssignable, Category = "Health")
 	FOnHealthChanged OnHealthChanged;
 
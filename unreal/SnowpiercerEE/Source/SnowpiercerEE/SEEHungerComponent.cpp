@@ -3,55 +3,94 @@
 
 USEEHungerComponent::USEEHungerComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Drained by USurvivalSimulationSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	CurrentHunger = MaxHunger;
 }
 
-void USEEHungerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void USEEHungerComponent::BeginPlay()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::BeginPlay();
 
-	float PrevHunger = CurrentHunger;
-	CurrentHunger = FMath::Max(0.0f, CurrentHunger - DrainRate * DeltaTime);
+	USurvivalSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USurvivalSimulationSubsystem>();
+	if (!Sim) return;
 
-	// Notify on threshold crossings
-	if (PrevHunger > 0.0f && CurrentHunger <= 0.0f)
+	FSurvivalMeterDesc Desc;
+	Desc.Value = CurrentHunger;
+	Desc.Floor = 0.0f;
+	Desc.Ceiling = MaxHunger;
+	Desc.FallRate = DrainRate;
+	Desc.bFalling = true;
+	Desc.Thresholds = { 0.0f };			// Band 1 = starving
+	Desc.NotifyStep = MaxHunger / 100.0f;	// Broadcast changes at meaningful intervals
+	Desc.DamageBand = 1;
+
+	Simulation = Sim;
+	MeterHandle = Sim->RegisterMeter(this, this, Desc);
+}
+
+void USEEHungerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
 	{
-		OnStarving.Broadcast();
+		CurrentHunger = Sim->GetMeterValue(MeterHandle);
+		Sim->UnregisterMeter(MeterHandle);
 	}
+	Simulation.Reset();
+	MeterHandle = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USEEHungerComponent::OnMeterChanged(float NewValue)
+{
+	OnHungerChanged.Broadcast(GetHungerPercent());
+}
 
-	// Broadcast changes at meaningful intervals
-	float PrevPercent = FMath::FloorToFloat(PrevHunger / MaxHunger * 100.0f);
-	float CurrPercent = FMath::FloorToFloat(CurrentHunger / MaxHunger * 100.0f);
-	if (PrevPercent != CurrPercent)
+void USEEHungerComponent::OnMeterBandChanged(int32 OldBand, int32 NewBand)
+{
+	if (OldBand == 0 && NewBand > 0)
 	{
-		OnHungerChanged.Broadcast(GetHungerPercent());
+		OnStarving.Broadcast();
 	}
+}
 
+void USEEHungerComponent::OnMeterDamageStep(float StepSeconds)
+{
 	// Starving = HP drain
-	if (CurrentHunger <= 0.0f)
+	if (USEEHealthComponent* Health = GetOwner()->FindComponentByClass<USEEHealthComponent>())
 	{
-		if (USEEHealthComponent* Health = GetOwner()->FindComponentByClass<USEEHealthComponent>())
-		{
-			Health->TakeDamage(StarvingHealthDrain * DeltaTime, ESEEDamageType::Environmental, nullptr);
-		}
+		Health->TakeDamage(StarvingHealthDrain * StepSeconds, ESEEDamageType::Environmental, nullptr);
 	}
 }
 
+float USEEHungerComponent::GetCurrentHunger() const
+{
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetMeterValue(MeterHandle) : CurrentHunger;
+}
+
 void USEEHungerComponent::Eat(float Amount)
 {
-	CurrentHunger = FMath::Min(MaxHunger, CurrentHunger + Amount);
+	const float NewHunger = FMath::Min(MaxHunger, GetCurrentHunger() + Amount);
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
+	{
+		Sim->SetMeterValue(MeterHandle, NewHunger);
+		return;
+	}
+
+	CurrentHunger = NewHunger;
 	OnHungerChanged.Broadcast(GetHungerPercent());
 }
 
 float USEEHungerComponent::GetStaminaRegenModifier() const
 {
-	if (CurrentHunger / MaxHunger <= 0.5f) return 0.5f;
+	if (GetCurrentHunger() / MaxHunger <= 0.5f) return 0.5f;
 	return 1.0f;
 }
 
 float USEEHungerComponent::GetMaxStaminaModifier() const
 {
-	if (CurrentHunger / MaxHunger <= 0.25f) return 0.7f;
+	if (GetCurrentHunger() / MaxHunger <= 0.25f) return 0.7f;
 	return 1.0f;
 }
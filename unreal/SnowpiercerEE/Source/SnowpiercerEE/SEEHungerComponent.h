@@ -2,29 +2,36 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "SnowyEngine/Survival/SurvivalSimulationSubsystem.h"
 #include "SEEHungerComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHungerChanged, float, HungerPercent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnStarving);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class SNOWPIERCEREE_API USEEHungerComponent : public UActorComponent
+class SNOWPIERCEREE_API USEEHungerComponent : public UActorComponent, public ISurvivalMeterClient
 {
 	GENERATED_BODY()
 
 public:
 	USEEHungerComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Hunger drains as a meter of USurvivalSimulationSubsystem
+	virtual void OnMeterChanged(float NewValue) override;
+	virtual void OnMeterBandChanged(int32 OldBand, int32 NewBand) override;
+	virtual void OnMeterDamageStep(float StepSeconds) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Hunger")
 	void Eat(float Amount);
 
 	UFUNCTION(BlueprintPure, Category = "Hunger")
-	float GetHungerPercent() const { return MaxHunger > 0.0f ? CurrentHunger / MaxHunger : 0.0f; }
+	float GetHungerPercent() const { return MaxHunger > 0.0f ? GetCurrentHunger() / MaxHunger : 0.0f; }
 
 	UFUNCTION(BlueprintPure, Category = "Hunger")
-	float GetCurrentHunger() const { return CurrentHunger; }
+	float GetCurrentHunger() const;
 
 	UFUNCTION(BlueprintPure, Category = "Hunger")
 	float GetStaminaRegenModifier() const;
@@ -33,7 +40,7 @@ public:
 	float GetMaxStaminaModifier() const;
 
 	UFUNCTION(BlueprintPure, Category = "Hunger")
-	bool IsStarving() const { return CurrentHunger <= 0.0f; }
+	bool IsStarving() const { return GetCurrentHunger() <= 0.0f; }
 
 	UPROPERTY(BlueprintAssignable, Category = "Hunger")
 	FOnHungerChanged OnHungerChanged;
@@ -53,4 +60,8 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hunger")
 	float StarvingHealthDrain = 1.0f;
+
+private:
+	TWeakObjectPtr<USurvivalSimulationSubsystem> Simulation;
+	int32 MeterHandle = INDEX_NONE;
 };
@@ -3,7 +3,6 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "SEECharacterAnimInstance.h"
 
 ASEEJackbootCharacter::ASEEJackbootCharacter()
@@ -101,19 +100,18 @@ void ASEEJackbootCharacter::AttachToWeaponSocket(AActor* ActorToAttach)
 
 void ASEEJackbootCharacter::AlertNearbyJackboots()
 {
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASEEJackbootCharacter::StaticClass(), FoundActors);
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery) return;
 
-	for (AActor* Actor : FoundActors)
+	TArray<APawn*> NearbyPawns;
+	PawnQuery->QueryRadius(GetActorLocation(), ReinforcementAlertRadius, EPawnQueryTag::Jackboot, NearbyPawns, this);
+
+	for (APawn* Pawn : NearbyPawns)
 	{
-		ASEEJackbootCharacter* OtherJackboot = Cast<ASEEJackbootCharacter>(Actor);
-		if (OtherJackboot && OtherJackboot != this)
+		ASEEJackbootCharacter* OtherJackboot = Cast<ASEEJackbootCharacter>(Pawn);
+		if (OtherJackboot && OtherJackboot->GetCurrentState() != ENPCAIState::Dead)
 		{
-			float Distance = FVector::Dist(GetActorLocation(), OtherJackboot->GetActorLocation());
-			if (Distance <= ReinforcementAlertRadius && OtherJackboot->GetCurrentState() != ENPCAIState::Dead)
-			{
-				OtherJackboot->SetState(ENPCAIState::Chasing);
-			}
+			OtherJackboot->SetState(ENPCAIState::Chasing);
 		}
 	}
 }
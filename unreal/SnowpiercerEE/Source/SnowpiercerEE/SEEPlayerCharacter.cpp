@@ -4,6 +4,13 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "SEEHealthComponent.h"
 #include "SEECharacterAnimInstance.h"
+#include "SEEFactionManager.h"
+#include "Engine/GameInstance.h"
+#include "TrainGame/Economy/BarterComponent.h"
+
+// HandleFactionRepChanged casts ESEEFaction straight to EFaction
+static_assert(static_cast<int32>(ESEEFaction::Neutral) == static_cast<int32>(EFaction::None), "ESEEFaction must mirror EFaction");
+static_assert(static_cast<int32>(ESEEFaction::TheThaw) == static_cast<int32>(EFaction::TheThaw), "ESEEFaction must mirror EFaction");
 
 ASEEPlayerCharacter::ASEEPlayerCharacter()
 {
@@ -23,6 +30,43 @@ void ASEEPlayerCharacter::BeginPlay()
 		HealthComponent->OnDamageTaken.AddDynamic(this, &ASEEPlayerCharacter::OnDamageTaken);
 		HealthComponent->OnDeath.AddDynamic(this, &ASEEPlayerCharacter::ActivateDeathRagdoll);
 	}
+
+	// Barter prices track faction reputation
+	BarterComponent = FindComponentByClass<UBarterComponent>();
+	UGameInstance* GI = GetGameInstance();
+	USEEFactionManager* FactionManager = GI ? GI->GetSubsystem<USEEFactionManager>() : nullptr;
+	if (BarterComponent.IsValid() && FactionManager)
+	{
+		for (int32 Faction = 0; Faction <= static_cast<int32>(ESEEFaction::TheThaw); ++Faction)
+		{
+			const ESEEFaction SEEFaction = static_cast<ESEEFaction>(Faction);
+			HandleFactionRepChanged(SEEFaction, FactionManager->GetReputation(SEEFaction));
+		}
+		FactionManager->OnFactionRepChanged.AddDynamic(this, &ASEEPlayerCharacter::HandleFactionRepChanged);
+	}
+}
+
+void ASEEPlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The faction manager outlives this pawn across respawns and level travel
+	UGameInstance* GI = GetGameInstance();
+	if (USEEFactionManager* FactionManager = GI ? GI->GetSubsystem<USEEFactionManager>() : nullptr)
+	{
+		FactionManager->OnFactionRepChanged.RemoveDynamic(this, &ASEEPlayerCharacter::HandleFactionRepChanged);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASEEPlayerCharacter::HandleFactionRepChanged(ESEEFaction Faction, int32 NewRep)
+{
+	UGameInstance* GI = GetGameInstance();
+	USEEFactionManager* FactionManager = GI ? GI->GetSubsystem<USEEFactionManager>() : nullptr;
+	if (BarterComponent.IsValid() && FactionManager)
+	{
+		// ESEEFaction mirrors EFaction value for value (Neutral <-> None)
+		BarterComponent->SetFactionPriceModifier(static_cast<EFaction>(Faction), FactionManager->GetPriceModifier(Faction));
+	}
 }
 
 void ASEEPlayerCharacter::OnDamageTaken(float Damage, ESEEDamageType DamageType, AActor* DamageInstigator)
@@ -4,8 +4,11 @@
 #include "SEECharacter.h"
 #include "SEEHealthComponent.h"
 #include "SEECharacterAnimInstance.h"
+#include "SEETypes.h"
 #include "SEEPlayerCharacter.generated.h"
 
+class UBarterComponent;
+
 /**
  * Player character with skeletal mesh, weapon socket, and hit reaction support.
  * Create a Blueprint extending this class and assign the UE5 Mannequin
@@ -24,6 +27,7 @@ public:
 	ASEEPlayerCharacter();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// --- Hit Reactions ---
 
@@ -56,6 +60,10 @@ public:
 protected:
 	void OnDamageTaken(float Damage, ESEEDamageType DamageType, AActor* DamageInstigator);
 
+	/** Feed a faction's price modifier to the barter price cache (TrainGame can't see the faction manager) */
+	UFUNCTION()
+	void HandleFactionRepChanged(ESEEFaction Faction, int32 NewRep);
+
 	/** Knockback impulse strength */
 	UPROPERTY(EditDefaultsOnly, Category = "HitReaction")
 	float KnockbackImpulse = 600.0f;
@@ -72,5 +80,7 @@ private:
 	bool bInHitReaction = false;
 	FTimerHandle StaggerRecoveryTimer;
 
+	TWeakObjectPtr<UBarterComponent> BarterComponent;
+
 	void EndStagger();
 };
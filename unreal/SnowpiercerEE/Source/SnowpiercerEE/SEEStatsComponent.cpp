@@ -14,20 +14,24 @@ USEEStatsComponent::USEEStatsComponent()
 
 int32 USEEStatsComponent::GetStat(ESEEStat Stat) const
 {
-	int32 Base = BaseStats.Contains(Stat) ? BaseStats[Stat] : 5;
-	int32 Mod = StatModifiers.Contains(Stat) ? StatModifiers[Stat] : 0;
-	return FMath::Clamp(Base + Mod, 1, MaxStatValue);
+	if (!bStatCacheValid)
+	{
+		RebuildStatCache();
+	}
+	return CachedStats[static_cast<int32>(Stat)];
 }
 
 void USEEStatsComponent::SetStat(ESEEStat Stat, int32 Value)
 {
 	BaseStats.FindOrAdd(Stat) = FMath::Clamp(Value, 1, MaxStatValue);
+	bStatCacheValid = false;
 	OnStatChanged.Broadcast(Stat, GetStat(Stat));
 }
 
 void USEEStatsComponent::ModifyStat(ESEEStat Stat, int32 Delta)
 {
 	StatModifiers.FindOrAdd(Stat) += Delta;
+	bStatCacheValid = false;
 	OnStatChanged.Broadcast(Stat, GetStat(Stat));
 }
 
@@ -49,6 +53,7 @@ void USEEStatsComponent::AddXP(int32 Amount)
 		OnLevelUp.Broadcast(CurrentLevel, AvailableSkillPoints);
 		Required = GetXPToNextLevel();
 	}
+	OnXPChanged.Broadcast(CurrentXP, Required);
 }
 
 int32 USEEStatsComponent::GetXPToNextLevel() const
@@ -64,6 +69,7 @@ bool USEEStatsComponent::SpendSkillPoint(ESEEStat Stat)
 
 	AvailableSkillPoints--;
 	BaseStats.FindOrAdd(Stat) = Current + 1;
+	bStatCacheValid = false;
 	OnStatChanged.Broadcast(Stat, GetStat(Stat));
 	return true;
 }
@@ -72,3 +78,23 @@ bool USEEStatsComponent::PassesSkillCheck(ESEEStat Stat, int32 Difficulty) const
 {
 	return GetStat(Stat) >= Difficulty;
 }
+
+#if WITH_EDITOR
+void USEEStatsComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bStatCacheValid = false;
+}
+#endif
+
+void USEEStatsComponent::RebuildStatCache() const
+{
+	for (int32 Index = 0; Index < NumSEEStats; ++Index)
+	{
+		const ESEEStat Stat = static_cast<ESEEStat>(Index);
+		const int32* Base = BaseStats.Find(Stat);
+		const int32* Mod = StatModifiers.Find(Stat);
+		CachedStats[Index] = FMath::Clamp((Base ? *Base : 5) + (Mod ? *Mod : 0), 1, MaxStatValue);
+	}
+	bStatCacheValid = true;
+}
@@ -15,8 +15,11 @@ enum class ESEEStat : uint8
 	Charisma		UMETA(DisplayName = "Charisma")
 };
 
+constexpr int32 NumSEEStats = 6;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatChanged, ESEEStat, Stat, int32, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLevelUp, int32, NewLevel, int32, SkillPointsAvailable);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnXPChanged, int32, CurrentXP, int32, XPToNextLevel);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class SNOWPIERCEREE_API USEEStatsComponent : public UActorComponent
@@ -65,6 +68,13 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Stats")
 	FOnLevelUp OnLevelUp;
 
+	UPROPERTY(BlueprintAssignable, Category = "Stats")
+	FOnXPChanged OnXPChanged;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	TMap<ESEEStat, int32> BaseStats;
@@ -89,4 +99,12 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	float XPScaleFactor = 1.5f;
+
+private:
+	// Clamped base + modifier per stat, so combat, stealth and dialogue checks
+	// index an array instead of probing both maps. Rebuilt lazily after any change.
+	void RebuildStatCache() const;
+
+	mutable int32 CachedStats[NumSEEStats] = {};
+	mutable bool bStatCacheValid = false;
 };
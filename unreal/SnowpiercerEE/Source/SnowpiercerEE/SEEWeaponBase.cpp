@@ -20,10 +20,20 @@ void ASEEWeaponBase::BeginPlay()
 
 void ASEEWeaponBase::DegradeDurability(float Amount)
 {
+	const float OldDurability = CurrentDurability;
 	CurrentDurability = FMath::Max(0.0f, CurrentDurability - Amount);
+	if (CurrentDurability != OldDurability)
+	{
+		OnDurabilityChanged.Broadcast(GetDurabilityPercent());
+	}
 }
 
 void ASEEWeaponBase::Repair(float Amount)
 {
+	const float OldDurability = CurrentDurability;
 	CurrentDurability = FMath::Min(MaxDurability, CurrentDurability + Amount);
+	if (CurrentDurability != OldDurability)
+	{
+		OnDurabilityChanged.Broadcast(GetDurabilityPercent());
+	}
 }
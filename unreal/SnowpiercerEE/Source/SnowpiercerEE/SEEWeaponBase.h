@@ -15,6 +15,8 @@ enum class ESEEWeaponTier : uint8
 	Legendary		UMETA(DisplayName = "Legendary")
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDurabilityChanged, float, DurabilityPercent);
+
 UCLASS()
 class SNOWPIERCEREE_API ASEEWeaponBase : public AActor
 {
@@ -47,6 +49,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Weapon")
 	void Repair(float Amount);
 
+	UPROPERTY(BlueprintAssignable, Category = "Weapon")
+	FOnDurabilityChanged OnDurabilityChanged;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weapon")
 	FText WeaponName;
 
@@ -2,6 +2,7 @@
 
 #include "MiniRailCart.h"
 #include "TransportDeckSubsystem.h"
+#include "SnowpiercerEE/SEECarStreamingSubsystem.h"
 #include "EngineUtils.h"
 
 AMiniRailCart::AMiniRailCart()
@@ -105,16 +106,23 @@ void AMiniRailCart::SetRoute(const TArray<FName>& NewRoute)
 	{
 		CurrentSegmentID = Route[0];
 	}
+
+	if (bPlayerOnBoard)
+	{
+		UpdateStreamingTravelTarget();
+	}
 }
 
 void AMiniRailCart::OnPlayerBoard()
 {
 	bPlayerOnBoard = true;
+	UpdateStreamingTravelTarget();
 }
 
 void AMiniRailCart::OnPlayerDismount()
 {
 	bPlayerOnBoard = false;
+	UpdateStreamingTravelTarget();
 }
 
 float AMiniRailCart::GetCurrentNoiseRadius() const
@@ -227,6 +235,26 @@ void AMiniRailCart::UpdateMovement(float DeltaTime)
 	}
 }
 
+void AMiniRailCart::UpdateStreamingTravelTarget()
+{
+	UWorld* World = GetWorld();
+	USEECarStreamingSubsystem* Streaming = World ? World->GetSubsystem<USEECarStreamingSubsystem>() : nullptr;
+	if (!Streaming)
+	{
+		return;
+	}
+
+	// Prefetch the car at the end of the route while the player rides
+	int32 TargetCarIndex = INDEX_NONE;
+	UTransportDeckSubsystem* DeckSubsystem = World->GetSubsystem<UTransportDeckSubsystem>();
+	FTrackSegment LastSegment;
+	if (bPlayerOnBoard && Route.Num() > 0 && DeckSubsystem && DeckSubsystem->GetTrackSegment(Route.Last(), LastSegment))
+	{
+		TargetCarIndex = LastSegment.CarIndex;
+	}
+	Streaming->SetTravelTarget(TargetCarIndex);
+}
+
 void AMiniRailCart::UpdateCarTracking()
 {
 	float XPos = GetActorLocation().X;
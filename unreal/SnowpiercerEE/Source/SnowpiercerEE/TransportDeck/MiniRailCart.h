@@ -136,6 +136,7 @@ protected:
 private:
 	void UpdateMovement(float DeltaTime);
 	void UpdateCarTracking();
+	void UpdateStreamingTravelTarget();
 	void GenerateMovementNoise();
 
 	/** Assigned route segments */
@@ -10,6 +10,11 @@
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("SEE HUD"), STATGROUP_SEEHUD, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("HUD Tick"), STAT_SEEHUDTick, STATGROUP_SEEHUD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("HUD Section Updates"), STAT_SEEHUDUpdates, STATGROUP_SEEHUD);
 
 void USEEGameHUDWidget::NativeConstruct()
 {
@@ -25,10 +30,18 @@ void USEEGameHUDWidget::NativeConstruct()
 	}
 }
 
+void USEEGameHUDWidget::NativeDestruct()
+{
+	UnbindComponents();
+	Super::NativeDestruct();
+}
+
 void USEEGameHUDWidget::InitializeHUD(ASEECharacter* Character)
 {
 	if (!Character) return;
 
+	UnbindComponents();
+
 	CachedCharacter = Character;
 	HealthComp = Character->FindComponentByClass<USEEHealthComponent>();
 	HungerComp = Character->FindComponentByClass<USEEHungerComponent>();
@@ -36,6 +49,9 @@ void USEEGameHUDWidget::InitializeHUD(ASEECharacter* Character)
 	CombatComp = Character->FindComponentByClass<USEECombatComponent>();
 	StatsComp = Character->FindComponentByClass<USEEStatsComponent>();
 
+	BindComponents();
+	MarkDirty(ESEEHUDDirty::All);
+
 	OnHUDInitialized();
 }
 
@@ -43,14 +59,25 @@ void USEEGameHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTim
 {
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
+	SCOPE_CYCLE_COUNTER(STAT_SEEHUDTick);
+
 	if (!CachedCharacter.IsValid()) return;
 
-	UpdateHealthDisplay();
-	UpdateStaminaDisplay();
-	UpdateHungerDisplay();
-	UpdateColdDisplay();
-	UpdateWeaponDisplay();
-	UpdateXPDisplay();
+	// Several events in one frame collapse into a single redraw per section
+	if (DirtyFlags != ESEEHUDDirty::None)
+	{
+		const ESEEHUDDirty Dirty = DirtyFlags;
+		DirtyFlags = ESEEHUDDirty::None;
+
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::Health)) UpdateHealthDisplay();
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::Injuries)) UpdateInjuryDisplay();
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::Stamina)) UpdateStaminaDisplay();
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::Hunger)) UpdateHungerDisplay();
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::Cold)) UpdateColdDisplay();
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::Weapon)) UpdateWeaponDisplay();
+		if (EnumHasAnyFlags(Dirty, ESEEHUDDirty::XP)) UpdateXPDisplay();
+	}
+
 	UpdateDamageVignette(InDeltaTime);
 
 	// Notification timer
@@ -64,26 +91,183 @@ void USEEGameHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTim
 	}
 }
 
+// --- Component Events ---
+
+void USEEGameHUDWidget::BindComponents()
+{
+	if (HealthComp.IsValid())
+	{
+		HealthComp->OnHealthChanged.AddDynamic(this, &USEEGameHUDWidget::HandleHealthChanged);
+		HealthComp->OnInjuryApplied.AddDynamic(this, &USEEGameHUDWidget::HandleInjuriesChanged);
+		HealthComp->OnInjuryHealed.AddDynamic(this, &USEEGameHUDWidget::HandleInjuriesChanged);
+	}
+	if (CachedCharacter.IsValid())
+	{
+		CachedCharacter->OnStaminaChanged.AddDynamic(this, &USEEGameHUDWidget::HandleStaminaChanged);
+	}
+	if (HungerComp.IsValid())
+	{
+		HungerComp->OnHungerChanged.AddDynamic(this, &USEEGameHUDWidget::HandleHungerChanged);
+	}
+	if (ColdComp.IsValid())
+	{
+		ColdComp->OnTemperatureChanged.AddDynamic(this, &USEEGameHUDWidget::HandleTemperatureChanged);
+		ColdComp->OnFrostbiteStageChanged.AddDynamic(this, &USEEGameHUDWidget::HandleFrostbiteStageChanged);
+		ColdComp->OnColdZoneChanged.AddDynamic(this, &USEEGameHUDWidget::HandleColdZoneChanged);
+	}
+	if (CombatComp.IsValid())
+	{
+		CombatComp->OnWeaponChanged.AddDynamic(this, &USEEGameHUDWidget::HandleWeaponChanged);
+		BindWeapon(CombatComp->GetEquippedWeapon());
+	}
+	if (StatsComp.IsValid())
+	{
+		StatsComp->OnXPChanged.AddDynamic(this, &USEEGameHUDWidget::HandleXPChanged);
+		StatsComp->OnLevelUp.AddDynamic(this, &USEEGameHUDWidget::HandleLevelUp);
+	}
+}
+
+void USEEGameHUDWidget::UnbindComponents()
+{
+	if (HealthComp.IsValid())
+	{
+		HealthComp->OnHealthChanged.RemoveAll(this);
+		HealthComp->OnInjuryApplied.RemoveAll(this);
+		HealthComp->OnInjuryHealed.RemoveAll(this);
+	}
+	if (CachedCharacter.IsValid())
+	{
+		CachedCharacter->OnStaminaChanged.RemoveAll(this);
+	}
+	if (HungerComp.IsValid())
+	{
+		HungerComp->OnHungerChanged.RemoveAll(this);
+	}
+	if (ColdComp.IsValid())
+	{
+		ColdComp->OnTemperatureChanged.RemoveAll(this);
+		ColdComp->OnFrostbiteStageChanged.RemoveAll(this);
+		ColdComp->OnColdZoneChanged.RemoveAll(this);
+	}
+	if (CombatComp.IsValid())
+	{
+		CombatComp->OnWeaponChanged.RemoveAll(this);
+	}
+	if (StatsComp.IsValid())
+	{
+		StatsComp->OnXPChanged.RemoveAll(this);
+		StatsComp->OnLevelUp.RemoveAll(this);
+	}
+	BindWeapon(nullptr);
+}
+
+void USEEGameHUDWidget::BindWeapon(ASEEWeaponBase* Weapon)
+{
+	if (BoundWeapon.Get() == Weapon) return;
+
+	if (BoundWeapon.IsValid())
+	{
+		BoundWeapon->OnDurabilityChanged.RemoveAll(this);
+	}
+	BoundWeapon = Weapon;
+	if (Weapon)
+	{
+		Weapon->OnDurabilityChanged.AddDynamic(this, &USEEGameHUDWidget::HandleDurabilityChanged);
+	}
+}
+
+void USEEGameHUDWidget::HandleHealthChanged(float NewHealthPercent)
+{
+	MarkDirty(ESEEHUDDirty::Health);
+}
+
+void USEEGameHUDWidget::HandleInjuriesChanged(ESEEInjuryType InjuryType)
+{
+	MarkDirty(ESEEHUDDirty::Injuries);
+}
+
+void USEEGameHUDWidget::HandleStaminaChanged(float StaminaPercent)
+{
+	MarkDirty(ESEEHUDDirty::Stamina);
+}
+
+void USEEGameHUDWidget::HandleHungerChanged(float HungerPercent)
+{
+	MarkDirty(ESEEHUDDirty::Hunger);
+}
+
+void USEEGameHUDWidget::HandleTemperatureChanged(float Temperature)
+{
+	MarkDirty(ESEEHUDDirty::Cold);
+}
+
+void USEEGameHUDWidget::HandleFrostbiteStageChanged(ESEEFrostbiteStage NewStage)
+{
+	MarkDirty(ESEEHUDDirty::Cold);
+}
+
+void USEEGameHUDWidget::HandleColdZoneChanged(bool bInColdZone)
+{
+	MarkDirty(ESEEHUDDirty::Cold);
+}
+
+void USEEGameHUDWidget::HandleWeaponChanged(ASEEWeaponBase* Weapon)
+{
+	BindWeapon(Weapon);
+	MarkDirty(ESEEHUDDirty::Weapon);
+}
+
+void USEEGameHUDWidget::HandleDurabilityChanged(float DurabilityPercent)
+{
+	MarkDirty(ESEEHUDDirty::Weapon);
+}
+
+void USEEGameHUDWidget::HandleXPChanged(int32 CurrentXP, int32 XPToNextLevel)
+{
+	MarkDirty(ESEEHUDDirty::XP);
+}
+
+void USEEGameHUDWidget::HandleLevelUp(int32 NewLevel, int32 SkillPointsAvailable)
+{
+	MarkDirty(ESEEHUDDirty::XP);
+}
+
+// --- Sections ---
+
 void USEEGameHUDWidget::UpdateHealthDisplay()
 {
 	if (!HealthComp.IsValid()) return;
 
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
+
 	float Percent = HealthComp->GetHealthPercent();
 
-	if (HealthBar)
+	if (HealthBar && Percent != ShownHealthPercent)
 	{
+		ShownHealthPercent = Percent;
 		HealthBar->SetPercent(Percent);
 		FLinearColor Color = FMath::Lerp(FLinearColor::Red, FLinearColor::Green, Percent);
 		HealthBar->SetFillColorAndOpacity(Color);
 	}
 
-	if (HealthText)
+	const int32 Health = FMath::RoundToInt32(HealthComp->GetCurrentHealth());
+	const int32 MaxHealth = FMath::RoundToInt32(HealthComp->GetMaxHealth());
+	if (HealthText && (Health != ShownHealth || MaxHealth != ShownMaxHealth))
 	{
+		ShownHealth = Health;
+		ShownMaxHealth = MaxHealth;
 		HealthText->SetText(FText::Format(
 			NSLOCTEXT("HUD", "HP", "HP: {0}/{1}"),
-			FText::AsNumber(FMath::RoundToInt32(HealthComp->GetCurrentHealth())),
-			FText::AsNumber(FMath::RoundToInt32(HealthComp->GetMaxHealth()))));
+			FText::AsNumber(Health),
+			FText::AsNumber(MaxHealth)));
 	}
+}
+
+void USEEGameHUDWidget::UpdateInjuryDisplay()
+{
+	if (!HealthComp.IsValid()) return;
+
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
 
 	if (InjuryText)
 	{
@@ -117,7 +301,12 @@ void USEEGameHUDWidget::UpdateStaminaDisplay()
 {
 	if (!CachedCharacter.IsValid() || !StaminaBar) return;
 
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
+
 	float Percent = CachedCharacter->GetStamina() / CachedCharacter->GetMaxStamina();
+	if (Percent == ShownStaminaPercent) return;
+
+	ShownStaminaPercent = Percent;
 	StaminaBar->SetPercent(Percent);
 
 	FLinearColor Color = Percent < 0.25f
@@ -130,6 +319,8 @@ void USEEGameHUDWidget::UpdateHungerDisplay()
 {
 	if (!HungerComp.IsValid()) return;
 
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
+
 	float Percent = HungerComp->GetHungerPercent();
 	bool bShow = Percent < 0.75f;
 
@@ -149,11 +340,13 @@ void USEEGameHUDWidget::UpdateHungerDisplay()
 	if (HungerText)
 	{
 		HungerText->SetVisibility(bShow ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
-		if (bShow)
+		const int32 HungerPercent = FMath::RoundToInt32(Percent * 100.0f);
+		if (bShow && HungerPercent != ShownHungerPercent)
 		{
+			ShownHungerPercent = HungerPercent;
 			HungerText->SetText(FText::Format(
 				NSLOCTEXT("HUD", "Hunger", "Hunger: {0}%"),
-				FText::AsNumber(FMath::RoundToInt32(Percent * 100.0f))));
+				FText::AsNumber(HungerPercent)));
 		}
 	}
 }
@@ -162,6 +355,8 @@ void USEEGameHUDWidget::UpdateColdDisplay()
 {
 	if (!ColdComp.IsValid() || !ColdText) return;
 
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
+
 	if (!ColdComp->IsInColdZone())
 	{
 		ColdText->SetVisibility(ESlateVisibility::Collapsed);
@@ -170,7 +365,12 @@ void USEEGameHUDWidget::UpdateColdDisplay()
 
 	ColdText->SetVisibility(ESlateVisibility::HitTestInvisible);
 	ESEEFrostbiteStage Stage = ColdComp->GetFrostbiteStage();
-	float Temp = ColdComp->GetTemperature();
+	const int32 Temp = FMath::RoundToInt32(ColdComp->GetTemperature());
+
+	// Temperature events arrive every tenth of a degree; the text shows whole degrees
+	if (Temp == ShownTemperature && Stage == ShownFrostbiteStage) return;
+	ShownTemperature = Temp;
+	ShownFrostbiteStage = Stage;
 
 	FString StageStr;
 	FSlateColor Color;
@@ -194,7 +394,7 @@ void USEEGameHUDWidget::UpdateColdDisplay()
 		break;
 	}
 
-	ColdText->SetText(FText::FromString(FString::Printf(TEXT("COLD: %.0f C - %s"), Temp, *StageStr)));
+	ColdText->SetText(FText::FromString(FString::Printf(TEXT("COLD: %d C - %s"), Temp, *StageStr)));
 	ColdText->SetColorAndOpacity(Color);
 }
 
@@ -202,13 +402,21 @@ void USEEGameHUDWidget::UpdateWeaponDisplay()
 {
 	if (!CombatComp.IsValid()) return;
 
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
+
 	ASEEWeaponBase* Weapon = CombatComp->GetEquippedWeapon();
 	bool bHasWeapon = Weapon != nullptr;
 
+	// The name only changes on a swap or when the weapon breaks
+	const bool bBroken = bHasWeapon && Weapon->IsBroken();
+	const bool bNameChanged = ShownWeapon.Get() != Weapon || bShownWeaponBroken != bBroken;
+	ShownWeapon = Weapon;
+	bShownWeaponBroken = bBroken;
+
 	if (WeaponNameText)
 	{
 		WeaponNameText->SetVisibility(bHasWeapon ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
-		if (bHasWeapon)
+		if (bHasWeapon && bNameChanged)
 		{
 			FString Name = Weapon->WeaponName.ToString();
 			if (Weapon->IsBroken())
@@ -222,9 +430,10 @@ void USEEGameHUDWidget::UpdateWeaponDisplay()
 	if (DurabilityBar)
 	{
 		DurabilityBar->SetVisibility(bHasWeapon ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
-		if (bHasWeapon)
+		float DurPercent = bHasWeapon ? Weapon->GetDurabilityPercent() : 0.0f;
+		if (bHasWeapon && (bNameChanged || DurPercent != ShownDurabilityPercent))
 		{
-			float DurPercent = Weapon->GetDurabilityPercent();
+			ShownDurabilityPercent = DurPercent;
 			DurabilityBar->SetPercent(DurPercent);
 			FLinearColor DurColor = DurPercent > 0.3f
 				? FLinearColor(0.5f, 0.8f, 0.5f)
@@ -238,11 +447,15 @@ void USEEGameHUDWidget::UpdateXPDisplay()
 {
 	if (!StatsComp.IsValid()) return;
 
-	if (LevelText)
+	INC_DWORD_STAT(STAT_SEEHUDUpdates);
+
+	const int32 Level = StatsComp->GetLevel();
+	if (LevelText && Level != ShownLevel)
 	{
+		ShownLevel = Level;
 		LevelText->SetText(FText::Format(
 			NSLOCTEXT("HUD", "Level", "Lv. {0}"),
-			FText::AsNumber(StatsComp->GetLevel())));
+			FText::AsNumber(Level)));
 	}
 
 	if (XPBar)
@@ -251,7 +464,12 @@ void USEEGameHUDWidget::UpdateXPDisplay()
 		float XPPercent = XPNeeded > 0
 			? static_cast<float>(StatsComp->GetCurrentXP()) / static_cast<float>(XPNeeded)
 			: 1.0f;
-		XPBar->SetPercent(FMath::Clamp(XPPercent, 0.0f, 1.0f));
+		XPPercent = FMath::Clamp(XPPercent, 0.0f, 1.0f);
+		if (XPPercent != ShownXPPercent)
+		{
+			ShownXPPercent = XPPercent;
+			XPBar->SetPercent(XPPercent);
+		}
 	}
 }
 
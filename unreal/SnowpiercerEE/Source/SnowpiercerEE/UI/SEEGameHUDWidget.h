@@ -3,6 +3,8 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "SEEHealthComponent.h"
+#include "SEEColdComponent.h"
 #include "SEEGameHUDWidget.generated.h"
 
 class USEEHealthComponent;
@@ -12,12 +14,28 @@ class USEECombatComponent;
 class USEEStatsComponent;
 class USEEInventoryComponent;
 class ASEECharacter;
+class ASEEWeaponBase;
 class UProgressBar;
 class UTextBlock;
 class UImage;
 class UCanvasPanel;
 class UOverlay;
 
+/** HUD sections waiting to be redrawn on the next tick */
+enum class ESEEHUDDirty : uint8
+{
+	None		= 0,
+	Health		= 1 << 0,
+	Injuries	= 1 << 1,
+	Stamina		= 1 << 2,
+	Hunger		= 1 << 3,
+	Cold		= 1 << 4,
+	Weapon		= 1 << 5,
+	XP			= 1 << 6,
+	All			= 0x7F
+};
+ENUM_CLASS_FLAGS(ESEEHUDDirty);
+
 UCLASS(Abstract, Blueprintable)
 class SNOWPIERCEREE_API USEEGameHUDWidget : public UUserWidget
 {
@@ -38,6 +56,7 @@ public:
 
 protected:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 	// --- Health ---
@@ -125,7 +144,47 @@ protected:
 	void OnNotificationReceived(const FText& Message);
 
 private:
+	// Component change events only mark sections dirty; NativeTick redraws them
+	UFUNCTION()
+	void HandleHealthChanged(float NewHealthPercent);
+
+	UFUNCTION()
+	void HandleInjuriesChanged(ESEEInjuryType InjuryType);
+
+	UFUNCTION()
+	void HandleStaminaChanged(float StaminaPercent);
+
+	UFUNCTION()
+	void HandleHungerChanged(float HungerPercent);
+
+	UFUNCTION()
+	void HandleTemperatureChanged(float Temperature);
+
+	UFUNCTION()
+	void HandleFrostbiteStageChanged(ESEEFrostbiteStage NewStage);
+
+	UFUNCTION()
+	void HandleColdZoneChanged(bool bInColdZone);
+
+	UFUNCTION()
+	void HandleWeaponChanged(ASEEWeaponBase* Weapon);
+
+	UFUNCTION()
+	void HandleDurabilityChanged(float DurabilityPercent);
+
+	UFUNCTION()
+	void HandleXPChanged(int32 CurrentXP, int32 XPToNextLevel);
+
+	UFUNCTION()
+	void HandleLevelUp(int32 NewLevel, int32 SkillPointsAvailable);
+
+	void BindComponents();
+	void UnbindComponents();
+	void BindWeapon(ASEEWeaponBase* Weapon);
+	void MarkDirty(ESEEHUDDirty Sections) { DirtyFlags |= Sections; }
+
 	void UpdateHealthDisplay();
+	void UpdateInjuryDisplay();
 	void UpdateStaminaDisplay();
 	void UpdateHungerDisplay();
 	void UpdateColdDisplay();
@@ -139,6 +198,23 @@ private:
 	TWeakObjectPtr<USEEColdComponent> ColdComp;
 	TWeakObjectPtr<USEECombatComponent> CombatComp;
 	TWeakObjectPtr<USEEStatsComponent> StatsComp;
+	TWeakObjectPtr<ASEEWeaponBase> BoundWeapon;
+
+	ESEEHUDDirty DirtyFlags = ESEEHUDDirty::All;
+
+	// Last values pushed to the widgets; text is only re-formatted when these change
+	float ShownHealthPercent = -1.0f;
+	int32 ShownHealth = INDEX_NONE;
+	int32 ShownMaxHealth = INDEX_NONE;
+	float ShownStaminaPercent = -1.0f;
+	int32 ShownHungerPercent = INDEX_NONE;
+	int32 ShownTemperature = MIN_int32;
+	ESEEFrostbiteStage ShownFrostbiteStage = ESEEFrostbiteStage::None;
+	TWeakObjectPtr<ASEEWeaponBase> ShownWeapon;
+	bool bShownWeaponBroken = false;
+	float ShownDurabilityPercent = -1.0f;
+	int32 ShownLevel = INDEX_NONE;
+	float ShownXPPercent = -1.0f;
 
 	float DamageVignetteAlpha = 0.0f;
 	FVector LastDamageDir = FVector::ZeroVector;
@@ -16,28 +16,44 @@ void UCraftingComponent::BeginPlay()
 	{
 		LinkedInventory = Owner->FindComponentByClass<UInventoryComponent>();
 	}
+
+	EnsureRecipeRegistry();
+
+	if (LinkedInventory)
+	{
+		LinkedInventory->OnInventoryChanged.AddDynamic(this, &UCraftingComponent::HandleInventoryChanged);
+		ObservedScrap = LinkedInventory->GetScrap();
+		ObservedWeight = LinkedInventory->GetCurrentWeight();
+		for (const TPair<FName, TArray<FName>>& Pair : RecipesByIngredient)
+		{
+			ObservedIngredientCounts.Add(Pair.Key, LinkedInventory->GetItemCount(Pair.Key));
+		}
+	}
+
+	MarkAllRecipesDirty();
+	RefreshDirtyRecipes();
 }
 
 // --- Station Interaction ---
 
 void UCraftingComponent::SetCurrentStation(ECraftingStationType StationType)
 {
+	if (CurrentStation == StationType) return;
+
 	CurrentStation = StationType;
+	MarkAllRecipesDirty();
+	RefreshDirtyRecipes();
 }
 
 // --- Recipe Queries ---
 
 TArray<FCraftingRecipe> UCraftingComponent::GetAvailableRecipes() const
 {
-	TArray<FCraftingRecipe> Result;
-	if (!RecipeDataTable) return Result;
+	EnsureRecipeRegistry();
 
-	TArray<FName> RowNames = RecipeDataTable->GetRowNames();
-	for (const FName& RowName : RowNames)
+	TArray<FCraftingRecipe> Result;
+	for (const FCraftingRecipe* Recipe : RecipeList)
 	{
-		FCraftingRecipe* Recipe = RecipeDataTable->FindRow<FCraftingRecipe>(RowName, TEXT("GetAvailableRecipes"));
-		if (!Recipe) continue;
-
 		// Must match current station (or FieldCrafting recipes are always available)
 		if (Recipe->RequiredStation != ECraftingStationType::FieldCrafting &&
 			Recipe->RequiredStation != CurrentStation)
@@ -59,72 +75,43 @@ TArray<FCraftingRecipe> UCraftingComponent::GetAvailableRecipes() const
 
 ECraftResult UCraftingComponent::CanCraft(FName RecipeID) const
 {
-	FCraftingRecipe Recipe;
-	if (!GetRecipe(RecipeID, Recipe))
+	const FCraftingRecipe* Recipe = FindRecipe(RecipeID);
+	if (!Recipe)
 	{
 		return ECraftResult::MissingIngredients; // Recipe not found
 	}
 
-	// Station check
-	if (Recipe.RequiredStation != ECraftingStationType::FieldCrafting &&
-		Recipe.RequiredStation != CurrentStation)
-	{
-		return ECraftResult::WrongStation;
-	}
-
-	// Blueprint check
-	if (Recipe.bRequiresBlueprint && !HasDiscoveredBlueprint(RecipeID))
-	{
-		return ECraftResult::MissingBlueprint;
-	}
-
-	if (!LinkedInventory)
-	{
-		return ECraftResult::MissingIngredients;
-	}
-
-	// Ingredient check
-	if (!CheckIngredients(Recipe))
-	{
-		return ECraftResult::MissingIngredients;
-	}
+	return EvaluateRecipe(*Recipe);
+}
 
-	// Scrap check
-	if (Recipe.ScrapCost > 0 && LinkedInventory->GetScrap() < Recipe.ScrapCost)
+bool UCraftingComponent::GetRecipe(FName RecipeID, FCraftingRecipe& OutRecipe) const
+{
+	if (const FCraftingRecipe* Recipe = FindRecipe(RecipeID))
 	{
-		return ECraftResult::MissingScrap;
+		OutRecipe = *Recipe;
+		return true;
 	}
+	return false;
+}
 
-	// Weight check for output
-	FItemDefinition OutputDef;
-	if (LinkedInventory->GetItemDefinition(Recipe.OutputItemID, OutputDef))
+ECraftResult UCraftingComponent::GetCachedCraftResult(FName RecipeID) const
+{
+	if (const ECraftResult* Cached = CachedResults.Find(RecipeID))
 	{
-		float NewWeight = LinkedInventory->GetCurrentWeight() + (OutputDef.Weight * Recipe.OutputCount);
-		if (!OutputDef.bIsQuestItem && NewWeight > LinkedInventory->GetMaxWeight())
-		{
-			return ECraftResult::InventoryFull;
-		}
+		return *Cached;
 	}
-
-	return ECraftResult::Success;
+	return CanCraft(RecipeID);
 }
 
-bool UCraftingComponent::GetRecipe(FName RecipeID, FCraftingRecipe& OutRecipe) const
+TArray<FName> UCraftingComponent::GetRecipesUsingIngredient(FName ItemID) const
 {
-	if (!RecipeDataTable) return false;
+	EnsureRecipeRegistry();
 
-	// Search by RecipeID field since row names may differ
-	TArray<FName> RowNames = RecipeDataTable->GetRowNames();
-	for (const FName& RowName : RowNames)
+	if (const TArray<FName>* Recipes = RecipesByIngredient.Find(ItemID))
 	{
-		FCraftingRecipe* Recipe = RecipeDataTable->FindRow<FCraftingRecipe>(RowName, TEXT("GetRecipe"));
-		if (Recipe && Recipe->RecipeID == RecipeID)
-		{
-			OutRecipe = *Recipe;
-			return true;
-		}
+		return *Recipes;
 	}
-	return false;
+	return TArray<FName>();
 }
 
 // --- Crafting Execution ---
@@ -138,23 +125,23 @@ ECraftResult UCraftingComponent::Craft(FName RecipeID)
 		return PreCheck;
 	}
 
-	FCraftingRecipe Recipe;
-	if (!GetRecipe(RecipeID, Recipe))
+	const FCraftingRecipe* Recipe = FindRecipe(RecipeID);
+	if (!Recipe)
 	{
 		return ECraftResult::MissingIngredients;
 	}
 
 	// Consume ingredients
-	ConsumeIngredients(Recipe);
+	ConsumeIngredients(*Recipe);
 
 	// Consume scrap
-	if (Recipe.ScrapCost > 0)
+	if (Recipe->ScrapCost > 0)
 	{
-		LinkedInventory->ModifyScrap(-Recipe.ScrapCost);
+		LinkedInventory->ModifyScrap(-Recipe->ScrapCost);
 	}
 
 	// Produce output
-	LinkedInventory->AddItem(Recipe.OutputItemID, Recipe.OutputCount);
+	LinkedInventory->AddItem(Recipe->OutputItemID, Recipe->OutputCount);
 
 	OnCraftCompleted.Broadcast(RecipeID, ECraftResult::Success);
 	return ECraftResult::Success;
@@ -165,6 +152,8 @@ ECraftResult UCraftingComponent::Craft(FName RecipeID)
 void UCraftingComponent::DiscoverBlueprint(FName RecipeID)
 {
 	DiscoveredBlueprints.Add(RecipeID);
+	MarkRecipeDirty(RecipeID);
+	RefreshDirtyRecipes();
 }
 
 bool UCraftingComponent::HasDiscoveredBlueprint(FName RecipeID) const
@@ -200,3 +189,172 @@ void UCraftingComponent::ConsumeIngredients(const FCraftingRecipe& Recipe)
 		}
 	}
 }
+
+// --- Recipe Registry ---
+
+void UCraftingComponent::EnsureRecipeRegistry() const
+{
+	if (bRecipeRegistryBuilt || !RecipeDataTable) return;
+	bRecipeRegistryBuilt = true;
+
+	// Row names may differ from RecipeID, so index by the field
+	RecipeDataTable->ForeachRow<FCraftingRecipe>(TEXT("BuildRecipeRegistry"),
+		[this](const FName& RowName, const FCraftingRecipe& Recipe)
+		{
+			if (RecipesByID.Contains(Recipe.RecipeID))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("CraftingComponent: duplicate RecipeID %s in row %s; keeping the first"),
+					*Recipe.RecipeID.ToString(), *RowName.ToString());
+				return;
+			}
+
+			RecipesByID.Add(Recipe.RecipeID, &Recipe);
+			RecipeList.Add(&Recipe);
+
+			for (const FCraftingIngredient& Ingredient : Recipe.Ingredients)
+			{
+				RecipesByIngredient.FindOrAdd(Ingredient.ItemID).AddUnique(Recipe.RecipeID);
+			}
+		});
+}
+
+const FCraftingRecipe* UCraftingComponent::FindRecipe(FName RecipeID) const
+{
+	EnsureRecipeRegistry();
+
+	const FCraftingRecipe* const* Found = RecipesByID.Find(RecipeID);
+	return Found ? *Found : nullptr;
+}
+
+ECraftResult UCraftingComponent::EvaluateRecipe(const FCraftingRecipe& Recipe) const
+{
+	// Station check
+	if (Recipe.RequiredStation != ECraftingStationType::FieldCrafting &&
+		Recipe.RequiredStation != CurrentStation)
+	{
+		return ECraftResult::WrongStation;
+	}
+
+	// Blueprint check
+	if (Recipe.bRequiresBlueprint && !HasDiscoveredBlueprint(Recipe.RecipeID))
+	{
+		return ECraftResult::MissingBlueprint;
+	}
+
+	if (!LinkedInventory)
+	{
+		return ECraftResult::MissingIngredients;
+	}
+
+	// Ingredient check
+	if (!CheckIngredients(Recipe))
+	{
+		return ECraftResult::MissingIngredients;
+	}
+
+	// Scrap check
+	if (Recipe.ScrapCost > 0 && LinkedInventory->GetScrap() < Recipe.ScrapCost)
+	{
+		return ECraftResult::MissingScrap;
+	}
+
+	// Weight check for output
+	FItemDefinition OutputDef;
+	if (LinkedInventory->GetItemDefinition(Recipe.OutputItemID, OutputDef))
+	{
+		float NewWeight = LinkedInventory->GetCurrentWeight() + (OutputDef.Weight * Recipe.OutputCount);
+		if (!OutputDef.bIsQuestItem && NewWeight > LinkedInventory->GetMaxWeight())
+		{
+			return ECraftResult::InventoryFull;
+		}
+	}
+
+	return ECraftResult::Success;
+}
+
+void UCraftingComponent::HandleInventoryChanged()
+{
+	if (!LinkedInventory) return;
+
+	// Ingredients whose count moved dirty only the recipes that use them
+	for (TPair<FName, int32>& Observed : ObservedIngredientCounts)
+	{
+		const int32 Count = LinkedInventory->GetItemCount(Observed.Key);
+		if (Count != Observed.Value)
+		{
+			Observed.Value = Count;
+			for (const FName& RecipeID : RecipesByIngredient.FindChecked(Observed.Key))
+			{
+				MarkRecipeDirty(RecipeID);
+			}
+		}
+	}
+
+	// Scrap and weight only matter to recipes that already got past the ingredient check
+	const int32 Scrap = LinkedInventory->GetScrap();
+	const float Weight = LinkedInventory->GetCurrentWeight();
+	const bool bScrapChanged = Scrap != ObservedScrap;
+	const bool bWeightChanged = !FMath::IsNearlyEqual(Weight, ObservedWeight);
+	ObservedScrap = Scrap;
+	ObservedWeight = Weight;
+
+	if (bScrapChanged || bWeightChanged)
+	{
+		for (const TPair<FName, ECraftResult>& Cached : CachedResults)
+		{
+			const ECraftResult Result = Cached.Value;
+			if ((bScrapChanged && (Result == ECraftResult::MissingScrap || Result == ECraftResult::InventoryFull || Result == ECraftResult::Success)) ||
+				(bWeightChanged && (Result == ECraftResult::InventoryFull || Result == ECraftResult::Success)))
+			{
+				MarkRecipeDirty(Cached.Key);
+			}
+		}
+	}
+
+	RefreshDirtyRecipes();
+}
+
+void UCraftingComponent::MarkRecipeDirty(FName RecipeID)
+{
+	DirtyRecipes.Add(RecipeID);
+}
+
+void UCraftingComponent::MarkAllRecipesDirty()
+{
+	EnsureRecipeRegistry();
+
+	for (const FCraftingRecipe* Recipe : RecipeList)
+	{
+		DirtyRecipes.Add(Recipe->RecipeID);
+	}
+}
+
+void UCraftingComponent::RefreshDirtyRecipes()
+{
+	// Until BeginPlay has seeded the cache, CanCraft answers directly
+	if (!HasBegunPlay())
+	{
+		return;
+	}
+
+	TSet<FName> ToRefresh = MoveTemp(DirtyRecipes);
+	DirtyRecipes.Reset();
+
+	for (const FName& RecipeID : ToRefresh)
+	{
+		const FCraftingRecipe* Recipe = FindRecipe(RecipeID);
+		if (!Recipe) continue;
+
+		const ECraftResult Result = EvaluateRecipe(*Recipe);
+		ECraftResult* Cached = CachedResults.Find(RecipeID);
+		if (!Cached)
+		{
+			CachedResults.Add(RecipeID, Result);
+		}
+		else if (*Cached != Result)
+		{
+			*Cached = Result;
+			OnRecipeAvailabilityChanged.Broadcast(RecipeID, Result);
+		}
+	}
+}
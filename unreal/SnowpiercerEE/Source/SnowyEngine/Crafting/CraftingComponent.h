@@ -19,6 +19,10 @@ class UInventoryComponent;
  *
  * Station interaction is handled by the level: when the player interacts with a crafting
  * station actor, it calls SetCurrentStation() on this component.
+ *
+ * Recipes are indexed by RecipeID and by ingredient at BeginPlay. When the inventory
+ * changes, only recipes whose ingredients, scrap or weight inputs changed are
+ * re-evaluated; OnRecipeAvailabilityChanged reports the ones whose result flipped.
  */
 UCLASS(ClassGroup=(Crafting), meta=(BlueprintSpawnableComponent))
 class SNOWYENGINE_API UCraftingComponent : public UActorComponent
@@ -51,6 +55,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Crafting")
 	bool GetRecipe(FName RecipeID, FCraftingRecipe& OutRecipe) const;
 
+	/** CanCraft result as of the last inventory, station or blueprint change. No re-evaluation. */
+	UFUNCTION(BlueprintPure, Category = "Crafting")
+	ECraftResult GetCachedCraftResult(FName RecipeID) const;
+
+	/** Get the IDs of all recipes that take ItemID as an ingredient. */
+	UFUNCTION(BlueprintPure, Category = "Crafting")
+	TArray<FName> GetRecipesUsingIngredient(FName ItemID) const;
+
 	// --- Crafting Execution ---
 
 	/** Attempt to craft a recipe. Consumes ingredients and produces output on success. */
@@ -76,6 +88,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Crafting")
 	FOnCraftCompleted OnCraftCompleted;
 
+	/** Fired when a recipe's CanCraft result changes, so the crafting panel can update just that row. */
+	UPROPERTY(BlueprintAssignable, Category = "Crafting")
+	FOnRecipeAvailabilityChanged OnRecipeAvailabilityChanged;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -98,4 +114,31 @@ protected:
 private:
 	bool CheckIngredients(const FCraftingRecipe& Recipe) const;
 	void ConsumeIngredients(const FCraftingRecipe& Recipe);
+
+	// --- Recipe Registry ---
+
+	void EnsureRecipeRegistry() const;
+	const FCraftingRecipe* FindRecipe(FName RecipeID) const;
+	ECraftResult EvaluateRecipe(const FCraftingRecipe& Recipe) const;
+
+	UFUNCTION()
+	void HandleInventoryChanged();
+
+	void MarkRecipeDirty(FName RecipeID);
+	void MarkAllRecipesDirty();
+	void RefreshDirtyRecipes();
+
+	// Row pointers into RecipeDataTable, built once
+	mutable bool bRecipeRegistryBuilt = false;
+	mutable TMap<FName, const FCraftingRecipe*> RecipesByID;
+	mutable TArray<const FCraftingRecipe*> RecipeList;
+	mutable TMap<FName, TArray<FName>> RecipesByIngredient;
+
+	// Inventory inputs as of the last refresh, to tell which ones changed
+	TMap<FName, int32> ObservedIngredientCounts;
+	int32 ObservedScrap = 0;
+	float ObservedWeight = 0.0f;
+
+	TMap<FName, ECraftResult> CachedResults;
+	TSet<FName> DirtyRecipes;
 };
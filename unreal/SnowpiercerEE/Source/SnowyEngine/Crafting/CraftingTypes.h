@@ -97,3 +97,4 @@ enum class ECraftResult : uint8
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCraftCompleted, FName, RecipeID, ECraftResult, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRecipeAvailabilityChanged, FName, RecipeID, ECraftResult, Result);
@@ -9,98 +9,73 @@ UInventoryComponent::UInventoryComponent()
 void UInventoryComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Items may carry editor-placed defaults
+	RebuildAggregates();
 }
 
 // --- Item Operations ---
 
 int32 UInventoryComponent::AddItem(FName ItemID, int32 Count, float Durability)
 {
-	if (ItemID.IsNone() || Count <= 0) return 0;
-
-	float ItemWeight = GetItemWeight(ItemID);
-	int32 MaxStack = GetItemMaxStack(ItemID);
-	float CurrentW = GetCurrentWeight();
-	int32 Added = 0;
-
-	for (int32 i = 0; i < Count; ++i)
+	const int32 Added = AddItemInternal(ItemID, Count, Durability);
+	if (Added > 0)
 	{
-		// Check weight limit (quest items bypass weight)
-		FItemDefinition Def;
-		bool bIsQuest = GetItemDefinition(ItemID, Def) && Def.bIsQuestItem;
-		if (!bIsQuest && (CurrentW + ItemWeight) > MaxCarryWeight)
-		{
-			break;
-		}
-
-		// Try to stack with existing
-		FInventoryItem* Existing = FindStackableSlot(ItemID);
-		if (Existing && Existing->StackCount < MaxStack)
-		{
-			Existing->StackCount++;
-		}
-		else
-		{
-			// Create new stack
-			FInventoryItem NewItem;
-			NewItem.ItemID = ItemID;
-			NewItem.StackCount = 1;
-			NewItem.CurrentDurability = Durability;
-			Items.Add(NewItem);
-
-			FInventoryItem& AddedItem = Items.Last();
-			OnItemAdded.Broadcast(AddedItem);
-		}
+		OnInventoryChanged.Broadcast();
+	}
+	return Added;
+}
 
-		CurrentW += ItemWeight;
-		Added++;
+int32 UInventoryComponent::RemoveItem(FName ItemID, int32 Count)
+{
+	const int32 Removed = RemoveItemInternal(ItemID, Count);
+	if (Removed > 0)
+	{
+		OnInventoryChanged.Broadcast();
 	}
+	return Removed;
+}
 
+int32 UInventoryComponent::AddItems(const TMap<FName, int32>& InItemCounts)
+{
+	int32 Added = 0;
+	for (const TPair<FName, int32>& Pair : InItemCounts)
+	{
+		Added += AddItemInternal(Pair.Key, Pair.Value, -1.0f);
+	}
 	if (Added > 0)
 	{
 		OnInventoryChanged.Broadcast();
 	}
-
 	return Added;
 }
 
-int32 UInventoryComponent::RemoveItem(FName ItemID, int32 Count)
+int32 UInventoryComponent::RemoveItems(const TMap<FName, int32>& InItemCounts)
 {
-	if (ItemID.IsNone() || Count <= 0) return 0;
-
 	int32 Removed = 0;
-
-	for (int32 i = Items.Num() - 1; i >= 0 && Removed < Count; --i)
+	for (const TPair<FName, int32>& Pair : InItemCounts)
 	{
-		if (Items[i].ItemID != ItemID) continue;
-
-		int32 ToRemove = FMath::Min(Items[i].StackCount, Count - Removed);
-		Items[i].StackCount -= ToRemove;
-		Removed += ToRemove;
-
-		if (Items[i].StackCount <= 0)
-		{
-			FInventoryItem RemovedItem = Items[i];
-			Items.RemoveAt(i);
-			OnItemRemoved.Broadcast(RemovedItem);
-		}
+		Removed += RemoveItemInternal(Pair.Key, Pair.Value);
 	}
-
 	if (Removed > 0)
 	{
 		OnInventoryChanged.Broadcast();
 	}
-
 	return Removed;
 }
 
 bool UInventoryComponent::RemoveItemByInstance(const FGuid& InstanceID)
 {
+	// Rebuild before the item leaves; a rebuild after would already miss it and subtract it twice
+	EnsureAggregates();
+
 	for (int32 i = 0; i < Items.Num(); ++i)
 	{
 		if (Items[i].InstanceID == InstanceID)
 		{
 			FInventoryItem RemovedItem = Items[i];
 			Items.RemoveAt(i);
+			AdjustAggregates(RemovedItem.ItemID, -RemovedItem.StackCount);
 			OnItemRemoved.Broadcast(RemovedItem);
 			OnInventoryChanged.Broadcast();
 			return true;
@@ -116,15 +91,8 @@ bool UInventoryComponent::HasItem(FName ItemID, int32 Count) const
 
 int32 UInventoryComponent::GetItemCount(FName ItemID) const
 {
-	int32 Total = 0;
-	for (const FInventoryItem& Item : Items)
-	{
-		if (Item.ItemID == ItemID)
-		{
-			Total += Item.StackCount;
-		}
-	}
-	return Total;
+	EnsureAggregates();
+	return ItemCounts.FindRef(ItemID);
 }
 
 bool UInventoryComponent::FindItem(FName ItemID, FInventoryItem& OutItem) const
@@ -144,12 +112,8 @@ bool UInventoryComponent::FindItem(FName ItemID, FInventoryItem& OutItem) const
 
 float UInventoryComponent::GetCurrentWeight() const
 {
-	float Total = 0.0f;
-	for (const FInventoryItem& Item : Items)
-	{
-		Total += GetItemWeight(Item.ItemID) * Item.StackCount;
-	}
-	return Total;
+	EnsureAggregates();
+	return CachedWeight;
 }
 
 float UInventoryComponent::GetWeightPercent() const
@@ -214,10 +178,7 @@ void UInventoryComponent::ModifyInfluence(float Delta)
 
 bool UInventoryComponent::GetItemDefinition(FName ItemID, FItemDefinition& OutDef) const
 {
-	if (!ItemDataTable) return false;
-
-	FItemDefinition* Row = ItemDataTable->FindRow<FItemDefinition>(ItemID, TEXT("GetItemDefinition"));
-	if (Row)
+	if (const FItemDefinition* Row = FindItemDefinition(ItemID))
 	{
 		OutDef = *Row;
 		return true;
@@ -225,46 +186,171 @@ bool UInventoryComponent::GetItemDefinition(FName ItemID, FItemDefinition& OutDe
 	return false;
 }
 
-// --- Private ---
+// --- Aggregates ---
 
-float UInventoryComponent::GetItemWeight(FName ItemID) const
+void UInventoryComponent::RebuildAggregates() const
 {
-	FItemDefinition Def;
-	if (GetItemDefinition(ItemID, Def))
+	ItemCounts.Reset();
+	CachedWeight = 0.0f;
+	for (const FInventoryItem& Item : Items)
 	{
-		return Def.Weight;
+		ItemCounts.FindOrAdd(Item.ItemID) += Item.StackCount;
+		CachedWeight += GetItemWeight(Item.ItemID) * Item.StackCount;
 	}
-	return 1.0f; // Fallback weight
+	bAggregatesValid = true;
 }
 
-int32 UInventoryComponent::GetItemMaxStack(FName ItemID) const
+// --- Private ---
+
+int32 UInventoryComponent::AddItemInternal(FName ItemID, int32 Count, float Durability)
 {
-	FItemDefinition Def;
-	if (GetItemDefinition(ItemID, Def))
+	if (ItemID.IsNone() || Count <= 0) return 0;
+
+	EnsureAggregates();
+
+	const FItemDefinition* Def = FindItemDefinition(ItemID);
+	const float ItemWeight = GetItemWeight(ItemID);
+	const int32 MaxStack = FMath::Max(1, GetItemMaxStack(ItemID));
+
+	// How many fit under the weight limit (quest items bypass weight)
+	int32 ToAdd = Count;
+	if (!(Def && Def->bIsQuestItem) && ItemWeight > 0.0f)
 	{
-		return Def.MaxStackSize;
+		const float Capacity = MaxCarryWeight - CachedWeight;
+		ToAdd = Capacity < 0.0f ? 0 : static_cast<int32>(FMath::Min<double>(Count, FMath::FloorToDouble(Capacity / ItemWeight)));
+
+		// Match the per-unit check exactly despite float rounding in the division
+		while (ToAdd > 0 && CachedWeight + ItemWeight * ToAdd > MaxCarryWeight)
+		{
+			--ToAdd;
+		}
+		while (ToAdd < Count && CachedWeight + ItemWeight * (ToAdd + 1) <= MaxCarryWeight)
+		{
+			++ToAdd;
+		}
 	}
-	return 1;
+	if (ToAdd <= 0) return 0;
+
+	// Top up partial stacks first, then open full ones
+	int32 Remaining = ToAdd;
+	for (FInventoryItem& Item : Items)
+	{
+		if (Remaining == 0) break;
+		if (Item.ItemID == ItemID && Item.StackCount < MaxStack)
+		{
+			const int32 Fill = FMath::Min(MaxStack - Item.StackCount, Remaining);
+			Item.StackCount += Fill;
+			Remaining -= Fill;
+		}
+	}
+
+	while (Remaining > 0)
+	{
+		FInventoryItem NewItem;
+		NewItem.ItemID = ItemID;
+		NewItem.StackCount = FMath::Min(MaxStack, Remaining);
+		NewItem.CurrentDurability = Durability;
+		Remaining -= NewItem.StackCount;
+
+		Items.Add(NewItem);
+		OnItemAdded.Broadcast(Items.Last());
+	}
+
+	AdjustAggregates(ItemID, ToAdd);
+	return ToAdd;
 }
 
-FInventoryItem* UInventoryComponent::FindItemInstance(const FGuid& InstanceID)
+int32 UInventoryComponent::RemoveItemInternal(FName ItemID, int32 Count)
 {
-	for (FInventoryItem& Item : Items)
+	if (ItemID.IsNone() || Count <= 0 || GetItemCount(ItemID) == 0) return 0;
+
+	int32 Removed = 0;
+
+	for (int32 i = Items.Num() - 1; i >= 0 && Removed < Count; --i)
 	{
-		if (Item.InstanceID == InstanceID)
+		if (Items[i].ItemID != ItemID) continue;
+
+		int32 ToRemove = FMath::Min(Items[i].StackCount, Count - Removed);
+		Items[i].StackCount -= ToRemove;
+		Removed += ToRemove;
+
+		if (Items[i].StackCount <= 0)
 		{
-			return &Item;
+			FInventoryItem RemovedItem = Items[i];
+			Items.RemoveAt(i);
+			OnItemRemoved.Broadcast(RemovedItem);
 		}
 	}
-	return nullptr;
+
+	AdjustAggregates(ItemID, -Removed);
+	return Removed;
+}
+
+void UInventoryComponent::AdjustAggregates(FName ItemID, int32 Delta)
+{
+	if (Delta == 0) return;
+
+	EnsureAggregates();
+
+	int32& Count = ItemCounts.FindOrAdd(ItemID);
+	Count += Delta;
+	if (Count <= 0)
+	{
+		ItemCounts.Remove(ItemID);
+	}
+
+	CachedWeight = FMath::Max(0.0f, CachedWeight + GetItemWeight(ItemID) * Delta);
+	if (Items.Num() == 0)
+	{
+		CachedWeight = 0.0f; // Don't let rounding drift survive an empty inventory
+	}
 }
 
-FInventoryItem* UInventoryComponent::FindStackableSlot(FName ItemID)
+void UInventoryComponent::EnsureAggregates() const
+{
+	if (!bAggregatesValid)
+	{
+		RebuildAggregates();
+	}
+}
+
+const FItemDefinition* UInventoryComponent::FindItemDefinition(FName ItemID) const
+{
+	if (!ItemDataTable) return nullptr;
+
+	if (const FItemDefinition* const* Cached = DefinitionCache.Find(ItemID))
+	{
+		return *Cached;
+	}
+
+	const FItemDefinition* Row = ItemDataTable->FindRow<FItemDefinition>(ItemID, TEXT("GetItemDefinition"));
+	DefinitionCache.Add(ItemID, Row);
+	return Row;
+}
+
+float UInventoryComponent::GetItemWeight(FName ItemID) const
+{
+	if (const FItemDefinition* Def = FindItemDefinition(ItemID))
+	{
+		return Def->Weight;
+	}
+	return 1.0f; // Fallback weight
+}
+
+int32 UInventoryComponent::GetItemMaxStack(FName ItemID) const
+{
+	if (const FItemDefinition* Def = FindItemDefinition(ItemID))
+	{
+		return Def->MaxStackSize;
+	}
+	return 1;
+}
+
+FInventoryItem* UInventoryComponent::FindItemInstance(const FGuid& InstanceID)
 {
-	int32 MaxStack = GetItemMaxStack(ItemID);
 	for (FInventoryItem& Item : Items)
 	{
-		if (Item.ItemID == ItemID && Item.StackCount < MaxStack)
+		if (Item.InstanceID == InstanceID)
 		{
 			return &Item;
 		}
@@ -17,6 +17,10 @@
  *
  * Scrap and Influence are tracked as special resource counters (not inventory items)
  * for performance and UX simplicity.
+ *
+ * Per-ItemID counts and total weight are kept as running totals, and item definitions
+ * are cached per ID, so count/weight queries never walk the item list. Adds and removes
+ * fill or drain stacks arithmetically and broadcast OnInventoryChanged once per call.
  */
 UCLASS(ClassGroup=(Inventory), meta=(BlueprintSpawnableComponent))
 class SNOWYENGINE_API UInventoryComponent : public UActorComponent
@@ -36,6 +40,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	int32 RemoveItem(FName ItemID, int32 Count = 1);
 
+	/** Add several item types at once; fires OnInventoryChanged once. Returns the total number of items added. */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	int32 AddItems(const TMap<FName, int32>& InItemCounts);
+
+	/** Remove several item types at once; fires OnInventoryChanged once. Returns the total number of items removed. */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	int32 RemoveItems(const TMap<FName, int32>& InItemCounts);
+
 	/** Remove a specific item instance by GUID. */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool RemoveItemByInstance(const FGuid& InstanceID);
@@ -135,9 +147,29 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category = "Inventory|Runtime")
 	float Influence = 0.0f;
 
+	/** Recompute running totals from Items. Call after editing Items directly. */
+	void RebuildAggregates() const;
+
 private:
+	// Add/remove without broadcasting OnInventoryChanged, so batches fire it once
+	int32 AddItemInternal(FName ItemID, int32 Count, float Durability);
+	int32 RemoveItemInternal(FName ItemID, int32 Count);
+
+	void AdjustAggregates(FName ItemID, int32 Delta);
+	void EnsureAggregates() const;
+
+	/** Cached data table row for ItemID; null if the table has no such row. */
+	const FItemDefinition* FindItemDefinition(FName ItemID) const;
+
 	float GetItemWeight(FName ItemID) const;
 	int32 GetItemMaxStack(FName ItemID) const;
 	FInventoryItem* FindItemInstance(const FGuid& InstanceID);
-	FInventoryItem* FindStackableSlot(FName ItemID);
+
+	// Running totals over Items
+	mutable TMap<FName, int32> ItemCounts;
+	mutable float CachedWeight = 0.0f;
+	mutable bool bAggregatesValid = false;
+
+	// Row pointers into ItemDataTable, including misses
+	mutable TMap<FName, const FItemDefinition*> DefinitionCache;
 };
@@ -1,10 +1,12 @@
 // KronoleComponent.cpp - Kronole drug system implementation
 #include "KronoleComponent.h"
+#include "SurvivalSimulationSubsystem.h"
+#include "Engine/World.h"
 
 UKronoleComponent::UKronoleComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 0.5f;
+	// Simulated by USurvivalSimulationSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 
 	// Default withdrawal onset times by addiction stage:
 	// Clean=never, Casual=600s, Dependent=300s, Addicted=120s, Terminal=60s
@@ -14,35 +16,47 @@ UKronoleComponent::UKronoleComponent()
 void UKronoleComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (USurvivalSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USurvivalSimulationSubsystem>())
+	{
+		Simulation = Sim;
+		SimHandle = Sim->RegisterKronole(this, State, AddictionDecayRate, WithdrawalOnsetTimes);
+	}
 }
 
-void UKronoleComponent::TickComponent(float DeltaTime, ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction)
+void UKronoleComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
+	{
+		State = Sim->GetKronoleState(SimHandle);
+		CachedStage = Sim->GetAddictionStage(SimHandle);
+		Sim->UnregisterKronole(SimHandle);
+	}
+	Simulation.Reset();
+	SimHandle = INDEX_NONE;
 
-	TickBuff(DeltaTime);
-	TickAddiction(DeltaTime);
-	TickWithdrawal(DeltaTime);
+	Super::EndPlay(EndPlayReason);
 }
 
 // --- Kronole Usage ---
 
 bool UKronoleComponent::TakeDose(bool bRefined)
 {
+	FKronoleState NewState = ReadState();
+
 	// Can't stack doses while already buffed (prevents abuse)
-	if (bIsKronoleActive) return false;
+	if (NewState.bIsKronoleActive) return false;
 
-	bIsKronoleActive = true;
-	bLastDoseWasRefined = bRefined;
-	ActiveBuffTimer = bRefined ? RefinedBuffDuration : RawBuffDuration;
-	TimeSinceLastDose = 0.0f;
-	bInWithdrawal = false;
+	NewState.bIsKronoleActive = true;
+	NewState.bLastDoseWasRefined = bRefined;
+	NewState.ActiveBuffTimer = bRefined ? RefinedBuffDuration : RawBuffDuration;
+	NewState.TimeSinceLastDose = 0.0f;
+	NewState.bInWithdrawal = false;
 
 	// Increase addiction
 	float AddictionGain = bRefined ? AddictionPerRefinedDose : AddictionPerRawDose;
-	AddictionLevel = FMath::Min(AddictionLevel + AddictionGain, 100.0f);
-	UpdateAddictionStage();
+	NewState.AddictionLevel = FMath::Min(NewState.AddictionLevel + AddictionGain, 100.0f);
+	WriteState(NewState);
 
 	return true;
 }
@@ -51,41 +65,40 @@ bool UKronoleComponent::TakeDose(bool bRefined)
 
 EKronoleAddictionStage UKronoleComponent::GetAddictionStage() const
 {
-	return CachedStage;
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetAddictionStage(SimHandle) : CachedStage;
 }
 
 EWithdrawalSeverity UKronoleComponent::GetWithdrawalSeverity() const
 {
-	if (!bInWithdrawal) return EWithdrawalSeverity::None;
-
-	float TimePastOnset = TimeSinceLastDose - GetWithdrawalOnsetTime();
-	if (TimePastOnset <= 0.0f) return EWithdrawalSeverity::None;
-
-	// Severity escalates over time past onset
-	if (TimePastOnset < 60.0f) return EWithdrawalSeverity::Mild;
-	if (TimePastOnset < 180.0f) return EWithdrawalSeverity::Moderate;
-	if (TimePastOnset < 360.0f) return EWithdrawalSeverity::Severe;
-	return EWithdrawalSeverity::Critical;
+	if (const USurvivalSimulationSubsystem* Sim = Simulation.Get())
+	{
+		return Sim->GetWithdrawalSeverity(SimHandle);
+	}
+	return USurvivalSimulationSubsystem::GetSeverityForWithdrawal(State.bInWithdrawal, State.TimeSinceLastDose, GetWithdrawalOnsetTime());
 }
 
 // --- Buff Modifiers ---
 
 float UKronoleComponent::GetDamageMultiplier() const
 {
-	if (!bIsKronoleActive) return 1.0f;
-	return bLastDoseWasRefined ? 1.5f : 1.25f;
+	const FKronoleState Current = ReadState();
+	if (!Current.bIsKronoleActive) return 1.0f;
+	return Current.bLastDoseWasRefined ? 1.5f : 1.25f;
 }
 
 float UKronoleComponent::GetTimeDilationFactor() const
 {
-	if (!bIsKronoleActive) return 1.0f;
-	return bLastDoseWasRefined ? 0.5f : 0.7f;
+	const FKronoleState Current = ReadState();
+	if (!Current.bIsKronoleActive) return 1.0f;
+	return Current.bLastDoseWasRefined ? 0.5f : 0.7f;
 }
 
 float UKronoleComponent::GetDamageResistance() const
 {
-	if (!bIsKronoleActive) return 0.0f;
-	return bLastDoseWasRefined ? 0.4f : 0.25f;
+	const FKronoleState Current = ReadState();
+	if (!Current.bIsKronoleActive) return 0.0f;
+	return Current.bLastDoseWasRefined ? 0.4f : 0.25f;
 }
 
 // --- Withdrawal Penalties ---
@@ -130,64 +143,35 @@ float UKronoleComponent::GetWithdrawalCombatPenalty() const
 
 void UKronoleComponent::SetAddictionState(float InAddictionLevel, float InTimeSinceLastDose)
 {
-	AddictionLevel = FMath::Clamp(InAddictionLevel, 0.0f, 100.0f);
-	TimeSinceLastDose = InTimeSinceLastDose;
-	UpdateAddictionStage();
+	FKronoleState NewState = ReadState();
+	NewState.AddictionLevel = FMath::Clamp(InAddictionLevel, 0.0f, 100.0f);
+	NewState.TimeSinceLastDose = InTimeSinceLastDose;
+	WriteState(NewState);
 }
 
 // --- Private ---
 
-void UKronoleComponent::TickBuff(float DeltaTime)
-{
-	if (!bIsKronoleActive) return;
-
-	ActiveBuffTimer -= DeltaTime;
-	if (ActiveBuffTimer <= 0.0f)
-	{
-		bIsKronoleActive = false;
-		ActiveBuffTimer = 0.0f;
-	}
-}
-
-void UKronoleComponent::TickAddiction(float DeltaTime)
+FKronoleState UKronoleComponent::ReadState() const
 {
-	if (AddictionLevel <= 0.0f) return;
-
-	// Track time since last dose
-	if (!bIsKronoleActive)
-	{
-		TimeSinceLastDose += DeltaTime;
-	}
-
-	// Addiction slowly decays when clean for a long time (only if not in withdrawal)
-	if (!bInWithdrawal && TimeSinceLastDose > GetWithdrawalOnsetTime() * 3.0f)
-	{
-		AddictionLevel = FMath::Max(0.0f, AddictionLevel - AddictionDecayRate * DeltaTime);
-		UpdateAddictionStage();
-	}
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetKronoleState(SimHandle) : State;
 }
 
-void UKronoleComponent::TickWithdrawal(float DeltaTime)
+void UKronoleComponent::WriteState(const FKronoleState& NewState)
 {
-	if (bIsKronoleActive || AddictionLevel <= 0.0f)
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
 	{
-		bInWithdrawal = false;
+		Sim->SetKronoleState(SimHandle, NewState);
 		return;
 	}
 
-	float OnsetTime = GetWithdrawalOnsetTime();
-	bInWithdrawal = (TimeSinceLastDose >= OnsetTime);
+	State = NewState;
+	UpdateAddictionStage();
 }
 
 void UKronoleComponent::UpdateAddictionStage()
 {
-	EKronoleAddictionStage NewStage;
-	if (AddictionLevel <= 0.0f)       NewStage = EKronoleAddictionStage::Clean;
-	else if (AddictionLevel <= 20.0f) NewStage = EKronoleAddictionStage::Casual;
-	else if (AddictionLevel <= 45.0f) NewStage = EKronoleAddictionStage::Dependent;
-	else if (AddictionLevel <= 75.0f) NewStage = EKronoleAddictionStage::Addicted;
-	else                              NewStage = EKronoleAddictionStage::Terminal;
-
+	const EKronoleAddictionStage NewStage = USurvivalSimulationSubsystem::GetStageForAddiction(State.AddictionLevel);
 	if (NewStage != CachedStage)
 	{
 		EKronoleAddictionStage OldStage = CachedStage;
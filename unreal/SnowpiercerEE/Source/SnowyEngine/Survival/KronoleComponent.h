@@ -6,6 +6,8 @@
 #include "SurvivalTypes.h"
 #include "KronoleComponent.generated.h"
 
+class USurvivalSimulationSubsystem;
+
 /**
  * UKronoleComponent
  *
@@ -18,6 +20,7 @@
  * Withdrawal severity scales with addiction stage.
  *
  * Works alongside USurvivalComponent to apply stat modifiers during buff/withdrawal.
+ * Like it, this component doesn't tick: its timers run in USurvivalSimulationSubsystem.
  */
 UCLASS(ClassGroup=(Survival), meta=(BlueprintSpawnableComponent))
 class SNOWYENGINE_API UKronoleComponent : public UActorComponent
@@ -27,9 +30,6 @@ class SNOWYENGINE_API UKronoleComponent : public UActorComponent
 public:
 	UKronoleComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-		FActorComponentTickFunction* ThisTickFunction) override;
-
 	// --- Kronole Usage ---
 
 	/** Take a dose of Kronole. Returns true if successfully consumed. */
@@ -38,11 +38,11 @@ public:
 
 	/** Returns true if the character is currently under the effects of Kronole. */
 	UFUNCTION(BlueprintPure, Category = "Kronole")
-	bool IsUnderEffect() const { return bIsKronoleActive; }
+	bool IsUnderEffect() const { return ReadState().bIsKronoleActive; }
 
 	/** Returns remaining buff duration in seconds. */
 	UFUNCTION(BlueprintPure, Category = "Kronole")
-	float GetRemainingBuffDuration() const { return ActiveBuffTimer; }
+	float GetRemainingBuffDuration() const { return ReadState().ActiveBuffTimer; }
 
 	// --- Addiction ---
 
@@ -50,13 +50,13 @@ public:
 	EKronoleAddictionStage GetAddictionStage() const;
 
 	UFUNCTION(BlueprintPure, Category = "Kronole")
-	float GetAddictionLevel() const { return AddictionLevel; }
+	float GetAddictionLevel() const { return ReadState().AddictionLevel; }
 
 	UFUNCTION(BlueprintPure, Category = "Kronole")
 	EWithdrawalSeverity GetWithdrawalSeverity() const;
 
 	UFUNCTION(BlueprintPure, Category = "Kronole")
-	bool IsInWithdrawal() const { return bInWithdrawal; }
+	bool IsInWithdrawal() const { return ReadState().bInWithdrawal; }
 
 	// --- Buff Modifiers (for combat/perception systems to query) ---
 
@@ -98,6 +98,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// --- Config ---
 
@@ -127,30 +128,18 @@ protected:
 
 	// --- Runtime State ---
 
+	// Held here outside play; during play the simulation owns it and this is refreshed at EndPlay
 	UPROPERTY(VisibleAnywhere, Category = "Kronole|Runtime")
-	float AddictionLevel = 0.0f;
-
-	UPROPERTY(VisibleAnywhere, Category = "Kronole|Runtime")
-	float TimeSinceLastDose = 0.0f;
-
-	UPROPERTY(VisibleAnywhere, Category = "Kronole|Runtime")
-	float ActiveBuffTimer = 0.0f;
-
-	UPROPERTY(VisibleAnywhere, Category = "Kronole|Runtime")
-	bool bIsKronoleActive = false;
-
-	UPROPERTY(VisibleAnywhere, Category = "Kronole|Runtime")
-	bool bInWithdrawal = false;
-
-	UPROPERTY(VisibleAnywhere, Category = "Kronole|Runtime")
-	bool bLastDoseWasRefined = false;
+	FKronoleState State;
 
 private:
 	EKronoleAddictionStage CachedStage = EKronoleAddictionStage::Clean;
 
-	void TickBuff(float DeltaTime);
-	void TickAddiction(float DeltaTime);
-	void TickWithdrawal(float DeltaTime);
+	TWeakObjectPtr<USurvivalSimulationSubsystem> Simulation;
+	int32 SimHandle = INDEX_NONE;
+
+	FKronoleState ReadState() const;
+	void WriteState(const FKronoleState& NewState);
 	void UpdateAddictionStage();
 	float GetWithdrawalOnsetTime() const;
 };
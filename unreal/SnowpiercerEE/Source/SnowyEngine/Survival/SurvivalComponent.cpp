@@ -1,16 +1,41 @@
 // SurvivalComponent.cpp - Implementation of the core survival stat component
 #include "SurvivalComponent.h"
+#include "SurvivalSimulationSubsystem.h"
+#include "Engine/World.h"
 
 USurvivalComponent::USurvivalComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 0.25f; // Tick 4x per second for performance
+	// Simulated by USurvivalSimulationSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void USurvivalComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	InitializeDefaults();
+
+	if (USurvivalSimulationSubsystem* Sim = GetWorld()->GetSubsystem<USurvivalSimulationSubsystem>())
+	{
+		Simulation = Sim;
+		SimHandle = Sim->RegisterSurvival(this, StatConfigs);
+		UpdateColdDrain();
+	}
+}
+
+void USurvivalComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
+	{
+		for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+		{
+			RetiredStats[Stat] = Sim->GetStat(SimHandle, static_cast<ESurvivalStatType>(Stat));
+		}
+		Sim->UnregisterSurvival(SimHandle);
+	}
+	Simulation.Reset();
+	SimHandle = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void USurvivalComponent::InitializeDefaults()
@@ -38,94 +63,52 @@ void USurvivalComponent::InitializeDefaults()
 	EnsureConfig(ESurvivalStatType::Health, 100.0f, 100.0f, 0.0f);
 	// Stamina regens (handled separately), doesn't decay
 	EnsureConfig(ESurvivalStatType::Stamina, 100.0f, 100.0f, 0.0f);
-
-	// Initialize current values from configs
-	for (auto& Pair : StatConfigs)
-	{
-		CurrentStats.Add(Pair.Key, Pair.Value.DefaultValue);
-		CachedThresholds.Add(Pair.Key, CalculateThreshold(Pair.Value.DefaultValue / Pair.Value.MaxValue));
-	}
-}
-
-void USurvivalComponent::TickComponent(float DeltaTime, ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	TickDecay(DeltaTime);
-	TickColdExposure(DeltaTime);
-	TickStaminaRegen(DeltaTime);
-
-	// Tick morale event cooldowns
-	TArray<FName> ExpiredCooldowns;
-	for (auto& Pair : MoraleEventCooldowns)
-	{
-		Pair.Value -= DeltaTime;
-		if (Pair.Value <= 0.0f)
-		{
-			ExpiredCooldowns.Add(Pair.Key);
-		}
-	}
-	for (const FName& Key : ExpiredCooldowns)
-	{
-		MoraleEventCooldowns.Remove(Key);
-	}
 }
 
 // --- Stat Access ---
 
 float USurvivalComponent::GetStatValue(ESurvivalStatType StatType) const
 {
-	const float* Value = CurrentStats.Find(StatType);
-	return Value ? *Value : 0.0f;
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetStat(SimHandle, StatType) : RetiredStats[static_cast<int32>(StatType)];
 }
 
 float USurvivalComponent::GetStatPercent(ESurvivalStatType StatType) const
 {
-	const float* Value = CurrentStats.Find(StatType);
-	const FSurvivalStatConfig* Config = StatConfigs.Find(StatType);
-	if (Value && Config && Config->MaxValue > 0.0f)
+	float MaxValue = 0.0f;
+	if (const USurvivalSimulationSubsystem* Sim = Simulation.Get())
+	{
+		MaxValue = Sim->GetStatMax(SimHandle, StatType);
+	}
+	else if (const FSurvivalStatConfig* Config = StatConfigs.Find(StatType))
 	{
-		return *Value / Config->MaxValue;
+		MaxValue = Config->MaxValue;
 	}
-	return 0.0f;
+
+	return MaxValue > 0.0f ? GetStatValue(StatType) / MaxValue : 0.0f;
 }
 
 ESurvivalThreshold USurvivalComponent::GetStatThreshold(ESurvivalStatType StatType) const
 {
-	const ESurvivalThreshold* Cached = CachedThresholds.Find(StatType);
-	return Cached ? *Cached : ESurvivalThreshold::Normal;
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetStatThreshold(SimHandle, StatType) : ESurvivalThreshold::Normal;
 }
 
 // --- Stat Modification ---
 
 void USurvivalComponent::ModifyStat(ESurvivalStatType StatType, float Delta)
 {
-	float* Value = CurrentStats.Find(StatType);
-	if (!Value) return;
-
-	float OldValue = *Value;
-	*Value = ClampStat(StatType, *Value + Delta);
-
-	if (!FMath::IsNearlyEqual(OldValue, *Value))
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
 	{
-		OnSurvivalStatChanged.Broadcast(StatType, OldValue, *Value);
-		CheckThresholdCrossings(StatType, OldValue);
+		Sim->SetStat(SimHandle, StatType, Sim->GetStat(SimHandle, StatType) + Delta);
 	}
 }
 
 void USurvivalComponent::SetStat(ESurvivalStatType StatType, float NewValue)
 {
-	float* Value = CurrentStats.Find(StatType);
-	if (!Value) return;
-
-	float OldValue = *Value;
-	*Value = ClampStat(StatType, NewValue);
-
-	if (!FMath::IsNearlyEqual(OldValue, *Value))
+	if (USurvivalSimulationSubsystem* Sim = Simulation.Get())
 	{
-		OnSurvivalStatChanged.Broadcast(StatType, OldValue, *Value);
-		CheckThresholdCrossings(StatType, OldValue);
+		Sim->SetStat(SimHandle, StatType, NewValue);
 	}
 }
 
@@ -133,27 +116,14 @@ void USurvivalComponent::SetStat(ESurvivalStatType StatType, float NewValue)
 
 float USurvivalComponent::GetStaminaRegenMultiplier() const
 {
-	float Combined = 1.0f;
-	for (const auto& Pair : StatConfigs)
-	{
-		ESurvivalThreshold Threshold = GetStatThreshold(Pair.Key);
-		Combined *= GetMultiplierForThreshold(Pair.Value.StaminaRegenMultipliers, Threshold);
-	}
-	return Combined;
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetStaminaRegenMultiplier(SimHandle) : 1.0f;
 }
 
 float USurvivalComponent::GetCombatEffectivenessMultiplier() const
 {
-	float Combined = 1.0f;
-	for (const auto& Pair : StatConfigs)
-	{
-		// Stamina doesn't affect combat effectiveness directly via this path
-		if (Pair.Key == ESurvivalStatType::Stamina) continue;
-
-		ESurvivalThreshold Threshold = GetStatThreshold(Pair.Key);
-		Combined *= GetMultiplierForThreshold(Pair.Value.CombatEffectivenessMultipliers, Threshold);
-	}
-	return Combined;
+	const USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	return Sim ? Sim->GetCombatEffectivenessMultiplier(SimHandle) : 1.0f;
 }
 
 // --- Cold System ---
@@ -161,6 +131,7 @@ float USurvivalComponent::GetCombatEffectivenessMultiplier() const
 void USurvivalComponent::SetEnvironmentColdLevel(float ColdLevel)
 {
 	EnvironmentColdLevel = FMath::Clamp(ColdLevel, 0.0f, 1.0f);
+	UpdateColdDrain();
 }
 
 bool USurvivalComponent::HasColdProtection() const
@@ -171,6 +142,7 @@ bool USurvivalComponent::HasColdProtection() const
 void USurvivalComponent::SetColdProtection(bool bProtected)
 {
 	bHasColdProtection = bProtected;
+	UpdateColdDrain();
 }
 
 // --- Morale System ---
@@ -178,13 +150,15 @@ void USurvivalComponent::SetColdProtection(bool bProtected)
 void USurvivalComponent::ApplyMoraleEvent(float MoraleDelta, FName EventTag)
 {
 	// Check cooldown to prevent morale event spam
-	if (MoraleEventCooldowns.Contains(EventTag))
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	const double* ReadyTime = MoraleEventReadyTimes.Find(EventTag);
+	if (ReadyTime && *ReadyTime > Now)
 	{
 		return;
 	}
 
 	ModifyStat(ESurvivalStatType::Morale, MoraleDelta);
-	MoraleEventCooldowns.Add(EventTag, MoraleEventCooldownSeconds);
+	MoraleEventReadyTimes.Add(EventTag, Now + MoraleEventCooldownSeconds);
 }
 
 // --- Serialization ---
@@ -211,20 +185,10 @@ void USurvivalComponent::RestoreFromSnapshot(const FSurvivalSnapshot& Snapshot)
 
 // --- Private ---
 
-void USurvivalComponent::TickDecay(float DeltaTime)
+void USurvivalComponent::UpdateColdDrain()
 {
-	for (const auto& Pair : StatConfigs)
-	{
-		if (Pair.Value.DecayRatePerSecond > 0.0f)
-		{
-			ModifyStat(Pair.Key, -Pair.Value.DecayRatePerSecond * DeltaTime);
-		}
-	}
-}
-
-void USurvivalComponent::TickColdExposure(float DeltaTime)
-{
-	if (EnvironmentColdLevel <= 0.0f) return;
+	USurvivalSimulationSubsystem* Sim = Simulation.Get();
+	if (!Sim) return;
 
 	float EffectiveColdRate = ColdDrainRate * EnvironmentColdLevel;
 
@@ -234,68 +198,5 @@ void USurvivalComponent::TickColdExposure(float DeltaTime)
 		EffectiveColdRate *= 0.2f;
 	}
 
-	ModifyStat(ESurvivalStatType::Cold, -EffectiveColdRate * DeltaTime);
-
-	// When Cold is critically low, start draining Health
-	if (GetStatThreshold(ESurvivalStatType::Cold) == ESurvivalThreshold::Critical)
-	{
-		ModifyStat(ESurvivalStatType::Health, -1.0f * DeltaTime);
-	}
-}
-
-void USurvivalComponent::TickStaminaRegen(float DeltaTime)
-{
-	float StaminaPercent = GetStatPercent(ESurvivalStatType::Stamina);
-	if (StaminaPercent >= 1.0f) return;
-
-	// Base regen: 10 per second, modified by survival state
-	float BaseRegen = 10.0f;
-	float Regen = BaseRegen * GetStaminaRegenMultiplier() * DeltaTime;
-	ModifyStat(ESurvivalStatType::Stamina, Regen);
-}
-
-void USurvivalComponent::CheckThresholdCrossings(ESurvivalStatType StatType, float OldValue)
-{
-	const FSurvivalStatConfig* Config = StatConfigs.Find(StatType);
-	if (!Config || Config->MaxValue <= 0.0f) return;
-
-	float NewPercent = GetStatPercent(StatType);
-	ESurvivalThreshold NewThreshold = CalculateThreshold(NewPercent);
-	ESurvivalThreshold* OldThreshold = CachedThresholds.Find(StatType);
-
-	if (OldThreshold && *OldThreshold != NewThreshold)
-	{
-		ESurvivalThreshold PrevThreshold = *OldThreshold;
-		*OldThreshold = NewThreshold;
-		OnThresholdCrossed.Broadcast(StatType, PrevThreshold, NewThreshold);
-	}
-}
-
-ESurvivalThreshold USurvivalComponent::CalculateThreshold(float Percent) const
-{
-	if (Percent <= 0.15f) return ESurvivalThreshold::Critical;
-	if (Percent <= 0.35f) return ESurvivalThreshold::Low;
-	if (Percent <= 0.65f) return ESurvivalThreshold::Normal;
-	if (Percent <= 0.85f) return ESurvivalThreshold::Good;
-	return ESurvivalThreshold::Excellent;
-}
-
-float USurvivalComponent::GetMultiplierForThreshold(const TArray<float>& Multipliers, ESurvivalThreshold Threshold) const
-{
-	int32 Index = static_cast<int32>(Threshold);
-	if (Multipliers.IsValidIndex(Index))
-	{
-		return Multipliers[Index];
-	}
-	return 1.0f;
-}
-
-float USurvivalComponent::ClampStat(ESurvivalStatType StatType, float Value) const
-{
-	const FSurvivalStatConfig* Config = StatConfigs.Find(StatType);
-	if (Config)
-	{
-		return FMath::Clamp(Value, 0.0f, Config->MaxValue);
-	}
-	return FMath::Max(Value, 0.0f);
+	Sim->SetColdDrain(SimHandle, EffectiveColdRate);
 }
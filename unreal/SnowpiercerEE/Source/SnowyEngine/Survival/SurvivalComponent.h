@@ -6,6 +6,8 @@
 #include "SurvivalTypes.h"
 #include "SurvivalComponent.generated.h"
 
+class USurvivalSimulationSubsystem;
+
 /**
  * USurvivalComponent
  *
@@ -17,6 +19,9 @@
  * Cold is driven by environment (hull breaches, exterior); increases debuffs when high exposure.
  * Morale is affected by events, companion deaths, moral choices; affects companion AI and dialogue.
  * Health/Stamina are combat resources modified by Hunger/Cold/Morale states.
+ *
+ * The component doesn't tick: during play its stats are simulated with every other
+ * character's by USurvivalSimulationSubsystem, which also caches the derived multipliers.
  */
 UCLASS(ClassGroup=(Survival), meta=(BlueprintSpawnableComponent))
 class SNOWYENGINE_API USurvivalComponent : public UActorComponent
@@ -26,9 +31,6 @@ class SNOWYENGINE_API USurvivalComponent : public UActorComponent
 public:
 	USurvivalComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-		FActorComponentTickFunction* ThisTickFunction) override;
-
 	// --- Stat Access ---
 
 	UFUNCTION(BlueprintCallable, Category = "Survival")
@@ -97,18 +99,12 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Configuration per stat type
 	UPROPERTY(EditAnywhere, Category = "Survival|Config")
 	TMap<ESurvivalStatType, FSurvivalStatConfig> StatConfigs;
 
-	// Current stat values
-	UPROPERTY(VisibleAnywhere, Category = "Survival|Runtime")
-	TMap<ESurvivalStatType, float> CurrentStats;
-
-	// Cached thresholds for detecting crossings
-	TMap<ESurvivalStatType, ESurvivalThreshold> CachedThresholds;
-
 	// Cold environment
 	UPROPERTY(VisibleAnywhere, Category = "Survival|Runtime")
 	float EnvironmentColdLevel = 0.0f;
@@ -120,20 +116,19 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Survival|Config")
 	float ColdDrainRate = 5.0f;
 
-	// Morale event cooldown tracking to prevent spam
-	TMap<FName, float> MoraleEventCooldowns;
+	// World time at which each morale event tag may fire again, to prevent spam
+	TMap<FName, double> MoraleEventReadyTimes;
 
 	UPROPERTY(EditAnywhere, Category = "Survival|Config")
 	float MoraleEventCooldownSeconds = 30.0f;
 
 private:
 	void InitializeDefaults();
-	void TickDecay(float DeltaTime);
-	void TickColdExposure(float DeltaTime);
-	void TickStaminaRegen(float DeltaTime);
-	void CheckThresholdCrossings(ESurvivalStatType StatType, float OldValue);
-
-	ESurvivalThreshold CalculateThreshold(float Percent) const;
-	float GetMultiplierForThreshold(const TArray<float>& Multipliers, ESurvivalThreshold Threshold) const;
-	float ClampStat(ESurvivalStatType StatType, float Value) const;
+	void UpdateColdDrain();
+
+	TWeakObjectPtr<USurvivalSimulationSubsystem> Simulation;
+	int32 SimHandle = INDEX_NONE;
+
+	// Last simulated values, kept once the component leaves play
+	float RetiredStats[NumSurvivalStats] = {};
 };
@@ -0,0 +1,818 @@
+// SurvivalSimulationSubsystem.cpp - Packed survival simulation implementation
+#include "SurvivalSimulationSubsystem.h"
+#include "SurvivalComponent.h"
+#include "KronoleComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeExit.h"
+
+static TAutoConsoleVariable<float> CVarSurvivalSimRate(
+	TEXT("Survival.SimRate"),
+	4.0f,
+	TEXT("Survival simulation steps per second (hunger, cold, morale, stamina, Kronole)."));
+
+namespace
+{
+	constexpr int32 NumAddictionStages = 5;
+	constexpr float BaseStaminaRegen = 10.0f;
+	constexpr float FreezingHealthDrain = 1.0f;
+
+	/** RemoveAtSwap for a column that holds Stride values per row. */
+	template <typename T>
+	void RemoveStridedRow(TArray<T>& Column, int32 Row, int32 Stride)
+	{
+		const int32 LastRow = Column.Num() / Stride - 1;
+		if (Row != LastRow)
+		{
+			FMemory::Memcpy(&Column[Row * Stride], &Column[LastRow * Stride], Stride * sizeof(T));
+		}
+		Column.SetNum(LastRow * Stride, EAllowShrinking::No);
+	}
+}
+
+// --- Row Map ---
+
+int32 USurvivalSimulationSubsystem::FRowMap::Add()
+{
+	const int32 Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop(EAllowShrinking::No) : HandleToRow.Add(INDEX_NONE);
+	HandleToRow[Handle] = RowToHandle.Add(Handle);
+	return Handle;
+}
+
+int32 USurvivalSimulationSubsystem::FRowMap::Remove(int32 Handle)
+{
+	const int32 Row = GetRow(Handle);
+	if (Row == INDEX_NONE) return INDEX_NONE;
+
+	RowToHandle.RemoveAtSwap(Row, EAllowShrinking::No);
+	if (RowToHandle.IsValidIndex(Row))
+	{
+		HandleToRow[RowToHandle[Row]] = Row;
+	}
+	HandleToRow[Handle] = INDEX_NONE;
+	FreeHandles.Add(Handle);
+	return Row;
+}
+
+void USurvivalSimulationSubsystem::FRowMap::Empty()
+{
+	HandleToRow.Empty();
+	RowToHandle.Empty();
+	FreeHandles.Empty();
+}
+
+// --- Tables ---
+
+void USurvivalSimulationSubsystem::FSurvivalTable::RemoveRow(int32 Row)
+{
+	Owners.RemoveAtSwap(Row, EAllowShrinking::No);
+	for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+	{
+		Values[Stat].RemoveAtSwap(Row, EAllowShrinking::No);
+		MaxValues[Stat].RemoveAtSwap(Row, EAllowShrinking::No);
+		DecayRates[Stat].RemoveAtSwap(Row, EAllowShrinking::No);
+		Thresholds[Stat].RemoveAtSwap(Row, EAllowShrinking::No);
+	}
+	ColdDrain.RemoveAtSwap(Row, EAllowShrinking::No);
+	RemoveStridedRow(StaminaRegenCurves, Row, NumSurvivalStats * NumSurvivalThresholds);
+	RemoveStridedRow(CombatCurves, Row, NumSurvivalStats * NumSurvivalThresholds);
+	StaminaRegenMultipliers.RemoveAtSwap(Row, EAllowShrinking::No);
+	CombatMultipliers.RemoveAtSwap(Row, EAllowShrinking::No);
+}
+
+void USurvivalSimulationSubsystem::FSurvivalTable::Empty()
+{
+	*this = FSurvivalTable();
+}
+
+void USurvivalSimulationSubsystem::FKronoleTable::RemoveRow(int32 Row)
+{
+	Owners.RemoveAtSwap(Row, EAllowShrinking::No);
+	AddictionLevels.RemoveAtSwap(Row, EAllowShrinking::No);
+	TimesSinceLastDose.RemoveAtSwap(Row, EAllowShrinking::No);
+	BuffTimers.RemoveAtSwap(Row, EAllowShrinking::No);
+	AddictionDecayRates.RemoveAtSwap(Row, EAllowShrinking::No);
+	bActive.RemoveAtSwap(Row, EAllowShrinking::No);
+	bInWithdrawal.RemoveAtSwap(Row, EAllowShrinking::No);
+	bRefined.RemoveAtSwap(Row, EAllowShrinking::No);
+	RemoveStridedRow(OnsetTimeTables, Row, NumAddictionStages);
+	OnsetTimes.RemoveAtSwap(Row, EAllowShrinking::No);
+	Stages.RemoveAtSwap(Row, EAllowShrinking::No);
+	Severities.RemoveAtSwap(Row, EAllowShrinking::No);
+}
+
+void USurvivalSimulationSubsystem::FKronoleTable::Empty()
+{
+	*this = FKronoleTable();
+}
+
+void USurvivalSimulationSubsystem::FMeterTable::RemoveRow(int32 Row)
+{
+	Owners.RemoveAtSwap(Row, EAllowShrinking::No);
+	Clients.RemoveAtSwap(Row, EAllowShrinking::No);
+	Values.RemoveAtSwap(Row, EAllowShrinking::No);
+	Floors.RemoveAtSwap(Row, EAllowShrinking::No);
+	Ceilings.RemoveAtSwap(Row, EAllowShrinking::No);
+	FallRates.RemoveAtSwap(Row, EAllowShrinking::No);
+	RiseRates.RemoveAtSwap(Row, EAllowShrinking::No);
+	bFalling.RemoveAtSwap(Row, EAllowShrinking::No);
+	NotifySteps.RemoveAtSwap(Row, EAllowShrinking::No);
+	NotifyBuckets.RemoveAtSwap(Row, EAllowShrinking::No);
+	Bands.RemoveAtSwap(Row, EAllowShrinking::No);
+	DamageBands.RemoveAtSwap(Row, EAllowShrinking::No);
+	RemoveStridedRow(ThresholdTables, Row, FSurvivalMeterDesc::MaxBands);
+}
+
+void USurvivalSimulationSubsystem::FMeterTable::Empty()
+{
+	*this = FMeterTable();
+}
+
+// --- Lifecycle ---
+
+void USurvivalSimulationSubsystem::Deinitialize()
+{
+	SurvivalRows.Empty();
+	Survival.Empty();
+	KronoleRows.Empty();
+	Kronole.Empty();
+	MeterRows.Empty();
+	Meters.Empty();
+	PendingEvents.Empty();
+	DirtyRows.Empty();
+	Super::Deinitialize();
+}
+
+TStatId USurvivalSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USurvivalSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void USurvivalSimulationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (SurvivalRows.Num() + KronoleRows.Num() + MeterRows.Num() == 0)
+	{
+		StepAccumulator = 0.0f;
+		LastTickMs = 0.0;
+		return;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// Time past this frame's step budget carries over, so a hitch is caught up over
+	// the following frames instead of being dropped
+	const float StepSeconds = 1.0f / FMath::Max(CVarSurvivalSimRate.GetValueOnGameThread(), 0.1f);
+	StepAccumulator = FMath::Min(StepAccumulator + DeltaTime, MaxBacklogSeconds);
+	for (int32 StepsRun = 0; StepsRun < MaxStepsPerFrame && StepAccumulator >= StepSeconds; ++StepsRun)
+	{
+		StepAccumulator -= StepSeconds;
+		Step(StepSeconds);
+	}
+
+	LastTickMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+}
+
+void USurvivalSimulationSubsystem::Step(float StepSeconds)
+{
+	StepSurvival(StepSeconds);
+	StepKronole(StepSeconds);
+	StepMeters(StepSeconds);
+	DispatchEvents();
+}
+
+// --- Survival Stats ---
+
+int32 USurvivalSimulationSubsystem::RegisterSurvival(USurvivalComponent* Component, const TMap<ESurvivalStatType, FSurvivalStatConfig>& Configs)
+{
+	const int32 Handle = SurvivalRows.Add();
+	const int32 Row = Survival.Owners.Add(Component);
+
+	const int32 CurveBase = Survival.StaminaRegenCurves.AddUninitialized(NumSurvivalStats * NumSurvivalThresholds);
+	Survival.CombatCurves.AddUninitialized(NumSurvivalStats * NumSurvivalThresholds);
+
+	const FSurvivalStatConfig Defaults;
+	for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+	{
+		const FSurvivalStatConfig* Config = Configs.Find(static_cast<ESurvivalStatType>(Stat));
+		const FSurvivalStatConfig& Use = Config ? *Config : Defaults;
+
+		Survival.Values[Stat].Add(FMath::Clamp(Use.DefaultValue, 0.0f, Use.MaxValue));
+		Survival.MaxValues[Stat].Add(Use.MaxValue);
+		Survival.DecayRates[Stat].Add(FMath::Max(Use.DecayRatePerSecond, 0.0f));
+		Survival.Thresholds[Stat].Add(GetThresholdForPercent(Use.MaxValue > 0.0f ? Use.DefaultValue / Use.MaxValue : 0.0f));
+
+		for (int32 Threshold = 0; Threshold < NumSurvivalThresholds; ++Threshold)
+		{
+			const int32 Index = CurveBase + Stat * NumSurvivalThresholds + Threshold;
+			Survival.StaminaRegenCurves[Index] = Use.StaminaRegenMultipliers.IsValidIndex(Threshold) ? Use.StaminaRegenMultipliers[Threshold] : 1.0f;
+
+			// Stamina doesn't affect combat effectiveness directly
+			Survival.CombatCurves[Index] = (Stat != static_cast<int32>(ESurvivalStatType::Stamina) && Use.CombatEffectivenessMultipliers.IsValidIndex(Threshold))
+				? Use.CombatEffectivenessMultipliers[Threshold] : 1.0f;
+		}
+	}
+
+	Survival.ColdDrain.Add(0.0f);
+	Survival.StaminaRegenMultipliers.Add(1.0f);
+	Survival.CombatMultipliers.Add(1.0f);
+	RefreshMultipliers(Row);
+
+	return Handle;
+}
+
+void USurvivalSimulationSubsystem::UnregisterSurvival(int32 Handle)
+{
+	const int32 Row = SurvivalRows.Remove(Handle);
+	if (Row != INDEX_NONE)
+	{
+		Survival.RemoveRow(Row);
+	}
+}
+
+float USurvivalSimulationSubsystem::GetStat(int32 Handle, ESurvivalStatType StatType) const
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Survival.Values[static_cast<int32>(StatType)][Row] : 0.0f;
+}
+
+float USurvivalSimulationSubsystem::GetStatMax(int32 Handle, ESurvivalStatType StatType) const
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Survival.MaxValues[static_cast<int32>(StatType)][Row] : 0.0f;
+}
+
+ESurvivalThreshold USurvivalSimulationSubsystem::GetStatThreshold(int32 Handle, ESurvivalStatType StatType) const
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Survival.Thresholds[static_cast<int32>(StatType)][Row] : ESurvivalThreshold::Normal;
+}
+
+void USurvivalSimulationSubsystem::SetStat(int32 Handle, ESurvivalStatType StatType, float NewValue)
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	if (Row == INDEX_NONE) return;
+
+	const int32 Stat = static_cast<int32>(StatType);
+	const float MaxValue = Survival.MaxValues[Stat][Row];
+	const float OldValue = Survival.Values[Stat][Row];
+	const float ClampedValue = FMath::Clamp(NewValue, 0.0f, MaxValue);
+	if (FMath::IsNearlyEqual(OldValue, ClampedValue)) return;
+
+	Survival.Values[Stat][Row] = ClampedValue;
+
+	const ESurvivalThreshold OldThreshold = Survival.Thresholds[Stat][Row];
+	const ESurvivalThreshold NewThreshold = MaxValue > 0.0f ? GetThresholdForPercent(ClampedValue / MaxValue) : OldThreshold;
+	if (NewThreshold != OldThreshold)
+	{
+		Survival.Thresholds[Stat][Row] = NewThreshold;
+		RefreshMultipliers(Row);
+	}
+
+	// State is settled before any listener runs
+	USurvivalComponent* Owner = Survival.Owners[Row].Get();
+	if (!Owner) return;
+
+	Owner->OnSurvivalStatChanged.Broadcast(StatType, OldValue, ClampedValue);
+	if (NewThreshold != OldThreshold)
+	{
+		Owner->OnThresholdCrossed.Broadcast(StatType, OldThreshold, NewThreshold);
+	}
+}
+
+float USurvivalSimulationSubsystem::GetStaminaRegenMultiplier(int32 Handle) const
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Survival.StaminaRegenMultipliers[Row] : 1.0f;
+}
+
+float USurvivalSimulationSubsystem::GetCombatEffectivenessMultiplier(int32 Handle) const
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Survival.CombatMultipliers[Row] : 1.0f;
+}
+
+void USurvivalSimulationSubsystem::SetColdDrain(int32 Handle, float DrainPerSecond)
+{
+	const int32 Row = SurvivalRows.GetRow(Handle);
+	if (Row != INDEX_NONE)
+	{
+		Survival.ColdDrain[Row] = FMath::Max(DrainPerSecond, 0.0f);
+	}
+}
+
+void USurvivalSimulationSubsystem::StepSurvival(float StepSeconds)
+{
+	const int32 NumRows = SurvivalRows.Num();
+	if (NumRows == 0) return;
+
+	for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+	{
+		Survival.PrevValues[Stat] = Survival.Values[Stat];
+	}
+
+	// Passive decay, one flat loop per stat
+	for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+	{
+		float* RESTRICT Values = Survival.Values[Stat].GetData();
+		const float* RESTRICT MaxValues = Survival.MaxValues[Stat].GetData();
+		const float* RESTRICT DecayRates = Survival.DecayRates[Stat].GetData();
+		for (int32 i = 0; i < NumRows; ++i)
+		{
+			Values[i] = FMath::Clamp(Values[i] - DecayRates[i] * StepSeconds, 0.0f, MaxValues[i]);
+		}
+	}
+
+	// Cold exposure; a character whose Cold is critical loses health
+	{
+		float* RESTRICT Cold = Survival.Values[static_cast<int32>(ESurvivalStatType::Cold)].GetData();
+		const float* RESTRICT ColdMax = Survival.MaxValues[static_cast<int32>(ESurvivalStatType::Cold)].GetData();
+		float* RESTRICT Health = Survival.Values[static_cast<int32>(ESurvivalStatType::Health)].GetData();
+		const float* RESTRICT ColdDrain = Survival.ColdDrain.GetData();
+		for (int32 i = 0; i < NumRows; ++i)
+		{
+			Cold[i] = FMath::Clamp(Cold[i] - ColdDrain[i] * StepSeconds, 0.0f, ColdMax[i]);
+
+			const bool bFreezing = ColdDrain[i] > 0.0f && ColdMax[i] > 0.0f
+				&& GetThresholdForPercent(Cold[i] / ColdMax[i]) == ESurvivalThreshold::Critical;
+			Health[i] = bFreezing ? FMath::Max(0.0f, Health[i] - FreezingHealthDrain * StepSeconds) : Health[i];
+		}
+	}
+
+	// Stamina regen at the multiplier cached from the current thresholds
+	{
+		float* RESTRICT Stamina = Survival.Values[static_cast<int32>(ESurvivalStatType::Stamina)].GetData();
+		const float* RESTRICT StaminaMax = Survival.MaxValues[static_cast<int32>(ESurvivalStatType::Stamina)].GetData();
+		const float* RESTRICT Multipliers = Survival.StaminaRegenMultipliers.GetData();
+		for (int32 i = 0; i < NumRows; ++i)
+		{
+			Stamina[i] = FMath::Min(StaminaMax[i], Stamina[i] + BaseStaminaRegen * Multipliers[i] * StepSeconds);
+		}
+	}
+
+	// Note what moved; threshold crossings refresh the cached multipliers
+	Survival.ChangedMasks.Reset();
+	Survival.ChangedMasks.SetNumZeroed(NumRows);
+	DirtyRows.Reset();
+	for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+	{
+		const float* Values = Survival.Values[Stat].GetData();
+		const float* PrevValues = Survival.PrevValues[Stat].GetData();
+		const float* MaxValues = Survival.MaxValues[Stat].GetData();
+		ESurvivalThreshold* Thresholds = Survival.Thresholds[Stat].GetData();
+
+		for (int32 i = 0; i < NumRows; ++i)
+		{
+			if (FMath::IsNearlyEqual(Values[i], PrevValues[i]) || MaxValues[i] <= 0.0f) continue;
+
+			Survival.ChangedMasks[i] |= 1 << Stat;
+
+			const ESurvivalThreshold NewThreshold = GetThresholdForPercent(Values[i] / MaxValues[i]);
+			if (NewThreshold != Thresholds[i])
+			{
+				FEvent& Event = PendingEvents.AddDefaulted_GetRef();
+				Event.Type = EEventType::ThresholdCrossed;
+				Event.Owner = Survival.Owners[i];
+				Event.Channel = Stat;
+				Event.OldIndex = static_cast<int32>(Thresholds[i]);
+				Event.NewIndex = static_cast<int32>(NewThreshold);
+
+				Thresholds[i] = NewThreshold;
+				DirtyRows.Add(i);
+			}
+		}
+	}
+
+	for (int32 Row : DirtyRows)
+	{
+		RefreshMultipliers(Row);
+	}
+
+	// Per-stat change events only for components something is listening to
+	for (int32 i = 0; i < NumRows; ++i)
+	{
+		if (Survival.ChangedMasks[i] == 0) continue;
+
+		const USurvivalComponent* Owner = Survival.Owners[i].Get();
+		if (!Owner || !Owner->OnSurvivalStatChanged.IsBound()) continue;
+
+		for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+		{
+			if ((Survival.ChangedMasks[i] & (1 << Stat)) == 0) continue;
+
+			FEvent& Event = PendingEvents.AddDefaulted_GetRef();
+			Event.Type = EEventType::StatChanged;
+			Event.Owner = Survival.Owners[i];
+			Event.Channel = Stat;
+			Event.OldValue = Survival.PrevValues[Stat][i];
+			Event.NewValue = Survival.Values[Stat][i];
+		}
+	}
+}
+
+void USurvivalSimulationSubsystem::RefreshMultipliers(int32 Row)
+{
+	const float* StaminaCurve = &Survival.StaminaRegenCurves[Row * NumSurvivalStats * NumSurvivalThresholds];
+	const float* CombatCurve = &Survival.CombatCurves[Row * NumSurvivalStats * NumSurvivalThresholds];
+
+	float StaminaRegen = 1.0f;
+	float Combat = 1.0f;
+	for (int32 Stat = 0; Stat < NumSurvivalStats; ++Stat)
+	{
+		const int32 Index = Stat * NumSurvivalThresholds + static_cast<int32>(Survival.Thresholds[Stat][Row]);
+		StaminaRegen *= StaminaCurve[Index];
+		Combat *= CombatCurve[Index];
+	}
+
+	Survival.StaminaRegenMultipliers[Row] = StaminaRegen;
+	Survival.CombatMultipliers[Row] = Combat;
+}
+
+// --- Kronole ---
+
+int32 USurvivalSimulationSubsystem::RegisterKronole(UKronoleComponent* Component, const FKronoleState& State, float AddictionDecayRate, const TArray<float>& WithdrawalOnsetTimes)
+{
+	const int32 Handle = KronoleRows.Add();
+	const int32 Row = Kronole.Owners.Add(Component);
+
+	Kronole.AddictionLevels.Add(State.AddictionLevel);
+	Kronole.TimesSinceLastDose.Add(State.TimeSinceLastDose);
+	Kronole.BuffTimers.Add(State.ActiveBuffTimer);
+	Kronole.AddictionDecayRates.Add(AddictionDecayRate);
+	Kronole.bActive.Add(State.bIsKronoleActive);
+	Kronole.bInWithdrawal.Add(State.bInWithdrawal);
+	Kronole.bRefined.Add(State.bLastDoseWasRefined);
+
+	for (int32 Stage = 0; Stage < NumAddictionStages; ++Stage)
+	{
+		Kronole.OnsetTimeTables.Add(WithdrawalOnsetTimes.IsValidIndex(Stage) ? WithdrawalOnsetTimes[Stage] : 9999.0f);
+	}
+
+	// Start at the stage the state is already in; registering isn't a stage change
+	const EKronoleAddictionStage Stage = GetStageForAddiction(State.AddictionLevel);
+	Kronole.Stages.Add(Stage);
+	Kronole.OnsetTimes.Add(Kronole.OnsetTimeTables[Row * NumAddictionStages + static_cast<int32>(Stage)]);
+	Kronole.Severities.Add(EWithdrawalSeverity::None);
+	RefreshKronole(Row);
+
+	return Handle;
+}
+
+void USurvivalSimulationSubsystem::UnregisterKronole(int32 Handle)
+{
+	const int32 Row = KronoleRows.Remove(Handle);
+	if (Row != INDEX_NONE)
+	{
+		Kronole.RemoveRow(Row);
+	}
+}
+
+FKronoleState USurvivalSimulationSubsystem::GetKronoleState(int32 Handle) const
+{
+	FKronoleState State;
+	const int32 Row = KronoleRows.GetRow(Handle);
+	if (Row != INDEX_NONE)
+	{
+		State.AddictionLevel = Kronole.AddictionLevels[Row];
+		State.TimeSinceLastDose = Kronole.TimesSinceLastDose[Row];
+		State.ActiveBuffTimer = Kronole.BuffTimers[Row];
+		State.bIsKronoleActive = Kronole.bActive[Row];
+		State.bInWithdrawal = Kronole.bInWithdrawal[Row];
+		State.bLastDoseWasRefined = Kronole.bRefined[Row];
+	}
+	return State;
+}
+
+void USurvivalSimulationSubsystem::SetKronoleState(int32 Handle, const FKronoleState& State)
+{
+	const int32 Row = KronoleRows.GetRow(Handle);
+	if (Row == INDEX_NONE) return;
+
+	Kronole.AddictionLevels[Row] = State.AddictionLevel;
+	Kronole.TimesSinceLastDose[Row] = State.TimeSinceLastDose;
+	Kronole.BuffTimers[Row] = State.ActiveBuffTimer;
+	Kronole.bActive[Row] = State.bIsKronoleActive;
+	Kronole.bInWithdrawal[Row] = State.bInWithdrawal;
+	Kronole.bRefined[Row] = State.bLastDoseWasRefined;
+	RefreshKronole(Row);
+	DispatchEvents();
+}
+
+EKronoleAddictionStage USurvivalSimulationSubsystem::GetAddictionStage(int32 Handle) const
+{
+	const int32 Row = KronoleRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Kronole.Stages[Row] : EKronoleAddictionStage::Clean;
+}
+
+EWithdrawalSeverity USurvivalSimulationSubsystem::GetWithdrawalSeverity(int32 Handle) const
+{
+	const int32 Row = KronoleRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Kronole.Severities[Row] : EWithdrawalSeverity::None;
+}
+
+void USurvivalSimulationSubsystem::StepKronole(float StepSeconds)
+{
+	const int32 NumRows = KronoleRows.Num();
+	if (NumRows == 0) return;
+
+	float* RESTRICT Addiction = Kronole.AddictionLevels.GetData();
+	float* RESTRICT TimeSinceDose = Kronole.TimesSinceLastDose.GetData();
+	float* RESTRICT BuffTimers = Kronole.BuffTimers.GetData();
+	const float* RESTRICT DecayRates = Kronole.AddictionDecayRates.GetData();
+	const float* RESTRICT OnsetTimes = Kronole.OnsetTimes.GetData();
+	bool* RESTRICT bActive = Kronole.bActive.GetData();
+	const bool* RESTRICT bInWithdrawal = Kronole.bInWithdrawal.GetData();
+
+	// Only rows whose buff ended or whose dose timer or addiction moved need their stage re-read
+	DirtyRows.Reset();
+	for (int32 i = 0; i < NumRows; ++i)
+	{
+		bool bChanged = false;
+		if (bActive[i])
+		{
+			BuffTimers[i] -= StepSeconds;
+			if (BuffTimers[i] <= 0.0f)
+			{
+				bActive[i] = false;
+				BuffTimers[i] = 0.0f;
+				bChanged = true;
+			}
+		}
+
+		if (Addiction[i] > 0.0f)
+		{
+			if (!bActive[i])
+			{
+				TimeSinceDose[i] += StepSeconds;
+				bChanged = true;
+			}
+
+			// Addiction slowly decays when clean for a long time (only if not in withdrawal)
+			if (!bInWithdrawal[i] && TimeSinceDose[i] > OnsetTimes[i] * 3.0f)
+			{
+				Addiction[i] = FMath::Max(0.0f, Addiction[i] - DecayRates[i] * StepSeconds);
+				bChanged = true;
+			}
+		}
+
+		if (bChanged)
+		{
+			DirtyRows.Add(i);
+		}
+	}
+
+	for (int32 Row : DirtyRows)
+	{
+		RefreshKronole(Row);
+	}
+}
+
+void USurvivalSimulationSubsystem::RefreshKronole(int32 Row)
+{
+	const float Addiction = Kronole.AddictionLevels[Row];
+
+	const EKronoleAddictionStage NewStage = GetStageForAddiction(Addiction);
+	if (NewStage != Kronole.Stages[Row])
+	{
+		FEvent& Event = PendingEvents.AddDefaulted_GetRef();
+		Event.Type = EEventType::AddictionStageChanged;
+		Event.Owner = Kronole.Owners[Row];
+		Event.OldIndex = static_cast<int32>(Kronole.Stages[Row]);
+		Event.NewIndex = static_cast<int32>(NewStage);
+
+		Kronole.Stages[Row] = NewStage;
+		Kronole.OnsetTimes[Row] = Kronole.OnsetTimeTables[Row * NumAddictionStages + static_cast<int32>(NewStage)];
+	}
+
+	const bool bWithdrawal = !Kronole.bActive[Row] && Addiction > 0.0f && Kronole.TimesSinceLastDose[Row] >= Kronole.OnsetTimes[Row];
+	Kronole.bInWithdrawal[Row] = bWithdrawal;
+	Kronole.Severities[Row] = GetSeverityForWithdrawal(bWithdrawal, Kronole.TimesSinceLastDose[Row], Kronole.OnsetTimes[Row]);
+}
+
+EKronoleAddictionStage USurvivalSimulationSubsystem::GetStageForAddiction(float AddictionLevel)
+{
+	if (AddictionLevel <= 0.0f)  return EKronoleAddictionStage::Clean;
+	if (AddictionLevel <= 20.0f) return EKronoleAddictionStage::Casual;
+	if (AddictionLevel <= 45.0f) return EKronoleAddictionStage::Dependent;
+	if (AddictionLevel <= 75.0f) return EKronoleAddictionStage::Addicted;
+	return EKronoleAddictionStage::Terminal;
+}
+
+EWithdrawalSeverity USurvivalSimulationSubsystem::GetSeverityForWithdrawal(bool bInWithdrawal, float TimeSinceLastDose, float OnsetTime)
+{
+	if (!bInWithdrawal) return EWithdrawalSeverity::None;
+
+	const float TimePastOnset = TimeSinceLastDose - OnsetTime;
+	if (TimePastOnset <= 0.0f) return EWithdrawalSeverity::None;
+
+	// Severity escalates over time past onset
+	if (TimePastOnset < 60.0f) return EWithdrawalSeverity::Mild;
+	if (TimePastOnset < 180.0f) return EWithdrawalSeverity::Moderate;
+	if (TimePastOnset < 360.0f) return EWithdrawalSeverity::Severe;
+	return EWithdrawalSeverity::Critical;
+}
+
+// --- Meters ---
+
+int32 USurvivalSimulationSubsystem::RegisterMeter(UObject* Owner, ISurvivalMeterClient* Client, const FSurvivalMeterDesc& Desc)
+{
+	const int32 Handle = MeterRows.Add();
+	const int32 Row = Meters.Owners.Add(Owner);
+
+	Meters.Clients.Add(Client);
+	Meters.Values.Add(Desc.Value);
+	Meters.Floors.Add(Desc.Floor);
+	Meters.Ceilings.Add(Desc.Ceiling);
+	Meters.FallRates.Add(Desc.FallRate);
+	Meters.RiseRates.Add(Desc.RiseRate);
+	Meters.bFalling.Add(Desc.bFalling);
+	Meters.NotifySteps.Add(Desc.NotifyStep);
+	Meters.DamageBands.Add(Desc.DamageBand);
+
+	for (int32 Band = 0; Band < FSurvivalMeterDesc::MaxBands; ++Band)
+	{
+		Meters.ThresholdTables.Add(Desc.Thresholds.IsValidIndex(Band) ? Desc.Thresholds[Band] : -MAX_flt);
+	}
+
+	// Seed band and bucket without reporting them
+	Meters.NotifyBuckets.Add(Desc.NotifyStep > 0.0f ? FMath::FloorToInt(Desc.Value / Desc.NotifyStep) : 0);
+	Meters.Bands.Add(0);
+	const int32 NumEvents = PendingEvents.Num();
+	RefreshMeter(Row, false);
+	PendingEvents.SetNum(NumEvents, EAllowShrinking::No);
+
+	return Handle;
+}
+
+void USurvivalSimulationSubsystem::UnregisterMeter(int32 Handle)
+{
+	const int32 Row = MeterRows.Remove(Handle);
+	if (Row != INDEX_NONE)
+	{
+		Meters.RemoveRow(Row);
+	}
+}
+
+float USurvivalSimulationSubsystem::GetMeterValue(int32 Handle) const
+{
+	const int32 Row = MeterRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Meters.Values[Row] : 0.0f;
+}
+
+int32 USurvivalSimulationSubsystem::GetMeterBand(int32 Handle) const
+{
+	const int32 Row = MeterRows.GetRow(Handle);
+	return Row != INDEX_NONE ? Meters.Bands[Row] : 0;
+}
+
+void USurvivalSimulationSubsystem::SetMeterValue(int32 Handle, float NewValue)
+{
+	const int32 Row = MeterRows.GetRow(Handle);
+	if (Row == INDEX_NONE) return;
+
+	Meters.Values[Row] = NewValue;
+	RefreshMeter(Row, true);
+	DispatchEvents();
+}
+
+void USurvivalSimulationSubsystem::SetMeterMotion(int32 Handle, bool bFalling, float Floor, float FallRate)
+{
+	const int32 Row = MeterRows.GetRow(Handle);
+	if (Row == INDEX_NONE) return;
+
+	Meters.bFalling[Row] = bFalling;
+	Meters.Floors[Row] = Floor;
+	Meters.FallRates[Row] = FallRate;
+}
+
+void USurvivalSimulationSubsystem::StepMeters(float StepSeconds)
+{
+	const int32 NumRows = MeterRows.Num();
+	if (NumRows == 0) return;
+
+	float* RESTRICT Values = Meters.Values.GetData();
+	const float* RESTRICT Floors = Meters.Floors.GetData();
+	const float* RESTRICT Ceilings = Meters.Ceilings.GetData();
+	const float* RESTRICT FallRates = Meters.FallRates.GetData();
+	const float* RESTRICT RiseRates = Meters.RiseRates.GetData();
+	const bool* RESTRICT bFalling = Meters.bFalling.GetData();
+
+	for (int32 i = 0; i < NumRows; ++i)
+	{
+		const float Fallen = FMath::Max(Floors[i], Values[i] - FallRates[i] * StepSeconds);
+		const float Risen = FMath::Min(Ceilings[i], Values[i] + RiseRates[i] * StepSeconds);
+		Values[i] = bFalling[i] ? Fallen : Risen;
+	}
+
+	for (int32 i = 0; i < NumRows; ++i)
+	{
+		RefreshMeter(i, false);
+
+		if (Meters.DamageBands[i] != INDEX_NONE && Meters.Bands[i] >= Meters.DamageBands[i])
+		{
+			FEvent& Event = PendingEvents.AddDefaulted_GetRef();
+			Event.Type = EEventType::MeterDamage;
+			Event.Owner = Meters.Owners[i];
+			Event.Client = Meters.Clients[i];
+			Event.NewValue = StepSeconds;
+		}
+	}
+}
+
+void USurvivalSimulationSubsystem::RefreshMeter(int32 Row, bool bForceChanged)
+{
+	const float Value = Meters.Values[Row];
+
+	const float* Thresholds = &Meters.ThresholdTables[Row * FSurvivalMeterDesc::MaxBands];
+	int32 NewBand = 0;
+	for (int32 Band = 0; Band < FSurvivalMeterDesc::MaxBands; ++Band)
+	{
+		NewBand += Value <= Thresholds[Band] ? 1 : 0;
+	}
+
+	const float NotifyStep = Meters.NotifySteps[Row];
+	const int32 NewBucket = NotifyStep > 0.0f ? FMath::FloorToInt(Value / NotifyStep) : Meters.NotifyBuckets[Row];
+	if (bForceChanged || NewBucket != Meters.NotifyBuckets[Row])
+	{
+		Meters.NotifyBuckets[Row] = NewBucket;
+
+		FEvent& Event = PendingEvents.AddDefaulted_GetRef();
+		Event.Type = EEventType::MeterChanged;
+		Event.Owner = Meters.Owners[Row];
+		Event.Client = Meters.Clients[Row];
+		Event.NewValue = Value;
+	}
+
+	if (NewBand != Meters.Bands[Row])
+	{
+		FEvent& Event = PendingEvents.AddDefaulted_GetRef();
+		Event.Type = EEventType::MeterBandChanged;
+		Event.Owner = Meters.Owners[Row];
+		Event.Client = Meters.Clients[Row];
+		Event.OldIndex = Meters.Bands[Row];
+		Event.NewIndex = NewBand;
+
+		Meters.Bands[Row] = NewBand;
+	}
+}
+
+// --- Events ---
+
+void USurvivalSimulationSubsystem::DispatchEvents()
+{
+	// A listener that changes survival state adds to PendingEvents; this loop picks those up
+	if (bDispatching) return;
+	bDispatching = true;
+	ON_SCOPE_EXIT { bDispatching = false; };
+
+	for (int32 i = 0; i < PendingEvents.Num(); ++i)
+	{
+		// Copy: listeners may grow the array
+		const FEvent Event = PendingEvents[i];
+		UObject* Owner = Event.Owner.Get();
+		if (!Owner) continue;
+
+		switch (Event.Type)
+		{
+		case EEventType::StatChanged:
+			CastChecked<USurvivalComponent>(Owner)->OnSurvivalStatChanged.Broadcast(
+				static_cast<ESurvivalStatType>(Event.Channel), Event.OldValue, Event.NewValue);
+			break;
+
+		case EEventType::ThresholdCrossed:
+			CastChecked<USurvivalComponent>(Owner)->OnThresholdCrossed.Broadcast(static_cast<ESurvivalStatType>(Event.Channel),
+				static_cast<ESurvivalThreshold>(Event.OldIndex), static_cast<ESurvivalThreshold>(Event.NewIndex));
+			break;
+
+		case EEventType::AddictionStageChanged:
+			CastChecked<UKronoleComponent>(Owner)->OnAddictionStageChanged.Broadcast(
+				static_cast<EKronoleAddictionStage>(Event.OldIndex), static_cast<EKronoleAddictionStage>(Event.NewIndex));
+			break;
+
+		case EEventType::MeterChanged:
+			Event.Client->OnMeterChanged(Event.NewValue);
+			break;
+
+		case EEventType::MeterBandChanged:
+			Event.Client->OnMeterBandChanged(Event.OldIndex, Event.NewIndex);
+			break;
+
+		case EEventType::MeterDamage:
+			Event.Client->OnMeterDamageStep(Event.NewValue);
+			break;
+		}
+	}
+
+	PendingEvents.Reset();
+}
+
+// --- Stats ---
+
+ESurvivalThreshold USurvivalSimulationSubsystem::GetThresholdForPercent(float Percent)
+{
+	if (Percent <= 0.15f) return ESurvivalThreshold::Critical;
+	if (Percent <= 0.35f) return ESurvivalThreshold::Low;
+	if (Percent <= 0.65f) return ESurvivalThreshold::Normal;
+	if (Percent <= 0.85f) return ESurvivalThreshold::Good;
+	return ESurvivalThreshold::Excellent;
+}
@@ -0,0 +1,298 @@
+// SurvivalSimulationSubsystem.h - Packed, fixed-rate simulation of every character's survival state
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SurvivalTypes.h"
+#include "SurvivalSimulationSubsystem.generated.h"
+
+class USurvivalComponent;
+class UKronoleComponent;
+
+/**
+ * ISurvivalMeterClient
+ *
+ * Owner of a meter simulated by USurvivalSimulationSubsystem. Game modules with their
+ * own survival meters (hunger, body temperature) implement this to hear about changes.
+ */
+class SNOWYENGINE_API ISurvivalMeterClient
+{
+public:
+	virtual ~ISurvivalMeterClient() = default;
+
+	/** Value crossed a multiple of the meter's NotifyStep, or was set directly. */
+	virtual void OnMeterChanged(float NewValue) {}
+
+	/** Value moved into another band (0 = above every threshold). */
+	virtual void OnMeterBandChanged(int32 OldBand, int32 NewBand) {}
+
+	/** A simulation step ran while the meter was at or past its damage band. */
+	virtual void OnMeterDamageStep(float StepSeconds) {}
+};
+
+/** A meter that falls toward Floor or rises toward Ceiling, split into bands by thresholds. */
+struct FSurvivalMeterDesc
+{
+	static constexpr int32 MaxBands = 4;
+
+	float Value = 100.0f;
+	float Floor = 0.0f;
+	float Ceiling = 100.0f;
+
+	// Units per second
+	float FallRate = 0.0f;
+	float RiseRate = 0.0f;
+	bool bFalling = true;
+
+	// Band boundaries, highest first; the meter is in band N once Value <= Thresholds[N - 1]
+	TArray<float, TInlineAllocator<MaxBands>> Thresholds;
+
+	// OnMeterChanged fires when Value crosses a multiple of this (0 = only on direct changes)
+	float NotifyStep = 0.0f;
+
+	// Band from which every step reports OnMeterDamageStep (INDEX_NONE = never)
+	int32 DamageBand = INDEX_NONE;
+};
+
+/**
+ * USurvivalSimulationSubsystem
+ *
+ * Simulates survival for every character in the world in one pass at a fixed rate
+ * (Survival.SimRate, default 4 Hz) instead of one component tick per stat owner.
+ *
+ * State lives here in packed per-field arrays, one row per registered component:
+ *   - survival stats (USurvivalComponent): decay, cold exposure, stamina regen
+ *   - Kronole (UKronoleComponent): buff, addiction and withdrawal timers
+ *   - meters (ISurvivalMeterClient): game-side values such as hunger and body temperature
+ *
+ * Derived values are cached per row. Stamina regen and combat multipliers are recomputed
+ * only when a threshold changes; a Kronole row's stage and withdrawal severity only on
+ * steps where its buff ended or its dose timer or addiction moved, so clean rows are
+ * skipped. Threshold, stage and band delegates fire only on change; per-stat change
+ * delegates are only gathered for components that have listeners.
+ *
+ * Components register in BeginPlay and keep a handle; outside play they fall back to
+ * their own copy of the state.
+ */
+UCLASS()
+class SNOWYENGINE_API USurvivalSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// --- Survival Stats ---
+
+	/** Add a row for Component, starting every stat at its configured default. */
+	int32 RegisterSurvival(USurvivalComponent* Component, const TMap<ESurvivalStatType, FSurvivalStatConfig>& Configs);
+	void UnregisterSurvival(int32 Handle);
+
+	float GetStat(int32 Handle, ESurvivalStatType StatType) const;
+	float GetStatMax(int32 Handle, ESurvivalStatType StatType) const;
+	ESurvivalThreshold GetStatThreshold(int32 Handle, ESurvivalStatType StatType) const;
+
+	/** Set a stat (clamped to [0, Max]) and broadcast the owner's delegates if it changed. */
+	void SetStat(int32 Handle, ESurvivalStatType StatType, float NewValue);
+
+	float GetStaminaRegenMultiplier(int32 Handle) const;
+	float GetCombatEffectivenessMultiplier(int32 Handle) const;
+
+	/** Cold points lost per second from exposure, protection already applied. */
+	void SetColdDrain(int32 Handle, float DrainPerSecond);
+
+	// --- Kronole ---
+
+	int32 RegisterKronole(UKronoleComponent* Component, const FKronoleState& State, float AddictionDecayRate, const TArray<float>& WithdrawalOnsetTimes);
+	void UnregisterKronole(int32 Handle);
+
+	FKronoleState GetKronoleState(int32 Handle) const;
+
+	/** Replace a Kronole row's state; broadcasts the stage change if there is one. */
+	void SetKronoleState(int32 Handle, const FKronoleState& State);
+
+	EKronoleAddictionStage GetAddictionStage(int32 Handle) const;
+	EWithdrawalSeverity GetWithdrawalSeverity(int32 Handle) const;
+
+	static EKronoleAddictionStage GetStageForAddiction(float AddictionLevel);
+	static EWithdrawalSeverity GetSeverityForWithdrawal(bool bInWithdrawal, float TimeSinceLastDose, float OnsetTime);
+
+	// --- Meters ---
+
+	int32 RegisterMeter(UObject* Owner, ISurvivalMeterClient* Client, const FSurvivalMeterDesc& Desc);
+	void UnregisterMeter(int32 Handle);
+
+	float GetMeterValue(int32 Handle) const;
+	int32 GetMeterBand(int32 Handle) const;
+
+	/** Set a meter's value and notify its client, whether or not it crossed a NotifyStep. */
+	void SetMeterValue(int32 Handle, float NewValue);
+
+	/** Change which way a meter moves, where it falls to and how fast. */
+	void SetMeterMotion(int32 Handle, bool bFalling, float Floor, float FallRate);
+
+	// --- Stats ---
+
+	static ESurvivalThreshold GetThresholdForPercent(float Percent);
+
+	int32 GetNumSurvivalRows() const { return SurvivalRows.Num(); }
+	int32 GetNumKronoleRows() const { return KronoleRows.Num(); }
+	int32 GetNumMeterRows() const { return MeterRows.Num(); }
+	double GetLastTickMs() const { return LastTickMs; }
+
+private:
+	/** Stable handles over densely packed rows; removing a row moves the last row into its place. */
+	struct FRowMap
+	{
+		int32 Add();
+
+		/** Frees Handle and returns the row the caller must RemoveAtSwap from every column. */
+		int32 Remove(int32 Handle);
+
+		int32 GetRow(int32 Handle) const { return HandleToRow.IsValidIndex(Handle) ? HandleToRow[Handle] : INDEX_NONE; }
+		int32 GetHandle(int32 Row) const { return RowToHandle[Row]; }
+		int32 Num() const { return RowToHandle.Num(); }
+		void Empty();
+
+		TArray<int32> HandleToRow;
+		TArray<int32> RowToHandle;
+		TArray<int32> FreeHandles;
+	};
+
+	struct FSurvivalTable
+	{
+		TArray<TWeakObjectPtr<USurvivalComponent>> Owners;
+
+		TArray<float> Values[NumSurvivalStats];
+		TArray<float> MaxValues[NumSurvivalStats];
+		TArray<float> DecayRates[NumSurvivalStats];
+		TArray<ESurvivalThreshold> Thresholds[NumSurvivalStats];
+
+		TArray<float> ColdDrain;
+
+		// Per row: NumSurvivalStats x NumSurvivalThresholds multipliers from the owner's configs
+		TArray<float> StaminaRegenCurves;
+		TArray<float> CombatCurves;
+
+		// Products of the curves at the current thresholds
+		TArray<float> StaminaRegenMultipliers;
+		TArray<float> CombatMultipliers;
+
+		// Scratch for the step: values before it and which stats it moved (bit per stat)
+		TArray<float> PrevValues[NumSurvivalStats];
+		TArray<uint8> ChangedMasks;
+
+		void RemoveRow(int32 Row);
+		void Empty();
+	};
+
+	struct FKronoleTable
+	{
+		TArray<TWeakObjectPtr<UKronoleComponent>> Owners;
+
+		TArray<float> AddictionLevels;
+		TArray<float> TimesSinceLastDose;
+		TArray<float> BuffTimers;
+		TArray<float> AddictionDecayRates;
+		TArray<bool> bActive;
+		TArray<bool> bInWithdrawal;
+		TArray<bool> bRefined;
+
+		// Per row: onset time for each addiction stage, and the current stage's
+		TArray<float> OnsetTimeTables;
+		TArray<float> OnsetTimes;
+
+		TArray<EKronoleAddictionStage> Stages;
+		TArray<EWithdrawalSeverity> Severities;
+
+		void RemoveRow(int32 Row);
+		void Empty();
+	};
+
+	struct FMeterTable
+	{
+		TArray<TWeakObjectPtr<UObject>> Owners;
+		TArray<ISurvivalMeterClient*> Clients;
+
+		TArray<float> Values;
+		TArray<float> Floors;
+		TArray<float> Ceilings;
+		TArray<float> FallRates;
+		TArray<float> RiseRates;
+		TArray<bool> bFalling;
+		TArray<float> NotifySteps;
+		TArray<int32> NotifyBuckets;
+		TArray<int32> Bands;
+		TArray<int32> DamageBands;
+
+		// Per row: FSurvivalMeterDesc::MaxBands thresholds, unused ones at -MAX_flt
+		TArray<float> ThresholdTables;
+
+		void RemoveRow(int32 Row);
+		void Empty();
+	};
+
+	enum class EEventType : uint8
+	{
+		StatChanged,
+		ThresholdCrossed,
+		AddictionStageChanged,
+		MeterChanged,
+		MeterBandChanged,
+		MeterDamage
+	};
+
+	/** Gathered during a step and broadcast after it, so listeners can't edit rows mid-pass. */
+	struct FEvent
+	{
+		EEventType Type = EEventType::StatChanged;
+		TWeakObjectPtr<UObject> Owner;
+		ISurvivalMeterClient* Client = nullptr;
+		int32 Channel = 0;
+		int32 OldIndex = 0;
+		int32 NewIndex = 0;
+		float OldValue = 0.0f;
+		float NewValue = 0.0f;
+	};
+
+	void Step(float StepSeconds);
+	void StepSurvival(float StepSeconds);
+	void StepKronole(float StepSeconds);
+	void StepMeters(float StepSeconds);
+
+	/** Recompute a survival row's cached multipliers from its current thresholds. */
+	void RefreshMultipliers(int32 Row);
+
+	/** Recompute a Kronole row's stage, onset time and severity, gathering a stage event. */
+	void RefreshKronole(int32 Row);
+
+	/** Recompute a meter row's band and notify bucket, gathering events for whatever changed. */
+	void RefreshMeter(int32 Row, bool bForceChanged);
+
+	void DispatchEvents();
+
+	FRowMap SurvivalRows;
+	FSurvivalTable Survival;
+
+	FRowMap KronoleRows;
+	FKronoleTable Kronole;
+
+	FRowMap MeterRows;
+	FMeterTable Meters;
+
+	TArray<FEvent> PendingEvents;
+	bool bDispatching = false;
+
+	TArray<int32> DirtyRows;
+
+	float StepAccumulator = 0.0f;
+	double LastTickMs = 0.0;
+
+	/** Steps one frame may run to catch up after a hitch; the rest waits for later frames */
+	static constexpr int32 MaxStepsPerFrame = 4;
+
+	/** Unsimulated time kept for catching up; a longer stall (a load, a breakpoint) is dropped */
+	static constexpr float MaxBacklogSeconds = 10.0f;
+};
@@ -26,6 +26,10 @@ enum class ESurvivalStatType : uint8
 	Stamina		UMETA(DisplayName = "Stamina")
 };
 
+// Entry counts of the two enums above; survival tables are laid out per stat and threshold
+constexpr int32 NumSurvivalStats = 5;
+constexpr int32 NumSurvivalThresholds = 5;
+
 // Kronole addiction stages
 UENUM(BlueprintType)
 enum class EKronoleAddictionStage : uint8
@@ -106,6 +110,31 @@ struct FSurvivalStatConfig
 	}
 };
 
+// Runtime state of a Kronole user; simulated by USurvivalSimulationSubsystem during play
+USTRUCT(BlueprintType)
+struct FKronoleState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float AddictionLevel = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float TimeSinceLastDose = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float ActiveBuffTimer = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bIsKronoleActive = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bInWithdrawal = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bLastDoseWasRefined = false;
+};
+
 // Snapshot of all survival stats for save/load
 USTRUCT(BlueprintType)
 struct FSurvivalSnapshot
@@ -1,9 +1,9 @@
 // Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
 
 #include "CrowdNPCController.h"
+#include "PawnQuerySubsystem.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
 #include "Navigation/PathFollowingComponent.h"
 
@@ -21,6 +21,11 @@ void ACrowdNPCController::OnPossess(APawn* InPawn)
 	{
 		AnchorPoint = InPawn->GetActorLocation();
 
+		if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+		{
+			PawnQuery->RegisterPawn(InPawn, EPawnQueryTag::Crowd);
+		}
+
 		// Set walk speed
 		if (ACharacter* CrowdChar = Cast<ACharacter>(InPawn))
 		{
@@ -36,6 +41,16 @@ void ACrowdNPCController::OnPossess(APawn* InPawn)
 	BehaviorTimer = FMath::RandRange(0.f, MaxIdleTime);
 }
 
+void ACrowdNPCController::OnUnPossess()
+{
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->UnregisterPawn(GetPawn(), EPawnQueryTag::Crowd);
+	}
+
+	Super::OnUnPossess();
+}
+
 void ACrowdNPCController::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -223,30 +238,23 @@ AActor* ACrowdNPCController::FindNearbyTalkPartner() const
 	APawn* ControlledPawn = GetPawn();
 	if (!ControlledPawn) return nullptr;
 
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery) return nullptr;
+
+	// Nearest few crowd NPCs; the closest idle one becomes the partner
 	float SearchRadius = 300.f;
-	TArray<AActor*> NearbyPawns;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), NearbyPawns);
+	TArray<APawn*> NearbyPawns;
+	PawnQuery->QueryNearest(ControlledPawn->GetActorLocation(), SearchRadius, 8, EPawnQueryTag::Crowd, NearbyPawns, ControlledPawn);
 
-	for (AActor* Actor : NearbyPawns)
+	for (APawn* OtherPawn : NearbyPawns)
 	{
-		if (Actor == ControlledPawn) continue;
-
-		APawn* OtherPawn = Cast<APawn>(Actor);
-		if (!OtherPawn) continue;
-
 		// Only talk to other crowd NPCs
 		ACrowdNPCController* OtherCrowd = Cast<ACrowdNPCController>(OtherPawn->GetController());
 		if (!OtherCrowd) continue;
 
-		// Must be idle and nearby
-		if (OtherCrowd->GetCurrentBehavior() != ECrowdBehavior::Idle &&
-			OtherCrowd->GetCurrentBehavior() != ECrowdBehavior::Talk)
-		{
-			continue;
-		}
-
-		float Dist = FVector::Dist(ControlledPawn->GetActorLocation(), OtherPawn->GetActorLocation());
-		if (Dist < SearchRadius)
+		// Must be idle
+		if (OtherCrowd->GetCurrentBehavior() == ECrowdBehavior::Idle ||
+			OtherCrowd->GetCurrentBehavior() == ECrowdBehavior::Talk)
 		{
 			return OtherPawn;
 		}
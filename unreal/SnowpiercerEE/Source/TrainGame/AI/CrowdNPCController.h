@@ -24,6 +24,7 @@ public:
 	ACrowdNPCController();
 
 	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
 	virtual void Tick(float DeltaTime) override;
 
 	/** Force all crowd NPCs to flee from a threat */
@@ -2,9 +2,9 @@
 
 #include "JackbootAIController.h"
 #include "CrowdNPCController.h"
+#include "PawnQuerySubsystem.h"
 #include "TrainGame/Stealth/DetectionComponent.h"
 #include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
 
 AJackbootAIController::AJackbootAIController()
 {
@@ -18,6 +18,21 @@ AJackbootAIController::AJackbootAIController()
 void AJackbootAIController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
+
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->RegisterPawn(InPawn, EPawnQueryTag::Jackboot);
+	}
+}
+
+void AJackbootAIController::OnUnPossess()
+{
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->UnregisterPawn(GetPawn(), EPawnQueryTag::Jackboot);
+	}
+
+	Super::OnUnPossess();
 }
 
 void AJackbootAIController::Tick(float DeltaTime)
@@ -64,19 +79,14 @@ void AJackbootAIController::PropagateAlert(EAlertLevel Level, FVector ThreatLoca
 	// Crowd NPCs flee from combat alerts
 	if (Level >= EAlertLevel::Red)
 	{
-		TArray<AActor*> AllPawns;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), AllPawns);
-
-		for (AActor* Actor : AllPawns)
+		if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
 		{
-			APawn* NearbyPawn = Cast<APawn>(Actor);
-			if (!NearbyPawn) continue;
+			TArray<APawn*> CrowdPawns;
+			PawnQuery->QueryRadius(ThreatLocation, VocalAlertRange, EPawnQueryTag::Crowd, CrowdPawns);
 
-			ACrowdNPCController* CrowdAI = Cast<ACrowdNPCController>(NearbyPawn->GetController());
-			if (CrowdAI)
+			for (APawn* NearbyPawn : CrowdPawns)
 			{
-				float Dist = FVector::Dist(NearbyPawn->GetActorLocation(), ThreatLocation);
-				if (Dist < VocalAlertRange)
+				if (ACrowdNPCController* CrowdAI = Cast<ACrowdNPCController>(NearbyPawn->GetController()))
 				{
 					CrowdAI->TriggerFlee(ThreatLocation);
 				}
@@ -288,19 +298,15 @@ TArray<AJackbootAIController*> AJackbootAIController::FindNearbyJackboots(float
 	APawn* ControlledPawn = GetPawn();
 	if (!ControlledPawn) return Result;
 
-	TArray<AActor*> AllPawns;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), AllPawns);
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery) return Result;
 
-	for (AActor* Actor : AllPawns)
-	{
-		APawn* OtherPawn = Cast<APawn>(Actor);
-		if (!OtherPawn || OtherPawn == ControlledPawn) continue;
-
-		AJackbootAIController* OtherJackboot = Cast<AJackbootAIController>(OtherPawn->GetController());
-		if (!OtherJackboot) continue;
+	TArray<APawn*> NearbyPawns;
+	PawnQuery->QueryRadius(ControlledPawn->GetActorLocation(), Range, EPawnQueryTag::Jackboot, NearbyPawns, ControlledPawn);
 
-		float Dist = FVector::Dist(ControlledPawn->GetActorLocation(), OtherPawn->GetActorLocation());
-		if (Dist <= Range)
+	for (APawn* OtherPawn : NearbyPawns)
+	{
+		if (AJackbootAIController* OtherJackboot = Cast<AJackbootAIController>(OtherPawn->GetController()))
 		{
 			Result.Add(OtherJackboot);
 		}
@@ -27,6 +27,7 @@ public:
 	AJackbootAIController();
 
 	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
 	virtual void Tick(float DeltaTime) override;
 
 	// --- Alert Propagation ---
@@ -0,0 +1,274 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "NPCPoolSubsystem.h"
+#include "SEENPCCharacter.h"
+#include "TrainGame/Dialogue/NPCMemoryComponent.h"
+#include "AIController.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+void UNPCPoolSubsystem::Deinitialize()
+{
+	// Parked actors belong to the persistent level and go down with the world
+	Parked.Empty();
+	SpawnPointsByCar.Empty();
+	UncachedSpawnPoints.Empty();
+	NPCStates.Empty();
+	Super::Deinitialize();
+}
+
+// --- Pool ---
+
+APawn* UNPCPoolSubsystem::AcquireNPC(TSubclassOf<APawn> Archetype, const FTransform& Transform, int32 CarIndex)
+{
+	if (!Archetype) return nullptr;
+
+	if (TArray<FParkedNPC>* Pool = Parked.Find(Archetype.Get()))
+	{
+		while (Pool->Num() > 0)
+		{
+			const FParkedNPC Entry = Pool->Pop(EAllowShrinking::No);
+			if (APawn* Pawn = Entry.Pawn.Get())
+			{
+				Unpark(Entry, Transform, CarIndex);
+				++NumReused;
+				return Pawn;
+			}
+		}
+	}
+
+	APawn* Pawn = SpawnPawn(Archetype.Get(), Transform, CarIndex);
+	if (Pawn && !Pawn->GetController())
+	{
+		Pawn->SpawnDefaultController();
+	}
+	return Pawn;
+}
+
+void UNPCPoolSubsystem::ReleaseNPC(APawn* Pawn)
+{
+	if (!IsValid(Pawn)) return;
+
+	FParkedNPC Entry;
+	Park(Pawn, Entry);
+	Parked.FindOrAdd(Pawn->GetClass()).Add(MoveTemp(Entry));
+}
+
+void UNPCPoolSubsystem::Prewarm(TSubclassOf<APawn> Archetype, int32 Count)
+{
+	if (!Archetype) return;
+
+	TArray<FParkedNPC>& Pool = Parked.FindOrAdd(Archetype.Get());
+	Pool.RemoveAll([](const FParkedNPC& Entry) { return !Entry.Pawn.IsValid(); });
+
+	while (Pool.Num() < Count)
+	{
+		// No car: parked straight away, so it never joins a car's rumor registry
+		APawn* Pawn = SpawnPawn(Archetype.Get(), FTransform::Identity, INDEX_NONE);
+		if (!Pawn) break;
+
+		if (!Pawn->GetController())
+		{
+			Pawn->SpawnDefaultController();
+		}
+
+		FParkedNPC Entry;
+		Park(Pawn, Entry);
+		Pool.Add(MoveTemp(Entry));
+	}
+}
+
+void UNPCPoolSubsystem::EmptyPool()
+{
+	for (TPair<TObjectKey<UClass>, TArray<FParkedNPC>>& Pair : Parked)
+	{
+		for (const FParkedNPC& Entry : Pair.Value)
+		{
+			if (AController* Controller = Entry.Controller.Get())
+			{
+				Controller->Destroy();
+			}
+			if (APawn* Pawn = Entry.Pawn.Get())
+			{
+				Pawn->Destroy();
+			}
+		}
+	}
+	Parked.Empty();
+}
+
+int32 UNPCPoolSubsystem::GetNumParked(TSubclassOf<APawn> Archetype) const
+{
+	const TArray<FParkedNPC>* Pool = Archetype ? Parked.Find(Archetype.Get()) : nullptr;
+	return Pool ? Pool->Num() : 0;
+}
+
+APawn* UNPCPoolSubsystem::SpawnPawn(UClass* Archetype, const FTransform& Transform, int32 CarIndex)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	// Spawn into the persistent level so the pawn survives its car streaming out
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.OverrideLevel = World->PersistentLevel;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	SpawnParams.bDeferConstruction = true;
+
+	APawn* Pawn = World->SpawnActor<APawn>(Archetype, Transform, SpawnParams);
+	if (!Pawn) return nullptr;
+
+	// Set the car before BeginPlay registers the pawn under it. A memory component
+	// added in Blueprint only exists after construction, and is moved once it does.
+	UNPCMemoryComponent* Memory = Pawn->FindComponentByClass<UNPCMemoryComponent>();
+	if (Memory)
+	{
+		Memory->SetCarIndex(CarIndex);
+	}
+	Pawn->FinishSpawning(Transform);
+	if (!Memory)
+	{
+		if (UNPCMemoryComponent* ConstructedMemory = Pawn->FindComponentByClass<UNPCMemoryComponent>())
+		{
+			ConstructedMemory->SetCarIndex(CarIndex);
+		}
+	}
+
+	++NumSpawned;
+	return Pawn;
+}
+
+void UNPCPoolSubsystem::Park(APawn* Pawn, FParkedNPC& OutParked)
+{
+	OutParked.Pawn = Pawn;
+
+	AController* Controller = Pawn->GetController();
+	if (AAIController* AIController = Cast<AAIController>(Controller))
+	{
+		AIController->StopMovement();
+	}
+	if (Controller)
+	{
+		Controller->UnPossess();
+		Controller->SetActorTickEnabled(false);
+		OutParked.Controller = Controller;
+	}
+
+	if (ASEENPCCharacter* NPC = Cast<ASEENPCCharacter>(Pawn))
+	{
+		NPC->ResetForReuse();
+		NPC->SetDormant(true);
+	}
+	if (ACharacter* Character = Cast<ACharacter>(Pawn))
+	{
+		Character->GetCharacterMovement()->StopMovementImmediately();
+	}
+
+	Pawn->SetActorHiddenInGame(true);
+	Pawn->SetActorEnableCollision(false);
+
+	OutParked.bActorTicking = Pawn->IsActorTickEnabled();
+	Pawn->SetActorTickEnabled(false);
+
+	for (UActorComponent* Component : Pawn->GetComponents())
+	{
+		if (Component && Component->IsComponentTickEnabled())
+		{
+			Component->SetComponentTickEnabled(false);
+			OutParked.TickingComponents.Add(Component);
+		}
+	}
+}
+
+void UNPCPoolSubsystem::Unpark(const FParkedNPC& Entry, const FTransform& Transform, int32 CarIndex)
+{
+	APawn* Pawn = Entry.Pawn.Get();
+	check(Pawn);
+
+	Pawn->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Pawn->SetActorHiddenInGame(false);
+	Pawn->SetActorEnableCollision(true);
+	Pawn->SetActorTickEnabled(Entry.bActorTicking);
+
+	for (const TWeakObjectPtr<UActorComponent>& Component : Entry.TickingComponents)
+	{
+		if (Component.IsValid())
+		{
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+
+	// The pawn may have been parked from another car; waking registers it under this one
+	if (UNPCMemoryComponent* Memory = Pawn->FindComponentByClass<UNPCMemoryComponent>())
+	{
+		Memory->SetCarIndex(CarIndex);
+	}
+
+	if (ASEENPCCharacter* NPC = Cast<ASEENPCCharacter>(Pawn))
+	{
+		NPC->SetDormant(false);
+	}
+
+	// Re-possessing restarts the controller's behavior tree and initial AI state
+	AController* Controller = Entry.Controller.Get();
+	if (Controller && !Controller->GetPawn())
+	{
+		Controller->SetActorTickEnabled(true);
+		Controller->Possess(Pawn);
+	}
+	else
+	{
+		Pawn->SpawnDefaultController();
+	}
+}
+
+// --- Spawn Points ---
+
+const TMap<FName, TArray<FVector>>& UNPCPoolSubsystem::GetCarSpawnPoints(FName CarTag, const AActor* Car)
+{
+	TMap<FName, TArray<FVector>>* Points = nullptr;
+	if (CarTag.IsNone())
+	{
+		Points = &UncachedSpawnPoints;
+		Points->Reset();
+	}
+	else if (TMap<FName, TArray<FVector>>* Cached = SpawnPointsByCar.Find(CarTag))
+	{
+		return *Cached;
+	}
+	else
+	{
+		Points = &SpawnPointsByCar.Add(CarTag);
+	}
+
+	const FVector CarLocation = Car ? Car->GetActorLocation() : FVector::ZeroVector;
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		// Only static markers are worth caching; pawns move
+		const AActor* Actor = *It;
+		if (Actor->Tags.Num() == 0 || Actor->IsA<APawn>()) continue;
+
+		const FVector Location = Actor->GetActorLocation();
+		if (Car && FVector::Dist(Location, CarLocation) >= SpawnPointRange) continue;
+
+		for (const FName& Tag : Actor->Tags)
+		{
+			Points->FindOrAdd(Tag).Add(Location);
+		}
+	}
+
+	return *Points;
+}
+
+void UNPCPoolSubsystem::InvalidateCarSpawnPoints(FName CarTag)
+{
+	SpawnPointsByCar.Remove(CarTag);
+}
+
+// --- NPC State ---
+
+void UNPCPoolSubsystem::SetNPCState(const FNPCSpawnState& State)
+{
+	if (State.NPCID.IsNone()) return;
+	NPCStates.Add(State.NPCID, State);
+}
@@ -0,0 +1,116 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "TrainGameAITypes.h"
+#include "NPCPoolSubsystem.generated.h"
+
+// ============================================================================
+// UNPCPoolSubsystem
+//
+// Keeps NPC pawns alive across car loads so entering a car does not spawn
+// actors. Spawners acquire pawns by archetype (the spawn row's pawn class)
+// and release them when their car unloads. A released pawn is parked in the
+// persistent level: hidden, without collision or ticking, dormant in the AI
+// subsystems, and unpossessed, with its controller parked beside it to be
+// possessed again on the next acquire.
+//
+// Also holds what must outlive a car level between loads:
+//   - tagged spawn point and waypoint locations per car, gathered in one
+//     actor pass the first time a car asks and reused on every later load;
+//   - per-NPC state (alive, disposition, memories) keyed by spawn slot ID,
+//     written by spawners on release and kept for the session.
+// ============================================================================
+
+UCLASS()
+class TRAINGAME_API UNPCPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// --- Pool ---
+
+	/**
+	 * A pawn of exactly Archetype placed at Transform in car CarIndex and possessed,
+	 * reusing a parked one when available. The car is set on the pawn's memory
+	 * component before it wakes, so it registers for that car's rumors.
+	 * Null if Archetype is unset or spawning fails.
+	 */
+	APawn* AcquireNPC(TSubclassOf<APawn> Archetype, const FTransform& Transform, int32 CarIndex);
+
+	/** Park a pawn for reuse by its class. Its controller is kept with it. */
+	void ReleaseNPC(APawn* Pawn);
+
+	/** Spawn and park pawns until at least Count of Archetype are waiting (e.g. behind a loading screen) */
+	void Prewarm(TSubclassOf<APawn> Archetype, int32 Count);
+
+	/** Destroy every parked pawn and controller */
+	void EmptyPool();
+
+	int32 GetNumParked(TSubclassOf<APawn> Archetype) const;
+
+	/** Pawns created because no parked one was available, and pawns handed out from the pool */
+	int32 GetNumSpawned() const { return NumSpawned; }
+	int32 GetNumReused() const { return NumReused; }
+
+	// --- Spawn Points ---
+
+	/**
+	 * Locations of tagged actors within range of Car, by tag. Built on the first
+	 * call for CarTag (or for every call when CarTag is None) and cached after.
+	 * The returned map is invalidated by the next call.
+	 */
+	const TMap<FName, TArray<FVector>>& GetCarSpawnPoints(FName CarTag, const AActor* Car);
+
+	/** Drop a car's cached points so they are gathered again (after editing the car at runtime) */
+	void InvalidateCarSpawnPoints(FName CarTag);
+
+	// --- NPC State ---
+
+	/** Record the state of one spawn slot, replacing any earlier record */
+	void SetNPCState(const FNPCSpawnState& State);
+
+	/** Recorded state for a spawn slot, or null if it was never recorded */
+	const FNPCSpawnState* FindNPCState(FName NPCID) const { return NPCStates.Find(NPCID); }
+
+	const TMap<FName, FNPCSpawnState>& GetNPCStates() const { return NPCStates; }
+
+	void ClearNPCStates() { NPCStates.Reset(); }
+
+private:
+	struct FParkedNPC
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		TWeakObjectPtr<AController> Controller;
+
+		// Ticks that were running when parked, restored when the pawn is reused
+		TArray<TWeakObjectPtr<UActorComponent>> TickingComponents;
+		bool bActorTicking = false;
+	};
+
+	APawn* SpawnPawn(UClass* Archetype, const FTransform& Transform, int32 CarIndex);
+
+	void Park(APawn* Pawn, FParkedNPC& OutParked);
+	void Unpark(const FParkedNPC& Parked, const FTransform& Transform, int32 CarIndex);
+
+	/** Parked pawns per archetype class, most recently released last */
+	TMap<TObjectKey<UClass>, TArray<FParkedNPC>> Parked;
+
+	TMap<FName, TMap<FName, TArray<FVector>>> SpawnPointsByCar;
+
+	/** Scratch result for untagged cars */
+	TMap<FName, TArray<FVector>> UncachedSpawnPoints;
+
+	TMap<FName, FNPCSpawnState> NPCStates;
+
+	int32 NumSpawned = 0;
+	int32 NumReused = 0;
+
+	/** Tagged actors further than this from the car belong to another car (cm) */
+	static constexpr float SpawnPointRange = 2000.f;
+};
@@ -1,36 +1,46 @@
 // Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
 
 #include "NPCScheduleComponent.h"
+#include "NPCScheduleSubsystem.h"
+#include "Engine/World.h"
 
 UNPCScheduleComponent::UNPCScheduleComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 1.f; // Don't need to tick every frame
+	// Woken by UNPCScheduleSubsystem when the activity changes
+	PrimaryComponentTick.bCanEverTick = false;
+
+	for (int16& Entry : EntryByHour)
+	{
+		Entry = INDEX_NONE;
+	}
 }
 
-void UNPCScheduleComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UNPCScheduleComponent::BeginPlay()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::BeginPlay();
 
-	if (bScheduleSuspended || DailySchedule.Num() == 0) return;
-
-	CheckTimer -= DeltaTime;
-	if (CheckTimer <= 0.f)
+	CompileSchedule();
+	if (UNPCScheduleSubsystem* Schedules = GetWorld()->GetSubsystem<UNPCScheduleSubsystem>())
 	{
-		CheckTimer = CheckInterval;
-		EvaluateSchedule();
+		Schedules->RegisterSchedule(this);
 	}
 }
 
-void UNPCScheduleComponent::SetSchedule(const TArray<FScheduleEntry>& NewSchedule)
+void UNPCScheduleComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	DailySchedule = NewSchedule;
-	EvaluateSchedule();
+	if (UNPCScheduleSubsystem* Schedules = GetWorld()->GetSubsystem<UNPCScheduleSubsystem>())
+	{
+		Schedules->UnregisterSchedule(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
-void UNPCScheduleComponent::SetGameTimeHours(float Hours)
+void UNPCScheduleComponent::SetSchedule(const TArray<FScheduleEntry>& NewSchedule)
 {
-	GameTimeHours = FMath::Fmod(Hours, 24.f);
+	DailySchedule = NewSchedule;
+	CompileSchedule();
+	RefreshWithSubsystem();
 }
 
 void UNPCScheduleComponent::SuspendSchedule()
@@ -42,38 +52,92 @@ void UNPCScheduleComponent::ResumeSchedule()
 {
 	bScheduleSuspended = false;
 	bAtScheduledLocation = false; // Force re-navigation
-	EvaluateSchedule();
+	RefreshWithSubsystem();
+}
+
+// --- Evaluation ---
+
+bool UNPCScheduleComponent::EvaluateSchedule(float TimeOfDayHours)
+{
+	if (bScheduleSuspended)
+	{
+		return false;
+	}
+
+	const int32 CurrentHour = FMath::FloorToInt(TimeOfDayHours) % 24;
+	const int32 EntryIndex = DailySchedule.IsValidIndex(EntryByHour[CurrentHour]) ? EntryByHour[CurrentHour] : INDEX_NONE;
+	if (EntryIndex == INDEX_NONE)
+	{
+		return true;
+	}
+
+	const FScheduleEntry& Entry = DailySchedule[EntryIndex];
+	if (CurrentActivity != Entry.Activity || CurrentLocationTag != Entry.LocationTag)
+	{
+		EScheduleActivity OldActivity = CurrentActivity;
+		CurrentActivity = Entry.Activity;
+		CurrentLocationTag = Entry.LocationTag;
+		CurrentAnimationTag = Entry.AnimationTag;
+		bAtScheduledLocation = false;
+
+		OnScheduleActivityChanged.Broadcast(OldActivity, CurrentActivity, CurrentLocationTag);
+	}
+	return true;
 }
 
-void UNPCScheduleComponent::EvaluateSchedule()
+double UNPCScheduleComponent::GetNextTransitionHour(double TotalGameHours) const
 {
-	int32 CurrentHour = FMath::FloorToInt(GameTimeHours) % 24;
+	const double HourStart = FMath::FloorToDouble(TotalGameHours);
+	const int32 CurrentHour = static_cast<int32>(FMath::Fmod(HourStart, 24.0));
 
-	for (const FScheduleEntry& Entry : DailySchedule)
+	for (int32 Offset = 1; Offset <= 24; ++Offset)
 	{
-		bool bInRange = false;
-		if (Entry.StartHour <= Entry.EndHour)
+		const int32 EntryIndex = EntryByHour[(CurrentHour + Offset) % 24];
+		if (!DailySchedule.IsValidIndex(EntryIndex))
 		{
-			bInRange = (CurrentHour >= Entry.StartHour && CurrentHour < Entry.EndHour);
+			continue; // Uncovered hours keep the previous activity
 		}
-		else
+
+		const FScheduleEntry& Entry = DailySchedule[EntryIndex];
+		if (Entry.Activity != CurrentActivity || Entry.LocationTag != CurrentLocationTag)
 		{
-			bInRange = (CurrentHour >= Entry.StartHour || CurrentHour < Entry.EndHour);
+			return HourStart + Offset;
 		}
+	}
+	return -1.0;
+}
 
-		if (bInRange)
+void UNPCScheduleComponent::CompileSchedule()
+{
+	// First matching entry wins, as when the list was scanned in order
+	for (int32 Hour = 0; Hour < 24; ++Hour)
+	{
+		EntryByHour[Hour] = INDEX_NONE;
+		for (int32 i = 0; i < DailySchedule.Num(); ++i)
 		{
-			if (CurrentActivity != Entry.Activity || CurrentLocationTag != Entry.LocationTag)
+			const FScheduleEntry& Entry = DailySchedule[i];
+			const bool bInRange = Entry.StartHour <= Entry.EndHour
+				? (Hour >= Entry.StartHour && Hour < Entry.EndHour)
+				: (Hour >= Entry.StartHour || Hour < Entry.EndHour);
+			if (bInRange)
 			{
-				EScheduleActivity OldActivity = CurrentActivity;
-				CurrentActivity = Entry.Activity;
-				CurrentLocationTag = Entry.LocationTag;
-				CurrentAnimationTag = Entry.AnimationTag;
-				bAtScheduledLocation = false;
-
-				OnScheduleActivityChanged.Broadcast(OldActivity, CurrentActivity, CurrentLocationTag);
+				EntryByHour[Hour] = static_cast<int16>(i);
+				break;
 			}
-			return;
 		}
 	}
 }
+
+void UNPCScheduleComponent::RefreshWithSubsystem()
+{
+	UWorld* World = GetWorld();
+	if (!World || !HasBegunPlay())
+	{
+		return; // BeginPlay registers and evaluates
+	}
+
+	if (UNPCScheduleSubsystem* Schedules = World->GetSubsystem<UNPCScheduleSubsystem>())
+	{
+		Schedules->RefreshSchedule(this);
+	}
+}
@@ -14,6 +14,10 @@
 // (sleep, work, patrol, eat, socialize) mapped to locations on the train.
 // The schedule component tells the AI controller where the NPC should be
 // and what they should be doing at any given game hour.
+//
+// Does not tick: UNPCScheduleSubsystem owns the game clock and evaluates this
+// component only at the hours its activity changes. The schedule is compiled
+// into an hour-by-hour entry table so both lookups are constant time.
 // ============================================================================
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnScheduleActivityChanged,
@@ -29,8 +33,6 @@ class TRAINGAME_API UNPCScheduleComponent : public UActorComponent
 public:
 	UNPCScheduleComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	// --- Schedule Management ---
 
 	/** Set the NPC's full daily schedule */
@@ -57,10 +59,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
 	void SetAtScheduledLocation(bool bArrived) { bAtScheduledLocation = bArrived; }
 
-	/** Set the current game time (hours, 0-24) */
-	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
-	void SetGameTimeHours(float Hours);
-
 	/** Temporarily override the schedule (e.g., during combat/alert) */
 	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
 	void SuspendSchedule();
@@ -72,23 +70,42 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "NPC Schedule")
 	FOnScheduleActivityChanged OnScheduleActivityChanged;
 
+	// --- Subsystem ---
+
+	/**
+	 * Apply the entry for the given hour of day (0-24). Returns false if the
+	 * schedule is suspended and nothing was evaluated.
+	 */
+	bool EvaluateSchedule(float TimeOfDayHours);
+
+	/**
+	 * Absolute game hour (same base as TotalGameHours) of the next hour boundary
+	 * at which the activity or location differs from the current one, or -1 if
+	 * it never does.
+	 */
+	double GetNextTransitionHour(double TotalGameHours) const;
+
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** The NPC's daily routine */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Schedule")
 	TArray<FScheduleEntry> DailySchedule;
 
-	/** How often to check for schedule changes (seconds) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Schedule")
-	float CheckInterval = 5.f;
-
 private:
-	void EvaluateSchedule();
+	/** Rebuild EntryByHour from DailySchedule */
+	void CompileSchedule();
+
+	/** Ask the schedule subsystem to re-evaluate and requeue this NPC */
+	void RefreshWithSubsystem();
+
+	/** Index into DailySchedule of the first entry covering each hour, or INDEX_NONE */
+	int16 EntryByHour[24];
 
 	EScheduleActivity CurrentActivity = EScheduleActivity::Sleep;
 	FName CurrentLocationTag = NAME_None;
 	FName CurrentAnimationTag = NAME_None;
-	float GameTimeHours = 0.f;
-	float CheckTimer = 0.f;
 	bool bAtScheduledLocation = false;
 	bool bScheduleSuspended = false;
 };
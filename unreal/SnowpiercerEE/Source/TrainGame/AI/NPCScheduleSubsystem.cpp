@@ -0,0 +1,125 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "NPCScheduleSubsystem.h"
+#include "NPCScheduleComponent.h"
+
+void UNPCScheduleSubsystem::Deinitialize()
+{
+	Wakeups.Empty();
+	WakeSerials.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UNPCScheduleSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNPCScheduleSubsystem, STATGROUP_Tickables);
+}
+
+// --- Clock ---
+
+void UNPCScheduleSubsystem::AdvanceGameTime(float Hours)
+{
+	if (Hours <= 0.f)
+	{
+		return;
+	}
+
+	TotalGameHours += Hours;
+	ProcessDueWakeups();
+}
+
+void UNPCScheduleSubsystem::SetTimeOfDayHours(float Hours)
+{
+	const double Target = FMath::Fmod(FMath::Fmod(static_cast<double>(Hours), 24.0) + 24.0, 24.0);
+	const double Current = FMath::Fmod(TotalGameHours, 24.0);
+
+	double Delta = Target - Current;
+	if (Delta < 0.0)
+	{
+		Delta += 24.0;
+	}
+	AdvanceGameTime(static_cast<float>(Delta));
+}
+
+// --- Schedules ---
+
+void UNPCScheduleSubsystem::RegisterSchedule(UNPCScheduleComponent* Schedule)
+{
+	if (!Schedule)
+	{
+		return;
+	}
+
+	// Whatever happened while this NPC was unloaded resolves to the activity for now
+	EvaluateAndQueue(Schedule);
+}
+
+void UNPCScheduleSubsystem::UnregisterSchedule(UNPCScheduleComponent* Schedule)
+{
+	// Any queued wakeup no longer matches a serial and is dropped when popped
+	WakeSerials.Remove(Schedule);
+}
+
+void UNPCScheduleSubsystem::RefreshSchedule(UNPCScheduleComponent* Schedule)
+{
+	if (Schedule && WakeSerials.Contains(Schedule))
+	{
+		EvaluateAndQueue(Schedule);
+	}
+}
+
+void UNPCScheduleSubsystem::EvaluateAndQueue(UNPCScheduleComponent* Schedule)
+{
+	uint32& Serial = WakeSerials.FindOrAdd(Schedule);
+	Serial = NextSerial++;
+
+	if (!Schedule->EvaluateSchedule(GetTimeOfDayHours()))
+	{
+		return; // Suspended; ResumeSchedule refreshes it
+	}
+
+	const double NextHour = Schedule->GetNextTransitionHour(TotalGameHours);
+	if (NextHour < 0.0)
+	{
+		return; // Same activity around the clock
+	}
+
+	FScheduleWakeup Wakeup;
+	Wakeup.Hour = NextHour;
+	Wakeup.Schedule = Schedule;
+	Wakeup.Serial = Serial;
+	Wakeups.HeapPush(Wakeup);
+}
+
+// --- Tick ---
+
+void UNPCScheduleSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	NumWokenLastFrame = 0;
+	if (SecondsPerGameDay > 0.f)
+	{
+		TotalGameHours += 24.0 * DeltaTime / SecondsPerGameDay;
+	}
+	ProcessDueWakeups();
+}
+
+void UNPCScheduleSubsystem::ProcessDueWakeups()
+{
+	while (Wakeups.Num() > 0 && Wakeups.HeapTop().Hour <= TotalGameHours)
+	{
+		FScheduleWakeup Wakeup;
+		Wakeups.HeapPop(Wakeup, EAllowShrinking::No);
+
+		UNPCScheduleComponent* Schedule = Wakeup.Schedule.Get();
+		const uint32* Serial = Schedule ? WakeSerials.Find(Schedule) : nullptr;
+		if (!Serial || *Serial != Wakeup.Serial)
+		{
+			continue; // Unregistered or superseded
+		}
+
+		EvaluateAndQueue(Schedule);
+		++NumWokenLastFrame;
+	}
+}
@@ -0,0 +1,109 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "NPCScheduleSubsystem.generated.h"
+
+class UNPCScheduleComponent;
+
+// ============================================================================
+// UNPCScheduleSubsystem
+//
+// Owns the train's game clock and wakes NPC schedules only when their activity
+// is due to change. Each registered UNPCScheduleComponent reports the game
+// hour of its next real transition; those hours sit in a min-heap and the
+// subsystem pops whatever has come due each tick. NPCs whose routine does not
+// change for the rest of the day cost nothing until it does.
+//
+// The clock only runs forward, so jumps (sleeping, fast travel) are a single
+// advance: every NPC that came due during the jump is evaluated once at the
+// new time. NPCs in cars that were streamed out are not in the heap at all;
+// they catch up when their car loads and the component registers again.
+// ============================================================================
+
+UCLASS()
+class TRAINGAME_API UNPCScheduleSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// --- Clock ---
+
+	/** Current hour of the day (0-24) */
+	UFUNCTION(BlueprintPure, Category = "NPC Schedule")
+	float GetTimeOfDayHours() const { return static_cast<float>(FMath::Fmod(TotalGameHours, 24.0)); }
+
+	/** Whole game days elapsed since the clock started */
+	UFUNCTION(BlueprintPure, Category = "NPC Schedule")
+	int32 GetGameDay() const { return FMath::FloorToInt32(TotalGameHours / 24.0); }
+
+	/** Move the clock forward by Hours (negative values are ignored) */
+	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
+	void AdvanceGameTime(float Hours);
+
+	/** Move the clock forward to the next time the day reaches Hours (0-24) */
+	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
+	void SetTimeOfDayHours(float Hours);
+
+	/** Real seconds per game day; 0 stops the clock */
+	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
+	void SetSecondsPerGameDay(float Seconds) { SecondsPerGameDay = FMath::Max(0.f, Seconds); }
+
+	/** Game hours since the clock started; monotonic */
+	double GetTotalGameHours() const { return TotalGameHours; }
+
+	// --- Schedules ---
+
+	/** Start tracking a schedule. It is evaluated against the current time immediately. */
+	void RegisterSchedule(UNPCScheduleComponent* Schedule);
+
+	void UnregisterSchedule(UNPCScheduleComponent* Schedule);
+
+	/** Re-evaluate a schedule now and queue its next transition (after its entries change or it resumes) */
+	void RefreshSchedule(UNPCScheduleComponent* Schedule);
+
+	int32 GetNumSchedules() const { return WakeSerials.Num(); }
+
+	/** Schedules woken on the last tick */
+	int32 GetNumWokenLastFrame() const { return NumWokenLastFrame; }
+
+	/** Hour of day the clock starts at */
+	static constexpr double StartHour = 6.0;
+
+private:
+	struct FScheduleWakeup
+	{
+		double Hour = 0.0;
+		TWeakObjectPtr<UNPCScheduleComponent> Schedule;
+
+		/** Matches WakeSerials while this is the schedule's current wakeup */
+		uint32 Serial = 0;
+
+		bool operator<(const FScheduleWakeup& Other) const { return Hour < Other.Hour; }
+	};
+
+	/** Evaluate Schedule at the current time and push its next wakeup, replacing any queued one */
+	void EvaluateAndQueue(UNPCScheduleComponent* Schedule);
+
+	void ProcessDueWakeups();
+
+	double TotalGameHours = StartHour;
+
+	/** Real seconds per game day; matches the economy's default day length */
+	float SecondsPerGameDay = 1440.f;
+
+	/** Min-heap on Hour. Superseded entries stay until popped and are skipped by serial. */
+	TArray<FScheduleWakeup> Wakeups;
+
+	TMap<TObjectKey<UNPCScheduleComponent>, uint32> WakeSerials;
+	uint32 NextSerial = 1;
+
+	int32 NumWokenLastFrame = 0;
+};
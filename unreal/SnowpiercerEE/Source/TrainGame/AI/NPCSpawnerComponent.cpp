@@ -2,11 +2,13 @@
 
 #include "NPCSpawnerComponent.h"
 #include "NPCAIController.h"
+#include "NPCPoolSubsystem.h"
 #include "NPCScheduleComponent.h"
+#include "SEENPCCharacter.h"
+#include "TrainGame/Dialogue/NPCMemoryComponent.h"
 #include "Engine/DataTable.h"
 #include "Engine/World.h"
 #include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
 
 UNPCSpawnerComponent::UNPCSpawnerComponent()
@@ -21,16 +23,14 @@ void UNPCSpawnerComponent::BeginPlay()
 	// Cache spawn rows for this car
 	if (SpawnDataTable)
 	{
-		TArray<FNPCSpawnRow*> AllRows;
-		SpawnDataTable->GetAllRows<FNPCSpawnRow>(TEXT("NPCSpawner"), AllRows);
-
-		for (const FNPCSpawnRow* Row : AllRows)
+		SpawnDataTable->ForeachRow<FNPCSpawnRow>(TEXT("NPCSpawner"), [this](const FName& RowName, const FNPCSpawnRow& Row)
 		{
-			if (Row && Row->CarTag == CarTag)
+			if (Row.CarTag == CarTag)
 			{
-				CachedSpawnRows.Add(*Row);
+				CachedSpawnRows.Add(Row);
+				CachedRowNames.Add(RowName);
 			}
-		}
+		});
 	}
 
 	if (bSpawnOnBeginPlay)
@@ -39,35 +39,63 @@ void UNPCSpawnerComponent::BeginPlay()
 	}
 }
 
+void UNPCSpawnerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The car is streaming out; hand its NPCs back for the next car to reuse
+	if (EndPlayReason == EEndPlayReason::RemovedFromWorld || EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		DespawnAll();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UNPCSpawnerComponent::SpawnNPCs()
 {
 	UWorld* World = GetWorld();
 	if (!World) return;
 
-	for (const FNPCSpawnRow& Row : CachedSpawnRows)
+	for (int32 RowIndex = 0; RowIndex < CachedSpawnRows.Num(); ++RowIndex)
 	{
-		for (int32 i = 0; i < Row.SpawnCount && SpawnedNPCs.Num() < MaxNPCs; ++i)
+		for (int32 i = 0; i < CachedSpawnRows[RowIndex].SpawnCount && SpawnedNPCs.Num() < MaxNPCs; ++i)
 		{
-			APawn* SpawnedNPC = SpawnSingleNPC(Row, i);
-			if (SpawnedNPC)
-			{
-				SpawnedNPCs.Add(SpawnedNPC);
-				ConfigureNPCAI(SpawnedNPC, Row);
-			}
+			SpawnSlot(RowIndex, i);
 		}
 	}
 }
 
 void UNPCSpawnerComponent::DespawnAll()
 {
+	RecordNPCStates();
+
+	UNPCPoolSubsystem* Pool = GetPool();
 	for (APawn* NPC : SpawnedNPCs)
 	{
 		if (NPC && IsValid(NPC))
 		{
-			NPC->Destroy();
+			if (Pool)
+			{
+				Pool->ReleaseNPC(NPC);
+			}
+			else
+			{
+				NPC->Destroy();
+			}
 		}
 	}
-	SpawnedNPCs.Empty();
+	SpawnedNPCs.Reset();
+	SpawnedNPCIDs.Reset();
+}
+
+void UNPCSpawnerComponent::RecordNPCStates()
+{
+	UNPCPoolSubsystem* Pool = GetPool();
+	if (!Pool) return;
+
+	for (int32 i = 0; i < SpawnedNPCs.Num(); ++i)
+	{
+		Pool->SetNPCState(CaptureNPCState(SpawnedNPCs[i], SpawnedNPCIDs[i]));
+	}
 }
 
 void UNPCSpawnerComponent::RespawnNPC(int32 SpawnIndex)
@@ -80,6 +108,7 @@ void UNPCSpawnerComponent::RespawnNPC(int32 SpawnIndex)
 	if (NewNPC)
 	{
 		SpawnedNPCs.Add(NewNPC);
+		SpawnedNPCIDs.Add(GetSlotID(0, SpawnIndex));
 		ConfigureNPCAI(NewNPC, Row);
 	}
 }
@@ -97,18 +126,39 @@ int32 UNPCSpawnerComponent::GetActiveNPCCount() const
 	return Count;
 }
 
+void UNPCSpawnerComponent::SpawnSlot(int32 RowIndex, int32 SlotIndex)
+{
+	const FName NPCID = GetSlotID(RowIndex, SlotIndex);
+	UNPCPoolSubsystem* Pool = GetPool();
+	const FNPCSpawnState* State = Pool ? Pool->FindNPCState(NPCID) : nullptr;
+	if (State && !State->bAlive)
+	{
+		return;
+	}
+
+	const FNPCSpawnRow& Row = CachedSpawnRows[RowIndex];
+	APawn* SpawnedNPC = SpawnSingleNPC(Row, SlotIndex);
+	if (!SpawnedNPC) return;
+
+	SpawnedNPCs.Add(SpawnedNPC);
+	SpawnedNPCIDs.Add(NPCID);
+	ConfigureNPCAI(SpawnedNPC, Row);
+
+	if (State)
+	{
+		ApplyNPCState(SpawnedNPC, *State);
+	}
+}
+
 APawn* UNPCSpawnerComponent::SpawnSingleNPC(const FNPCSpawnRow& Row, int32 SpawnPointIndex)
 {
-	UWorld* World = GetWorld();
-	if (!World || !Row.NPCClass) return nullptr;
+	UNPCPoolSubsystem* Pool = GetPool();
+	if (!Pool || !Row.NPCClass) return nullptr;
 
 	FVector SpawnLoc = GetSpawnLocation(Row, SpawnPointIndex);
 	FRotator SpawnRot = FRotator::ZeroRotator;
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	return World->SpawnActor<APawn>(Row.NPCClass, SpawnLoc, SpawnRot, SpawnParams);
+	return Pool->AcquireNPC(Row.NPCClass, FTransform(SpawnRot, SpawnLoc), CarIndex);
 }
 
 FVector UNPCSpawnerComponent::GetSpawnLocation(const FNPCSpawnRow& Row, int32 SpawnPointIndex) const
@@ -116,10 +166,10 @@ FVector UNPCSpawnerComponent::GetSpawnLocation(const FNPCSpawnRow& Row, int32 Sp
 	// Try tagged spawn points first
 	if (Row.SpawnPointTags.IsValidIndex(SpawnPointIndex))
 	{
-		TArray<AActor*> TaggedActors = FindTaggedActors(Row.SpawnPointTags[SpawnPointIndex]);
-		if (TaggedActors.Num() > 0)
+		const TArray<FVector>* Points = FindSpawnPoints(Row.SpawnPointTags[SpawnPointIndex]);
+		if (Points && Points->Num() > 0)
 		{
-			return TaggedActors[0]->GetActorLocation();
+			return (*Points)[0];
 		}
 	}
 
@@ -143,26 +193,13 @@ FVector UNPCSpawnerComponent::GetSpawnLocation(const FNPCSpawnRow& Row, int32 Sp
 	return Base + FVector(FMath::RandRange(-200.f, 200.f), FMath::RandRange(-100.f, 100.f), 0.f);
 }
 
-TArray<AActor*> UNPCSpawnerComponent::FindTaggedActors(FName Tag) const
+const TArray<FVector>* UNPCSpawnerComponent::FindSpawnPoints(FName Tag) const
 {
-	TArray<AActor*> Result;
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), Tag, AllActors);
+	UNPCPoolSubsystem* Pool = GetPool();
+	if (!Pool) return nullptr;
 
-	// Filter to actors within reasonable range of this car
-	AActor* Owner = GetOwner();
-	if (!Owner) return AllActors;
-
-	float MaxRange = 2000.f;
-	for (AActor* Actor : AllActors)
-	{
-		if (Actor && FVector::Dist(Actor->GetActorLocation(), Owner->GetActorLocation()) < MaxRange)
-		{
-			Result.Add(Actor);
-		}
-	}
-
-	return Result;
+	// Gathered once per car tag by the pool and reused on every later load of this car
+	return Pool->GetCarSpawnPoints(CarTag, GetOwner()).Find(Tag);
 }
 
 void UNPCSpawnerComponent::ConfigureNPCAI(APawn* SpawnedPawn, const FNPCSpawnRow& Row)
@@ -198,13 +235,65 @@ void UNPCSpawnerComponent::ConfigureNPCAI(APawn* SpawnedPawn, const FNPCSpawnRow
 			TArray<FVector> Waypoints;
 			for (const FName& WaypointTag : Row.PatrolWaypointTags)
 			{
-				TArray<AActor*> TaggedActors = FindTaggedActors(WaypointTag);
-				for (AActor* Actor : TaggedActors)
+				if (const TArray<FVector>* Points = FindSpawnPoints(WaypointTag))
 				{
-					Waypoints.Add(Actor->GetActorLocation());
+					Waypoints.Append(*Points);
 				}
 			}
 			AIController->SetPatrolWaypoints(Waypoints);
 		}
 	}
 }
+
+// --- NPC State ---
+
+FName UNPCSpawnerComponent::GetSlotID(int32 RowIndex, int32 SlotIndex) const
+{
+	// Car tag keeps slots apart when cars share a spawn table with reused row names
+	return FName(*FString::Printf(TEXT("%s.%s.%d"), *CarTag.ToString(), *CachedRowNames[RowIndex].ToString(), SlotIndex));
+}
+
+void UNPCSpawnerComponent::ApplyNPCState(APawn* NPC, const FNPCSpawnState& State) const
+{
+	// Pooled pawns come back with their memory already reset, so this only adds
+	if (UNPCMemoryComponent* Memory = NPC->FindComponentByClass<UNPCMemoryComponent>())
+	{
+		for (const FName& Tag : State.MemoryTags)
+		{
+			FNPCMemory Restored;
+			Restored.MemoryTag = Tag;
+			Memory->AddMemory(Restored);
+		}
+		Memory->SetDisposition(State.Disposition);
+	}
+}
+
+FNPCSpawnState UNPCSpawnerComponent::CaptureNPCState(const APawn* NPC, FName NPCID) const
+{
+	FNPCSpawnState State;
+	State.NPCID = NPCID;
+
+	// An NPC destroyed by something other than the pool is recorded as dead
+	if (!NPC || !IsValid(NPC))
+	{
+		State.bAlive = false;
+		return State;
+	}
+
+	if (const ASEENPCCharacter* Character = Cast<ASEENPCCharacter>(NPC))
+	{
+		State.bAlive = !(Character->IsIncapacitated() && Character->GetBodyState() == EBodyState::Dead);
+	}
+	if (const UNPCMemoryComponent* Memory = NPC->FindComponentByClass<UNPCMemoryComponent>())
+	{
+		State.Disposition = Memory->GetDisposition();
+		State.MemoryTags = Memory->GetMemoryTags();
+	}
+	return State;
+}
+
+UNPCPoolSubsystem* UNPCSpawnerComponent::GetPool() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UNPCPoolSubsystem>() : nullptr;
+}
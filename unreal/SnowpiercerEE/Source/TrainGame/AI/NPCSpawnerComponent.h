@@ -9,6 +9,7 @@
 
 class ANPCAIController;
 class UDataTable;
+class UNPCPoolSubsystem;
 
 // ============================================================================
 // UNPCSpawnerComponent
@@ -17,6 +18,11 @@ class UDataTable;
 // definitions from a DataTable (FNPCSpawnRow) and spawns NPCs at
 // tagged locations or random nav mesh positions within the car.
 // Handles initial schedule/patrol setup for spawned NPCs.
+//
+// Pawns come from and return to UNPCPoolSubsystem, so loading a car reuses
+// the pawns and controllers of cars that unloaded before it. Each spawn slot
+// has a stable ID (row name plus slot number); its state is recorded in the
+// pool when the NPC is despawned and re-applied the next time the slot spawns.
 // ============================================================================
 
 UCLASS(ClassGroup=(AI), meta=(BlueprintSpawnableComponent))
@@ -28,6 +34,7 @@ public:
 	UNPCSpawnerComponent();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// --- Spawning ---
 
@@ -35,10 +42,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NPC Spawner")
 	void SpawnNPCs();
 
-	/** Despawn all NPCs managed by this spawner */
+	/** Despawn all NPCs managed by this spawner, returning them to the pool. Runs when the car unloads. */
 	UFUNCTION(BlueprintCallable, Category = "NPC Spawner")
 	void DespawnAll();
 
+	/** Record the state of every managed NPC in the pool (done on despawn; call before saving) */
+	UFUNCTION(BlueprintCallable, Category = "NPC Spawner")
+	void RecordNPCStates();
+
 	/** Respawn a specific NPC that was killed or removed */
 	UFUNCTION(BlueprintCallable, Category = "NPC Spawner")
 	void RespawnNPC(int32 SpawnIndex);
@@ -60,6 +71,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner")
 	FName CarTag = NAME_None;
 
+	/** Index of this car in the train; every NPC this spawner acquires is placed in it for rumor delivery */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner")
+	int32 CarIndex = 0;
+
 	/** Whether to spawn NPCs on BeginPlay */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner")
 	bool bSpawnOnBeginPlay = true;
@@ -79,15 +94,30 @@ private:
 	/** Find a spawn location for the NPC */
 	FVector GetSpawnLocation(const FNPCSpawnRow& Row, int32 SpawnPointIndex) const;
 
-	/** Find actors with a specific tag within the owning car */
-	TArray<AActor*> FindTaggedActors(FName Tag) const;
+	/** Cached locations of actors with a specific tag within the owning car */
+	const TArray<FVector>* FindSpawnPoints(FName Tag) const;
 
 	/** Configure the spawned NPC's AI controller */
 	void ConfigureNPCAI(APawn* SpawnedPawn, const FNPCSpawnRow& Row);
 
+	/** Stable ID of the SlotIndex'th NPC of a cached row */
+	FName GetSlotID(int32 RowIndex, int32 SlotIndex) const;
+
+	/** Spawn one slot and apply its recorded state, unless it is recorded dead */
+	void SpawnSlot(int32 RowIndex, int32 SlotIndex);
+
+	void ApplyNPCState(APawn* NPC, const FNPCSpawnState& State) const;
+	FNPCSpawnState CaptureNPCState(const APawn* NPC, FName NPCID) const;
+
+	UNPCPoolSubsystem* GetPool() const;
+
 	UPROPERTY()
 	TArray<APawn*> SpawnedNPCs;
 
-	/** Cached spawn rows for this car */
+	/** Slot ID of each entry in SpawnedNPCs */
+	TArray<FName> SpawnedNPCIDs;
+
+	/** Cached spawn rows for this car, and their row names */
 	TArray<FNPCSpawnRow> CachedSpawnRows;
+	TArray<FName> CachedRowNames;
 };
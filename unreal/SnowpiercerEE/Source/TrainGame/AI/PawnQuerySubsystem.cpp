@@ -0,0 +1,232 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "PawnQuerySubsystem.h"
+#include "GameFramework/Pawn.h"
+
+void UPawnQuerySubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndexByPawn.Empty();
+	Cells.Empty();
+	Super::Deinitialize();
+}
+
+// --- Registration ---
+
+void UPawnQuerySubsystem::RegisterPawn(APawn* Pawn, EPawnQueryTag Tags)
+{
+	if (!Pawn || Tags == EPawnQueryTag::None)
+	{
+		return;
+	}
+
+	int32 Index = INDEX_NONE;
+	if (const int32* Existing = EntryIndexByPawn.Find(Pawn))
+	{
+		Index = *Existing;
+	}
+	else
+	{
+		Index = Entries.AddDefaulted();
+		Entries[Index].Pawn = Pawn;
+		Entries[Index].Key = Pawn;
+		Entries[Index].Location = Pawn->GetActorLocation();
+		EntryIndexByPawn.Add(Pawn, Index);
+		bGridDirty = true;
+	}
+
+	FPawnEntry& Entry = Entries[Index];
+	for (int32 Bit = 0; Bit < 8; ++Bit)
+	{
+		if (EnumHasAnyFlags(Tags, static_cast<EPawnQueryTag>(1 << Bit)))
+		{
+			++Entry.TagRefs[Bit];
+		}
+	}
+	Entry.Tags |= Tags;
+}
+
+void UPawnQuerySubsystem::UnregisterPawn(APawn* Pawn, EPawnQueryTag Tags)
+{
+	const int32* Found = Pawn ? EntryIndexByPawn.Find(Pawn) : nullptr;
+	if (!Found)
+	{
+		return;
+	}
+
+	const int32 Index = *Found;
+	FPawnEntry& Entry = Entries[Index];
+	for (int32 Bit = 0; Bit < 8; ++Bit)
+	{
+		const EPawnQueryTag Flag = static_cast<EPawnQueryTag>(1 << Bit);
+		if (EnumHasAnyFlags(Tags, Flag) && Entry.TagRefs[Bit] > 0 && --Entry.TagRefs[Bit] == 0)
+		{
+			EnumRemoveFlags(Entry.Tags, Flag);
+		}
+	}
+
+	if (Entry.Tags == EPawnQueryTag::None)
+	{
+		RemoveEntryAt(Index);
+	}
+}
+
+void UPawnQuerySubsystem::RemoveEntryAt(int32 Index)
+{
+	EntryIndexByPawn.Remove(Entries[Index].Key);
+	Entries.RemoveAtSwap(Index);
+
+	// The last entry moved into Index
+	if (Entries.IsValidIndex(Index))
+	{
+		EntryIndexByPawn.Add(Entries[Index].Key, Index);
+	}
+	bGridDirty = true;
+}
+
+// --- Grid ---
+
+FIntPoint UPawnQuerySubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UPawnQuerySubsystem::EnsureGridCurrent()
+{
+	if (!bGridDirty && GridFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	// Drop pawns destroyed without unregistering
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		if (!Entries[i].Pawn.IsValid())
+		{
+			RemoveEntryAt(i);
+		}
+	}
+
+	// Keep cell allocations across rebuilds, but forget cells nobody has used in a while
+	if (Cells.Num() > Entries.Num() * 2 + 64)
+	{
+		Cells.Reset();
+	}
+	for (TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+	{
+		Pair.Value.Reset();
+	}
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		FPawnEntry& Entry = Entries[i];
+		Entry.Location = Entry.Pawn->GetActorLocation();
+		Cells.FindOrAdd(GetCell(Entry.Location)).Add(i);
+	}
+
+	GridFrame = GFrameCounter;
+	bGridDirty = false;
+}
+
+template <typename FuncType>
+void UPawnQuerySubsystem::ForEachCandidate(const FVector& Center, float Radius, EPawnQueryTag RequiredTags, const APawn* Exclude, FuncType&& Func)
+{
+	EnsureGridCurrent();
+
+	const float RadiusSq = FMath::Square(Radius);
+	auto VisitCell = [&](const TArray<int32>& CellEntries)
+	{
+		for (const int32 Index : CellEntries)
+		{
+			const FPawnEntry& Entry = Entries[Index];
+			if (!EnumHasAllFlags(Entry.Tags, RequiredTags))
+			{
+				continue;
+			}
+
+			APawn* Pawn = Entry.Pawn.Get();
+			if (!Pawn || Pawn == Exclude)
+			{
+				continue;
+			}
+
+			const float DistSq = FVector::DistSquared(Center, Entry.Location);
+			if (DistSq <= RadiusSq)
+			{
+				Func(Pawn, DistSq);
+			}
+		}
+	};
+
+	const FIntPoint MinCell = GetCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = GetCell(Center + FVector(Radius));
+	const int64 NumCellsInRange = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	// Very large radii (radio range) cover more cells than are occupied; walk the occupied ones
+	if (NumCellsInRange > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+		{
+			if (Pair.Key.X >= MinCell.X && Pair.Key.X <= MaxCell.X && Pair.Key.Y >= MinCell.Y && Pair.Key.Y <= MaxCell.Y)
+			{
+				VisitCell(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			if (const TArray<int32>* CellEntries = Cells.Find(FIntPoint(X, Y)))
+			{
+				VisitCell(*CellEntries);
+			}
+		}
+	}
+}
+
+// --- Queries ---
+
+int32 UPawnQuerySubsystem::QueryRadius(const FVector& Center, float Radius, EPawnQueryTag RequiredTags,
+	TArray<APawn*>& OutPawns, const APawn* Exclude)
+{
+	OutPawns.Reset();
+	ForEachCandidate(Center, Radius, RequiredTags, Exclude, [&OutPawns](APawn* Pawn, float)
+	{
+		OutPawns.Add(Pawn);
+	});
+	return OutPawns.Num();
+}
+
+int32 UPawnQuerySubsystem::QueryNearest(const FVector& Center, float Radius, int32 MaxResults, EPawnQueryTag RequiredTags,
+	TArray<APawn*>& OutPawns, const APawn* Exclude)
+{
+	OutPawns.Reset();
+	if (MaxResults <= 0)
+	{
+		return 0;
+	}
+
+	TArray<TPair<float, APawn*>, TInlineAllocator<64>> Candidates;
+	ForEachCandidate(Center, Radius, RequiredTags, Exclude, [&Candidates](APawn* Pawn, float DistSq)
+	{
+		Candidates.Emplace(DistSq, Pawn);
+	});
+
+	Candidates.Sort([](const TPair<float, APawn*>& A, const TPair<float, APawn*>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	const int32 NumResults = FMath::Min(MaxResults, Candidates.Num());
+	OutPawns.Reserve(NumResults);
+	for (int32 i = 0; i < NumResults; ++i)
+	{
+		OutPawns.Add(Candidates[i].Value);
+	}
+	return NumResults;
+}
@@ -0,0 +1,102 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PawnQuerySubsystem.generated.h"
+
+// ============================================================================
+// UPawnQuerySubsystem
+//
+// World subsystem answering "which pawns are near here" without walking every
+// actor in the world. Pawns register with a tag mask describing what they are
+// (NPC, crowd, Jackboot, combatant, noise listener); positions are bucketed into a uniform
+// grid that is rebuilt at most once per frame, on the first query after the
+// frame advances. Radius and k-nearest queries then only visit the cells the
+// query circle overlaps.
+//
+// Registration is reference counted per tag: a pawn stays registered while
+// any of its tags are held, so a character and its controller can each add
+// their own tag.
+// ============================================================================
+
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EPawnQueryTag : uint8
+{
+	None		= 0			UMETA(Hidden),
+	NPC			= 1 << 0	UMETA(DisplayName = "NPC"),
+	Crowd		= 1 << 1	UMETA(DisplayName = "Crowd"),
+	Jackboot	= 1 << 2	UMETA(DisplayName = "Jackboot"),
+	Combatant	= 1 << 3	UMETA(DisplayName = "Combatant"),
+	Listener	= 1 << 4	UMETA(DisplayName = "Noise Listener")
+};
+ENUM_CLASS_FLAGS(EPawnQueryTag)
+
+UCLASS()
+class TRAINGAME_API UPawnQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// --- Registration ---
+
+	/** Add tags to a pawn, registering it if it was not yet tracked */
+	void RegisterPawn(APawn* Pawn, EPawnQueryTag Tags);
+
+	/** Remove tags from a pawn; it is dropped once it has none left */
+	void UnregisterPawn(APawn* Pawn, EPawnQueryTag Tags);
+
+	// --- Queries ---
+
+	/**
+	 * Registered pawns carrying all of RequiredTags within Radius of Center,
+	 * in no particular order. OutPawns is reset first. Returns the count.
+	 */
+	int32 QueryRadius(const FVector& Center, float Radius, EPawnQueryTag RequiredTags,
+		TArray<APawn*>& OutPawns, const APawn* Exclude = nullptr);
+
+	/** Like QueryRadius, but only the MaxResults nearest, sorted nearest first */
+	int32 QueryNearest(const FVector& Center, float Radius, int32 MaxResults, EPawnQueryTag RequiredTags,
+		TArray<APawn*>& OutPawns, const APawn* Exclude = nullptr);
+
+	int32 GetNumRegisteredPawns() const { return Entries.Num(); }
+
+private:
+	struct FPawnEntry
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		TObjectKey<APawn> Key;
+		FVector Location = FVector::ZeroVector;
+		EPawnQueryTag Tags = EPawnQueryTag::None;
+
+		// How many registrations hold each tag bit
+		uint8 TagRefs[8] = {};
+	};
+
+	/** Re-bucket every pawn if the frame has advanced or registrations changed */
+	void EnsureGridCurrent();
+
+	void RemoveEntryAt(int32 Index);
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Visit every entry in cells overlapping the query circle that passes the tag and exclude filters */
+	template <typename FuncType>
+	void ForEachCandidate(const FVector& Center, float Radius, EPawnQueryTag RequiredTags, const APawn* Exclude, FuncType&& Func);
+
+	TArray<FPawnEntry> Entries;
+	TMap<TObjectKey<APawn>, int32> EntryIndexByPawn;
+
+	/** Entry indices per grid cell, XY only; the train is one deck high */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	uint64 GridFrame = MAX_uint64;
+	bool bGridDirty = true;
+
+	/** Grid cell edge length (cm). Large enough that typical alert radii span only a few cells. */
+	static constexpr float CellSize = 1000.f;
+};
@@ -3,9 +3,13 @@
 #include "SEENPCCharacter.h"
 #include "BodyDiscoveryComponent.h"
 #include "NPCScheduleComponent.h"
+#include "NPCScheduleSubsystem.h"
 #include "TrainGame/Stealth/DetectionComponent.h"
 #include "TrainGame/Combat/CombatComponent.h"
 #include "TrainGame/Dialogue/NPCMemoryComponent.h"
+#include "TrainGame/Dialogue/NPCRegistrySubsystem.h"
+#include "TrainGame/Stealth/NoisePropagationSubsystem.h"
+#include "TrainGame/Stealth/PerceptionSubsystem.h"
 #include "TrainGame/Companions/CompanionComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -43,6 +47,27 @@ void ASEENPCCharacter::BeginPlay()
 	{
 		CompanionComp = FindComponentByClass<UCompanionComponent>();
 	}
+
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQueryTags = EPawnQueryTag::NPC;
+		if (NPCRole == ENPCClass::Jackboot)
+		{
+			PawnQueryTags |= EPawnQueryTag::Jackboot;
+		}
+		PawnQuery->RegisterPawn(this, PawnQueryTags);
+	}
+}
+
+void ASEENPCCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->UnregisterPawn(this, PawnQueryTags);
+	}
+	PawnQueryTags = EPawnQueryTag::None;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASEENPCCharacter::Incapacitate(EBodyState State)
@@ -108,3 +133,104 @@ void ASEENPCCharacter::Revive()
 	// Re-possess with AI
 	SpawnDefaultController();
 }
+
+// --- Pooling ---
+
+void ASEENPCCharacter::SetDormant(bool bDormant)
+{
+	if (bIsDormant == bDormant) return;
+	bIsDormant = bDormant;
+
+	// Mirrors the BeginPlay/EndPlay registrations of this actor and its components
+	UWorld* World = GetWorld();
+
+	if (UPawnQuerySubsystem* PawnQuery = World->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		if (bDormant)
+		{
+			PawnQuery->UnregisterPawn(this, PawnQueryTags);
+		}
+		else
+		{
+			PawnQuery->RegisterPawn(this, PawnQueryTags);
+		}
+	}
+
+	if (DetectionComp)
+	{
+		UPerceptionSubsystem* Perception = World->GetSubsystem<UPerceptionSubsystem>();
+		UNoisePropagationSubsystem* Noise = World->GetSubsystem<UNoisePropagationSubsystem>();
+		if (bDormant)
+		{
+			if (Perception) Perception->UnregisterDetector(DetectionComp);
+			if (Noise) Noise->UnregisterListener(DetectionComp);
+		}
+		else
+		{
+			if (Perception) Perception->RegisterDetector(DetectionComp);
+			if (Noise) Noise->RegisterListener(DetectionComp);
+		}
+	}
+
+	if (UNPCScheduleSubsystem* Schedules = World->GetSubsystem<UNPCScheduleSubsystem>())
+	{
+		if (bDormant)
+		{
+			Schedules->UnregisterSchedule(ScheduleComp);
+		}
+		else if (ScheduleComp)
+		{
+			Schedules->RegisterSchedule(ScheduleComp);
+		}
+	}
+
+	if (MemoryComp)
+	{
+		if (UNPCRegistrySubsystem* Registry = World->GetSubsystem<UNPCRegistrySubsystem>())
+		{
+			if (bDormant)
+			{
+				Registry->UnregisterNPC(MemoryComp, MemoryComp->GetCarIndex());
+			}
+			else
+			{
+				Registry->RegisterNPC(MemoryComp, MemoryComp->GetCarIndex());
+			}
+		}
+	}
+}
+
+void ASEENPCCharacter::ResetForReuse()
+{
+	if (bIsIncapacitated)
+	{
+		bIsIncapacitated = false;
+		CurrentBodyState = EBodyState::Stunned;
+		UBodyDiscoveryComponent::UnregisterBody(this);
+
+		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+		{
+			MoveComp->SetMovementMode(MOVE_Walking);
+		}
+
+		// Pull the mesh back out of ragdoll onto the capsule
+		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		GetMesh()->SetSimulatePhysics(false);
+		GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+	}
+
+	CurrentHealth = MaxHealth;
+	CurrentState = ENPCAIState::Idle;
+	DetectionLevel = 0.0f;
+
+	if (DetectionComp)
+	{
+		DetectionComp->ResetDetection();
+	}
+
+	if (MemoryComp)
+	{
+		MemoryComp->ResetMemory();
+	}
+}
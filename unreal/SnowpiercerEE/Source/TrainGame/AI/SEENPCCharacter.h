@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "TrainGameAITypes.h"
+#include "PawnQuerySubsystem.h"
 #include "TrainGame/Stealth/StealthTypes.h"
 #include "SEENPCCharacter.generated.h"
 
@@ -45,6 +46,7 @@ public:
 	ASEENPCCharacter();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// --- Identity ---
 
@@ -96,6 +98,21 @@ public:
 	UFUNCTION(BlueprintPure, Category = "NPC")
 	float GetDetectionLevel() const { return DetectionLevel; }
 
+	// --- Pooling ---
+
+	/** Whether this NPC is parked in the NPC pool */
+	UFUNCTION(BlueprintPure, Category = "NPC")
+	bool IsDormant() const { return bIsDormant; }
+
+	/**
+	 * Park or wake a pooled NPC. A dormant NPC is dropped from pawn queries,
+	 * perception, noise, schedules and the NPC registry until woken.
+	 */
+	void SetDormant(bool bDormant);
+
+	/** Return a recycled NPC to its freshly spawned state: alive, full health, idle */
+	void ResetForReuse();
+
 	// --- Component Access ---
 
 	UFUNCTION(BlueprintPure, Category = "NPC")
@@ -186,6 +203,9 @@ protected:
 
 	float DetectionLevel = 0.0f;
 
+	/** Tags this NPC registered with the pawn query subsystem */
+	EPawnQueryTag PawnQueryTags = EPawnQueryTag::None;
+
 	// --- Components ---
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "NPC|Components")
@@ -212,4 +232,5 @@ protected:
 private:
 	bool bIsIncapacitated = false;
 	EBodyState CurrentBodyState = EBodyState::Stunned;
+	bool bIsDormant = false;
 };
@@ -156,6 +156,31 @@ struct FNPCSpawnRow : public FTableRowBase
 	EStealthZone Zone = EStealthZone::ThirdClass;
 };
 
+/**
+ * State of one spawner-placed NPC, carried across car loads. The spawner
+ * records it in UNPCPoolSubsystem when the car unloads and applies it when the
+ * car's NPCs spawn again. It lasts for the session only; saves do not store it.
+ */
+USTRUCT(BlueprintType)
+struct FNPCSpawnState
+{
+	GENERATED_BODY()
+
+	/** Stable ID of the spawn slot (see UNPCSpawnerComponent::GetSlotID) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner")
+	FName NPCID = NAME_None;
+
+	/** Dead NPCs are not spawned again */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner")
+	bool bAlive = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner")
+	int32 Disposition = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawner")
+	TArray<FName> MemoryTags;
+};
+
 /** Blackboard key names — centralized to avoid typos */
 namespace BBKeys
 {
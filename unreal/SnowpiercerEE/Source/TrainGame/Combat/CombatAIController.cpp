@@ -2,8 +2,10 @@
 
 #include "CombatAIController.h"
 #include "CombatComponent.h"
+#include "TrainGame/AI/PawnQuerySubsystem.h"
 #include "TrainGame/Weapons/WeaponComponent.h"
 #include "TrainGame/Environment/EnvironmentalHazardComponent.h"
+#include "TrainGame/Environment/HazardSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Navigation/PathFollowingComponent.h"
@@ -20,6 +22,21 @@ void ACombatAIController::OnPossess(APawn* InPawn)
 
 	CombatComp = InPawn->FindComponentByClass<UCombatComponent>();
 	ApplyProfileModifiers();
+
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->RegisterPawn(InPawn, EPawnQueryTag::Combatant);
+	}
+}
+
+void ACombatAIController::OnUnPossess()
+{
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->UnregisterPawn(GetPawn(), EPawnQueryTag::Combatant);
+	}
+
+	Super::OnUnPossess();
 }
 
 void ACombatAIController::Tick(float DeltaTime)
@@ -295,51 +312,29 @@ AActor* ACombatAIController::FindNearbyHazard(AActor* NearActor) const
 {
 	if (!NearActor) return nullptr;
 
-	// Search for hazard components in nearby actors
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), AllActors);
+	UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>();
+	if (!Hazards) return nullptr;
 
-	float ClosestDist = 300.f; // Search radius for nearby hazards
-	AActor* ClosestHazard = nullptr;
-
-	for (AActor* Actor : AllActors)
-	{
-		UEnvironmentalHazardComponent* HazardComp = Actor->FindComponentByClass<UEnvironmentalHazardComponent>();
-		if (HazardComp && HazardComp->CanTrigger())
-		{
-			float Dist = FVector::Dist(NearActor->GetActorLocation(), Actor->GetActorLocation());
-			if (Dist < ClosestDist)
-			{
-				ClosestDist = Dist;
-				ClosestHazard = Actor;
-			}
-		}
-	}
-
-	return ClosestHazard;
+	// Search radius for nearby hazards
+	UEnvironmentalHazardComponent* HazardComp = Hazards->FindTriggerableHazard(NearActor->GetActorLocation(), 300.f);
+	return HazardComp ? HazardComp->GetOwner() : nullptr;
 }
 
 int32 ACombatAIController::GetEngagingAICount() const
 {
 	if (!CurrentTarget) return 0;
 
-	int32 Count = 0;
-	TArray<AActor*> AllPawns;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), AllPawns);
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery) return 0;
 
-	for (AActor* Actor : AllPawns)
-	{
-		if (Actor == GetPawn()) continue; // Don't count ourselves
-
-		APawn* OtherPawn = Cast<APawn>(Actor);
-		if (!OtherPawn) continue;
-
-		ACombatAIController* OtherAI = Cast<ACombatAIController>(OtherPawn->GetController());
-		if (!OtherAI) continue;
+	// Other combatants close to the same target (excluding ourselves)
+	TArray<APawn*> NearbyPawns;
+	PawnQuery->QueryRadius(CurrentTarget->GetActorLocation(), PreferredCombatRange * 1.5f, EPawnQueryTag::Combatant, NearbyPawns, GetPawn());
 
-		// Check if other AI is close to the same target
-		float Dist = FVector::Dist(OtherPawn->GetActorLocation(), CurrentTarget->GetActorLocation());
-		if (Dist <= PreferredCombatRange * 1.5f)
+	int32 Count = 0;
+	for (APawn* OtherPawn : NearbyPawns)
+	{
+		if (Cast<ACombatAIController>(OtherPawn->GetController()))
 		{
 			Count++;
 		}
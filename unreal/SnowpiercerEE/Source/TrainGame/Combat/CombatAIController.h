@@ -47,6 +47,7 @@ public:
 	ACombatAIController();
 
 	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
 	virtual void Tick(float DeltaTime) override;
 
 	/** Configure AI from enemy stats (called by EnemyCharacter) */
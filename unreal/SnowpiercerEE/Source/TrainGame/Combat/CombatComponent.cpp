@@ -1,10 +1,10 @@
 // Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
 
 #include "CombatComponent.h"
+#include "CombatResolutionSubsystem.h"
 #include "ProjectileBase.h"
 #include "TrainGame/Weapons/WeaponComponent.h"
 #include "GameFramework/Character.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
@@ -100,6 +100,7 @@ FHitResult_Combat UCombatComponent::PerformAttack(EAttackDirection Direction)
 	float Range = 150.f;
 	float Speed = 1.f;
 	float DurabilityLoss = 0.f;
+	int32 MaxTargets = MaxTargetsPerAttack;
 
 	EDamageType WeaponDamageType = EDamageType::Physical;
 	if (WeaponComp && WeaponComp->HasWeaponEquipped() && !WeaponComp->IsWeaponBroken())
@@ -110,6 +111,7 @@ FHitResult_Combat UCombatComponent::PerformAttack(EAttackDirection Direction)
 		Range = Weapon.Range;
 		Speed = Weapon.AttackSpeed;
 		WeaponDamageType = Weapon.GetDamageType();
+		MaxTargets = FMath::Max(MaxTargets, Weapon.MaxTargets);
 	}
 
 	// Check stamina
@@ -130,44 +132,24 @@ FHitResult_Combat UCombatComponent::PerformAttack(EAttackDirection Direction)
 	// Set stance
 	SetStance(ECombatStance::Attacking);
 
-	// Perform melee trace
-	AActor* HitTarget = PerformMeleeTrace(Range);
+	Result.AttackDirection = Direction;
+	Result.DamageType = WeaponDamageType;
 
-	if (HitTarget)
+	// Targets, criticals and damage are resolved with every other swing this frame
+	if (UCombatResolutionSubsystem* Resolution = GetWorld()->GetSubsystem<UCombatResolutionSubsystem>())
 	{
-		Result.bHit = true;
-		Result.AttackDirection = Direction;
-		Result.DamageType = WeaponDamageType;
-
-		// Check for critical hit
-		Result.bCritical = FMath::FRand() < CriticalHitChance;
-		float FinalDamage = Damage;
-		if (Result.bCritical)
-		{
-			FinalDamage *= CriticalHitMultiplier;
-		}
-
-		// Apply Kronole mode damage bonus
-		if (bKronoleModeActive)
-		{
-			FinalDamage *= 1.5f;
-		}
-
-		// Send damage to target's combat component
-		UCombatComponent* TargetCombat = HitTarget->FindComponentByClass<UCombatComponent>();
-		if (TargetCombat)
-		{
-			FHitResult_Combat TargetResult = TargetCombat->ReceiveAttack(FinalDamage, Direction, WeaponDamageType, GetOwner());
-			Result.bBlocked = TargetResult.bBlocked;
-			Result.bDodged = TargetResult.bDodged;
-			Result.DamageDealt = TargetResult.DamageDealt;
-		}
-		else
-		{
-			Result.DamageDealt = FinalDamage;
-		}
-
-		OnHitLanded.Broadcast(Result);
+		FCombatAttack Attack;
+		Attack.Direction = Direction;
+		Attack.DamageType = WeaponDamageType;
+		Attack.BaseDamage = Damage;
+		Attack.DamageBonus = bKronoleModeActive ? 1.5f : 1.f;
+		Attack.CritChance = CriticalHitChance;
+		Attack.CritMultiplier = CriticalHitMultiplier;
+		Attack.CleaveMultiplier = CleaveDamageMultiplier;
+		Attack.Range = Range;
+		Attack.ArcHalfAngle = MeleeArcHalfAngle;
+		Attack.MaxTargets = MaxTargets;
+		Resolution->QueueAttack(this, Attack);
 	}
 
 	// Return to neutral after attack (animation system would handle timing)
@@ -236,31 +218,16 @@ bool UCombatComponent::PerformDodge(FVector DodgeDirection)
 
 FHitResult_Combat UCombatComponent::ReceiveAttack(float IncomingDamage, EAttackDirection Direction, EDamageType DamageType, AActor* Attacker)
 {
-	FHitResult_Combat Result;
-	Result.AttackDirection = Direction;
-	Result.DamageType = DamageType;
+	const FHitResult_Combat Result = GetDefense(Direction, DamageType).Resolve(IncomingDamage, Direction, DamageType);
 
 	// Dodged (in i-frames)
-	if (bInIFrames)
+	if (Result.bDodged)
 	{
-		Result.bDodged = true;
-		Result.DamageDealt = 0.f;
 		return Result;
 	}
 
-	float FinalDamage = IncomingDamage;
-
-	// Apply damage resistance
-	float ResistMult = GetDamageResistance(DamageType);
-	FinalDamage *= ResistMult;
-
-	// Blocking
-	if (CurrentStance == ECombatStance::Blocking)
+	if (Result.bBlocked)
 	{
-		float Reduction = CalculateBlockReduction(Direction);
-		FinalDamage *= (1.f - Reduction);
-		Result.bBlocked = true;
-
 		// Blocking costs stamina
 		ConsumeStamina(BlockStaminaCost);
 
@@ -277,21 +244,23 @@ FHitResult_Combat UCombatComponent::ReceiveAttack(float IncomingDamage, EAttackD
 		}
 	}
 
-	// Staggered targets take more damage
-	if (CurrentStance == ECombatStance::Staggered)
-	{
-		FinalDamage *= 1.5f;
-	}
-
-	Result.DamageDealt = FinalDamage;
-	Result.bHit = true;
-
-	ApplyDamage(FinalDamage, Attacker);
+	ApplyDamage(Result.DamageDealt, Attacker);
 	OnHitReceived.Broadcast(Result);
 
 	return Result;
 }
 
+FCombatDefense UCombatComponent::GetDefense(EAttackDirection Direction, EDamageType DamageType) const
+{
+	FCombatDefense Defense;
+	Defense.ResistanceMultiplier = GetDamageResistance(DamageType);
+	Defense.bInIFrames = bInIFrames;
+	Defense.bBlocking = CurrentStance == ECombatStance::Blocking;
+	Defense.BlockReduction = Defense.bBlocking ? CalculateBlockReduction(Direction) : 0.f;
+	Defense.bStaggered = CurrentStance == ECombatStance::Staggered;
+	return Defense;
+}
+
 // ============================================================================
 // Kronole Mode
 // ============================================================================
@@ -557,39 +526,3 @@ float UCombatComponent::GetDamageResistance(EDamageType Type) const
 	const float* Found = DamageResistances.Find(Type);
 	return Found ? *Found : 1.f;
 }
-
-// ============================================================================
-// Melee Trace
-// ============================================================================
-
-AActor* UCombatComponent::PerformMeleeTrace(float TraceRange) const
-{
-	AActor* Owner = GetOwner();
-	if (!Owner) return nullptr;
-
-	FVector Start = Owner->GetActorLocation();
-	FVector Forward = Owner->GetActorForwardVector();
-	FVector End = Start + Forward * TraceRange;
-
-	// Sphere trace for melee (wider than line trace to account for weapon swing arc)
-	FHitResult HitResult;
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(Owner);
-
-	bool bHit = GetWorld()->SweepSingleByChannel(
-		HitResult,
-		Start,
-		End,
-		FQuat::Identity,
-		ECollisionChannel::ECC_Pawn,
-		FCollisionShape::MakeSphere(50.f),
-		Params
-	);
-
-	if (bHit && HitResult.GetActor())
-	{
-		return HitResult.GetActor();
-	}
-
-	return nullptr;
-}
@@ -39,7 +39,12 @@ public:
 
 	// --- Actions ---
 
-	/** Initiate a melee attack in the given direction */
+	/**
+	 * Initiate a melee attack in the given direction. The swing is queued with
+	 * UCombatResolutionSubsystem and lands on the next frame through
+	 * OnHitLanded, once per target; the returned result only reports that the
+	 * attack started (bHit is always false).
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	FHitResult_Combat PerformAttack(EAttackDirection Direction);
 
@@ -58,6 +63,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	FHitResult_Combat ReceiveAttack(float IncomingDamage, EAttackDirection Direction, EDamageType DamageType, AActor* Attacker);
 
+	/** How this combatant would meet a hit right now (what ReceiveAttack resolves against) */
+	FCombatDefense GetDefense(EAttackDirection Direction, EDamageType DamageType) const;
+
 	// --- Ranged Combat ---
 
 	/** Fire a ranged weapon — spawns a projectile actor */
@@ -261,6 +269,22 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Attack")
 	float CriticalHitMultiplier = 2.f;
 
+	/** Half-angle of the melee swing arc (degrees) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Attack", meta = (ClampMin = "0", ClampMax = "90"))
+	float MeleeArcHalfAngle = 35.f;
+
+	/** Most targets one swing can hit, nearest first. Raise it for archetypes that cleave with anything; weapons opt in through FWeaponStats::MaxTargets */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Attack", meta = (ClampMin = "1"))
+	int32 MaxTargetsPerAttack = 1;
+
+	/** Side this combatant fights on; a cleave never carries into someone sharing a non-None team */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Attack")
+	FName CombatTeam = NAME_None;
+
+	/** Damage multiplier for every target after the first */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Attack", meta = (ClampMin = "0", ClampMax = "1"))
+	float CleaveDamageMultiplier = 0.5f;
+
 	// --- Ranged Combat ---
 
 	/** Projectile class to spawn for ranged attacks */
@@ -294,9 +318,6 @@ private:
 	float CalculateBlockReduction(EAttackDirection AttackDir) const;
 	bool DoesBlockMatchAttack(EAttackDirection AttackDir) const;
 
-	/** Perform a melee trace to find targets */
-	AActor* PerformMeleeTrace(float TraceRange) const;
-
 	ECombatStance CurrentStance = ECombatStance::Neutral;
 	EBlockDirection CurrentBlockDirection = EBlockDirection::Mid;
 
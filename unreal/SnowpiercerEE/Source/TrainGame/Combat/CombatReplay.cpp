@@ -0,0 +1,279 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "CombatReplay.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace CombatReplay
+{
+	// ========================================================================
+	// Files
+	// ========================================================================
+
+	FString GetDefaultLogPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("Profiling") / TEXT("CombatFight.bin");
+	}
+
+	bool SaveFightLog(const FCombatFightLog& Log, const FString& Path)
+	{
+		// Tagged, so logs recorded before a field was added still load
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		FCombatFightLog::StaticStruct()->SerializeItem(Writer, const_cast<FCombatFightLog*>(&Log), nullptr);
+		return FFileHelper::SaveArrayToFile(Bytes, *Path);
+	}
+
+	bool LoadFightLog(const FString& Path, FCombatFightLog& OutLog)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+		{
+			return false;
+		}
+
+		OutLog = FCombatFightLog();
+		FMemoryReader Reader(Bytes);
+		FCombatFightLog::StaticStruct()->SerializeItem(Reader, &OutLog, nullptr);
+		return !Reader.IsError();
+	}
+
+	FString FightLogToCsv(const FCombatFightLog& Log)
+	{
+		FString Csv = TEXT("Frame,Attacker,Target,Direction,BaseDamage,Incoming,Critical,Dealt,Hit,Blocked,Dodged,Staggered\n");
+		for (const FCombatLogAttack& Attack : Log.Attacks)
+		{
+			for (const FCombatLogHit& Hit : Attack.Hits)
+			{
+				Csv += FString::Printf(TEXT("%d,%s,%s,%d,%.2f,%.2f,%d,%.2f,%d,%d,%d,%d\n"),
+					Attack.Frame, *Attack.Attacker.ToString(), *Hit.Target.ToString(),
+					static_cast<int32>(Attack.Attack.Direction), Attack.Attack.BaseDamage, Hit.IncomingDamage,
+					Hit.Result.bCritical ? 1 : 0, Hit.Result.DamageDealt, Hit.Result.bHit ? 1 : 0,
+					Hit.Result.bBlocked ? 1 : 0, Hit.Result.bDodged ? 1 : 0, Hit.Result.bStaggered ? 1 : 0);
+			}
+		}
+		return Csv;
+	}
+
+	// ========================================================================
+	// Verification
+	// ========================================================================
+
+	static bool SameResult(const FCombatLogHit& Logged, float IncomingDamage, const FHitResult_Combat& Result)
+	{
+		return FMath::IsNearlyEqual(Logged.IncomingDamage, IncomingDamage)
+			&& FMath::IsNearlyEqual(Logged.Result.DamageDealt, Result.DamageDealt)
+			&& Logged.Result.bCritical == Result.bCritical
+			&& Logged.Result.bHit == Result.bHit
+			&& Logged.Result.bBlocked == Result.bBlocked
+			&& Logged.Result.bDodged == Result.bDodged;
+	}
+
+	FReplayReport VerifyFightLog(const FCombatFightLog& Log)
+	{
+		FReplayReport Report;
+		Report.NumAttacks = Log.Attacks.Num();
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Same stream, same order of rolls as the live resolution
+		FRandomStream Stream(Log.Seed);
+		for (int32 AttackIndex = 0; AttackIndex < Log.Attacks.Num(); ++AttackIndex)
+		{
+			const FCombatLogAttack& Attack = Log.Attacks[AttackIndex];
+			for (int32 HitIndex = 0; HitIndex < Attack.Hits.Num(); ++HitIndex)
+			{
+				const FCombatLogHit& Hit = Attack.Hits[HitIndex];
+
+				bool bCritical = false;
+				const float Damage = UCombatResolutionSubsystem::RollHitDamage(Attack.Attack, HitIndex, Stream, bCritical);
+				FHitResult_Combat Result = Hit.Defense.Resolve(Damage, Attack.Attack.Direction, Attack.Attack.DamageType);
+				Result.bCritical = bCritical;
+
+				++Report.NumHits;
+				if (!SameResult(Hit, Damage, Result))
+				{
+					if (Report.NumMismatches == 0)
+					{
+						Report.FirstMismatch = FString::Printf(TEXT("%d:%d"), AttackIndex, HitIndex);
+					}
+					++Report.NumMismatches;
+				}
+			}
+		}
+
+		Report.ResolveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return Report;
+	}
+
+	void LogReplayReport(const FReplayReport& Report)
+	{
+		if (Report.Matches())
+		{
+			UE_LOG(LogTemp, Display, TEXT("CombatReplay: %d attacks, %d hits re-resolved identically in %.2f ms"),
+				Report.NumAttacks, Report.NumHits, Report.ResolveMs);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("CombatReplay: %d of %d hits resolved differently (first at attack:hit %s)"),
+				Report.NumMismatches, Report.NumHits, *Report.FirstMismatch);
+		}
+	}
+
+	// ========================================================================
+	// Benchmark
+	// ========================================================================
+
+	FCombatFightLog MakeSyntheticBrawl(const FBrawlConfig& Config)
+	{
+		// Scenario rolls come from their own stream so they never disturb the critical stream
+		FRandomStream Scenario(Config.Seed * 7919 + 17);
+
+		FCombatFightLog Log;
+		Log.Seed = Config.Seed;
+		Log.Attacks.Reserve(Config.NumAttacks);
+
+		FRandomStream Stream(Log.Seed);
+		const int32 NumCombatants = FMath::Max(Config.NumCombatants, 2);
+
+		for (int32 i = 0; i < Config.NumAttacks; ++i)
+		{
+			FCombatLogAttack& Attack = Log.Attacks.AddDefaulted_GetRef();
+			Attack.Frame = i / NumCombatants;
+			Attack.Attacker = FName(TEXT("Combatant"), Scenario.RandRange(1, NumCombatants));
+
+			FCombatAttack& Swing = Attack.Attack;
+			Swing.Direction = static_cast<EAttackDirection>(Scenario.RandRange(0, 2));
+			Swing.DamageType = Scenario.FRand() < 0.7f ? EDamageType::Physical : EDamageType::Cold;
+			Swing.BaseDamage = Scenario.FRandRange(8.f, 30.f);
+			Swing.DamageBonus = Scenario.FRand() < 0.05f ? 1.5f : 1.f;
+			Swing.CritChance = 0.1f;
+			Swing.CritMultiplier = 2.f;
+			Swing.CleaveMultiplier = 0.5f;
+			Swing.Range = 150.f;
+			Swing.ArcHalfAngle = 35.f;
+			Swing.MaxTargets = 3;
+
+			const int32 NumHits = Scenario.RandRange(0, Swing.MaxTargets);
+			for (int32 HitIndex = 0; HitIndex < NumHits; ++HitIndex)
+			{
+				FCombatLogHit& Hit = Attack.Hits.AddDefaulted_GetRef();
+				Hit.Target = FName(TEXT("Combatant"), Scenario.RandRange(1, NumCombatants));
+
+				FCombatDefense& Defense = Hit.Defense;
+				Defense.ResistanceMultiplier = Scenario.FRandRange(0.5f, 1.5f);
+				Defense.bInIFrames = Scenario.FRand() < 0.1f;
+				Defense.bBlocking = Scenario.FRand() < 0.25f;
+				Defense.BlockReduction = Scenario.FRandRange(0.5f, 0.9f);
+				Defense.bStaggered = Scenario.FRand() < 0.1f;
+
+				bool bCritical = false;
+				Hit.IncomingDamage = UCombatResolutionSubsystem::RollHitDamage(Swing, HitIndex, Stream, bCritical);
+				Hit.Result = Defense.Resolve(Hit.IncomingDamage, Swing.Direction, Swing.DamageType);
+				Hit.Result.bCritical = bCritical;
+			}
+		}
+
+		return Log;
+	}
+
+	FReplayReport RunBrawlBenchmark(const FBrawlConfig& Config, int32 Iterations)
+	{
+		const FCombatFightLog Log = MakeSyntheticBrawl(Config);
+
+		FReplayReport Best;
+		for (int32 i = 0; i < FMath::Max(Iterations, 1); ++i)
+		{
+			const FReplayReport Report = VerifyFightLog(Log);
+			if (i == 0 || Report.ResolveMs < Best.ResolveMs || !Report.Matches())
+			{
+				Best = Report;
+			}
+			if (!Report.Matches())
+			{
+				break;
+			}
+		}
+
+		LogReplayReport(Best);
+		if (Best.ResolveMs > 0.0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("CombatReplay: brawl of %d combatants, best of %d: %.0f hits/s"),
+				Config.NumCombatants, Iterations, Best.NumHits / (Best.ResolveMs / 1000.0));
+		}
+		return Best;
+	}
+
+	// ========================================================================
+	// Console Commands
+	// ========================================================================
+
+	static FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("Combat.Log.Record"),
+		TEXT("Reseed combat resolution and start logging every attack. Usage: Combat.Log.Record [Seed=1]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UCombatResolutionSubsystem* Resolution = World ? World->GetSubsystem<UCombatResolutionSubsystem>() : nullptr;
+			if (Resolution)
+			{
+				Resolution->StartRecording(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1);
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("Combat.Log.Stop"),
+		TEXT("Stop logging, save the fight log and a CSV beside it, and verify it. Usage: Combat.Log.Stop [Path]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UCombatResolutionSubsystem* Resolution = World ? World->GetSubsystem<UCombatResolutionSubsystem>() : nullptr;
+			if (!Resolution || !Resolution->IsRecording())
+			{
+				return;
+			}
+
+			const FCombatFightLog Log = Resolution->StopRecording();
+			const FString Path = Args.Num() > 0 ? Args[0] : GetDefaultLogPath();
+			if (SaveFightLog(Log, Path) && FFileHelper::SaveStringToFile(FightLogToCsv(Log), *FPaths::ChangeExtension(Path, TEXT("csv"))))
+			{
+				UE_LOG(LogTemp, Display, TEXT("CombatReplay: wrote %s"), *Path);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("CombatReplay: could not write %s"), *Path);
+			}
+			LogReplayReport(VerifyFightLog(Log));
+		}));
+
+	static FAutoConsoleCommand VerifyCommand(
+		TEXT("Combat.Log.Verify"),
+		TEXT("Re-resolve a saved fight log and report any hit that now resolves differently. Usage: Combat.Log.Verify [Path]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString Path = Args.Num() > 0 ? Args[0] : GetDefaultLogPath();
+			FCombatFightLog Log;
+			if (!LoadFightLog(Path, Log))
+			{
+				UE_LOG(LogTemp, Error, TEXT("CombatReplay: could not read %s"), *Path);
+				return;
+			}
+			LogReplayReport(VerifyFightLog(Log));
+		}));
+
+	static FAutoConsoleCommand BrawlCommand(
+		TEXT("Combat.Bench.Brawl"),
+		TEXT("Resolve a synthetic brawl repeatedly and report throughput. Usage: Combat.Bench.Brawl [NumAttacks=20000] [Iterations=10]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FBrawlConfig Config;
+			if (Args.Num() > 0)
+			{
+				Config.NumAttacks = FMath::Max(FCString::Atoi(*Args[0]), 1);
+			}
+			const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10;
+			RunBrawlBenchmark(Config, Iterations);
+		}));
+}
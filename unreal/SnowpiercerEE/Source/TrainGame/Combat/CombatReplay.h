@@ -0,0 +1,73 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CombatResolutionSubsystem.h"
+
+// ============================================================================
+// CombatReplay
+//
+// Fight logs recorded by UCombatResolutionSubsystem, re-resolved without a
+// world. Each logged hit is resolved again from the attack, the seed and the
+// defense the target presented, and compared with what the game produced, so
+// a recorded fight doubles as a regression test for the combat math.
+//
+// Console:
+//   Combat.Log.Record [Seed=1]                      reseed and start logging
+//   Combat.Log.Stop [Path]                          save the log (+ CSV) and verify it
+//   Combat.Log.Verify [Path]                        re-resolve a saved log
+//   Combat.Bench.Brawl [NumAttacks=20000] [Iterations=10]
+//       resolve a synthetic brawl repeatedly and report hits per second
+//
+// Default log path is Saved/Profiling/CombatFight.bin.
+// ============================================================================
+
+namespace CombatReplay
+{
+	// --- Files ---
+
+	TRAINGAME_API FString GetDefaultLogPath();
+
+	TRAINGAME_API bool SaveFightLog(const FCombatFightLog& Log, const FString& Path);
+	TRAINGAME_API bool LoadFightLog(const FString& Path, FCombatFightLog& OutLog);
+
+	/** One row per hit, for diffing fights across builds */
+	TRAINGAME_API FString FightLogToCsv(const FCombatFightLog& Log);
+
+	// --- Verification ---
+
+	struct FReplayReport
+	{
+		int32 NumAttacks = 0;
+		int32 NumHits = 0;
+		int32 NumMismatches = 0;
+
+		/** First hit that resolved differently, as "attack:hit" */
+		FString FirstMismatch;
+
+		double ResolveMs = 0.0;
+
+		bool Matches() const { return NumMismatches == 0; }
+	};
+
+	/** Re-resolve every hit in Log from its seed and compare with the recorded results */
+	TRAINGAME_API FReplayReport VerifyFightLog(const FCombatFightLog& Log);
+
+	TRAINGAME_API void LogReplayReport(const FReplayReport& Report);
+
+	// --- Benchmark ---
+
+	struct FBrawlConfig
+	{
+		int32 NumCombatants = 40;
+		int32 NumAttacks = 20000;
+		int32 Seed = 1;
+	};
+
+	/** A deterministic melee between NumCombatants, resolved and logged as the subsystem would */
+	TRAINGAME_API FCombatFightLog MakeSyntheticBrawl(const FBrawlConfig& Config);
+
+	/** Build a brawl, verify it Iterations times and log the throughput */
+	TRAINGAME_API FReplayReport RunBrawlBenchmark(const FBrawlConfig& Config, int32 Iterations);
+}
@@ -0,0 +1,279 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "CombatResolutionSubsystem.h"
+#include "CombatComponent.h"
+#include "TrainGame/Stealth/NoisePropagationSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarCombatSeed(
+	TEXT("Combat.Resolution.Seed"),
+	0,
+	TEXT("Seed for the critical-hit stream when a world starts. 0 picks one from the clock."));
+
+void UCombatResolutionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const int32 ConfiguredSeed = CVarCombatSeed.GetValueOnGameThread();
+	SetSeed(ConfiguredSeed != 0 ? ConfiguredSeed : static_cast<int32>(FPlatformTime::Cycles()));
+}
+
+void UCombatResolutionSubsystem::Deinitialize()
+{
+	Queued.Empty();
+	InFlight.Empty();
+	Candidates.Empty();
+	Recording = FCombatFightLog();
+	bRecording = false;
+	Super::Deinitialize();
+}
+
+TStatId UCombatResolutionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatResolutionSubsystem, STATGROUP_Tickables);
+}
+
+// --- Attacks ---
+
+void UCombatResolutionSubsystem::QueueAttack(UCombatComponent* Attacker, const FCombatAttack& Attack)
+{
+	const AActor* Owner = Attacker ? Attacker->GetOwner() : nullptr;
+	if (!Owner) return;
+
+	// Aim is fixed when the swing starts, not when it resolves
+	FPendingAttack& Pending = Queued.AddDefaulted_GetRef();
+	Pending.Sequence = NextSequence++;
+	Pending.Attacker = Attacker;
+	Pending.Attack = Attack;
+	Pending.Origin = Owner->GetActorLocation();
+	Pending.Forward = Owner->GetActorForwardVector();
+}
+
+float UCombatResolutionSubsystem::RollHitDamage(const FCombatAttack& Attack, int32 HitIndex, FRandomStream& InStream, bool& bOutCritical)
+{
+	bOutCritical = InStream.FRand() < Attack.CritChance;
+
+	float Damage = Attack.BaseDamage * Attack.DamageBonus;
+	if (bOutCritical)
+	{
+		Damage *= Attack.CritMultiplier;
+	}
+	if (HitIndex > 0)
+	{
+		Damage *= Attack.CleaveMultiplier;
+	}
+	return Damage;
+}
+
+// --- RNG ---
+
+void UCombatResolutionSubsystem::SetSeed(int32 NewSeed)
+{
+	Seed = NewSeed;
+	Stream.Initialize(Seed);
+}
+
+// --- Recording ---
+
+void UCombatResolutionSubsystem::StartRecording(int32 RecordSeed)
+{
+	SetSeed(RecordSeed);
+	Recording = FCombatFightLog();
+	Recording.Seed = RecordSeed;
+	RecordingStartFrame = GFrameCounter;
+	bRecording = true;
+}
+
+FCombatFightLog UCombatResolutionSubsystem::StopRecording()
+{
+	bRecording = false;
+	return MoveTemp(Recording);
+}
+
+// --- Tick ---
+
+void UCombatResolutionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	NumAttacksLastFrame = 0;
+	NumHitsLastFrame = 0;
+
+	// Resolve in issue order; stop at the first swing still waiting on a sweep
+	int32 NumResolved = 0;
+	for (; NumResolved < InFlight.Num(); ++NumResolved)
+	{
+		if (!CollectTargets(InFlight[NumResolved]))
+		{
+			break;
+		}
+		ResolveAttack(InFlight[NumResolved]);
+		++NumAttacksLastFrame;
+	}
+	InFlight.RemoveAt(0, NumResolved, EAllowShrinking::No);
+
+	// Sweep everything swung this frame as one batch
+	for (FPendingAttack& Pending : Queued)
+	{
+		IssueSweeps(Pending);
+	}
+	InFlight.Append(MoveTemp(Queued));
+	Queued.Reset();
+}
+
+void UCombatResolutionSubsystem::IssueSweeps(FPendingAttack& Pending)
+{
+	UWorld* World = GetWorld();
+	const UCombatComponent* Attacker = Pending.Attacker.Get();
+	if (!World || !Attacker) return;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(CombatArcSweep), false, Attacker->GetOwner());
+
+	// By object type: a channel multi-sweep stops at the first pawn that blocks it,
+	// which would hide everyone standing behind the nearest target
+	const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+	const FCollisionShape Shape = FCollisionShape::MakeSphere(SweepRadius);
+
+	for (int32 i = 0; i < NumArcSweeps; ++i)
+	{
+		// -Arc, 0, +Arc around the facing
+		const float Yaw = Pending.Attack.ArcHalfAngle * (i - (NumArcSweeps - 1) / 2);
+		const FVector Direction = Pending.Forward.RotateAngleAxis(Yaw, FVector::UpVector);
+		const FVector End = Pending.Origin + Direction * Pending.Attack.Range;
+
+		Pending.Sweeps.Add(World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Pending.Origin, End, FQuat::Identity,
+			ObjectParams, Shape, Params));
+	}
+}
+
+bool UCombatResolutionSubsystem::CollectTargets(const FPendingAttack& Pending)
+{
+	Candidates.Reset();
+
+	UWorld* World = GetWorld();
+	for (const FTraceHandle& Handle : Pending.Sweeps)
+	{
+		FTraceDatum Datum;
+		if (!World->QueryTraceData(Handle, Datum))
+		{
+			// Data that has already been recycled will never arrive; count it as a miss
+			if (World->IsTraceHandleValid(Handle, false))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		for (const FHitResult& Hit : Datum.OutHits)
+		{
+			AActor* Actor = Hit.GetActor();
+			if (!Actor) continue;
+
+			const float DistSq = FVector::DistSquared(Pending.Origin, Actor->GetActorLocation());
+			FTargetCandidate* Existing = Candidates.FindByPredicate([Actor](const FTargetCandidate& Candidate)
+			{
+				return Candidate.Actor == Actor;
+			});
+			if (Existing)
+			{
+				Existing->DistSq = FMath::Min(Existing->DistSq, DistSq);
+			}
+			else
+			{
+				Candidates.Add({ Actor, DistSq });
+			}
+		}
+	}
+
+	Candidates.Sort([](const FTargetCandidate& A, const FTargetCandidate& B)
+	{
+		if (A.DistSq != B.DistSq)
+		{
+			return A.DistSq < B.DistSq;
+		}
+		return A.Actor->GetFName().Compare(B.Actor->GetFName()) < 0;
+	});
+	return true;
+}
+
+void UCombatResolutionSubsystem::ResolveAttack(const FPendingAttack& Pending)
+{
+	UCombatComponent* Attacker = Pending.Attacker.Get();
+	AActor* AttackerActor = Attacker ? Attacker->GetOwner() : nullptr;
+	if (!AttackerActor) return;
+
+	const FCombatAttack& Attack = Pending.Attack;
+
+	FCombatLogAttack* Log = nullptr;
+	if (bRecording)
+	{
+		Log = &Recording.Attacks.AddDefaulted_GetRef();
+		Log->Frame = static_cast<int32>(GFrameCounter - RecordingStartFrame);
+		Log->Attacker = AttackerActor->GetFName();
+		Log->Attack = Attack;
+	}
+
+	UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>();
+
+	int32 HitIndex = 0;
+	for (const FTargetCandidate& Candidate : Candidates)
+	{
+		if (HitIndex >= Attack.MaxTargets) break;
+
+		AActor* Target = Candidate.Actor;
+		if (!IsValid(Target)) continue;
+
+		// Corpses don't soak up a swing
+		UCombatComponent* TargetCombat = Target->FindComponentByClass<UCombatComponent>();
+		if (TargetCombat && !TargetCombat->IsAlive()) continue;
+
+		// A cleave carries into the next foe, never into the attacker's own side
+		if (HitIndex > 0 && TargetCombat && !Attacker->CombatTeam.IsNone()
+			&& TargetCombat->CombatTeam == Attacker->CombatTeam)
+		{
+			continue;
+		}
+
+		bool bCritical = false;
+		const float Damage = RollHitDamage(Attack, HitIndex, Stream, bCritical);
+
+		FCombatDefense Defense;
+		FHitResult_Combat Result;
+		if (TargetCombat)
+		{
+			Defense = TargetCombat->GetDefense(Attack.Direction, Attack.DamageType);
+			Result = TargetCombat->ReceiveAttack(Damage, Attack.Direction, Attack.DamageType, AttackerActor);
+		}
+		else
+		{
+			Result = Defense.Resolve(Damage, Attack.Direction, Attack.DamageType);
+		}
+		Result.bCritical = bCritical;
+
+		++HitIndex;
+		++NumHitsLastFrame;
+
+		if (Log)
+		{
+			FCombatLogHit& LogHit = Log->Hits.AddDefaulted_GetRef();
+			LogHit.Target = Target->GetFName();
+			LogHit.Defense = Defense;
+			LogHit.IncomingDamage = Damage;
+			LogHit.Result = Result;
+		}
+
+		// Landed and parried blows carry; a dodge only cuts air
+		if (Noise && (Result.bHit || Result.bBlocked))
+		{
+			FNoiseEvent Event;
+			Event.Origin = Target->GetActorLocation();
+			Event.Radius = CombatNoiseRadius;
+			Event.Intensity = ESoundIntensity::Combat;
+			Event.Instigator = AttackerActor;
+			Noise->ReportNoise(Event);
+		}
+
+		Attacker->OnHitLanded.Broadcast(Result);
+	}
+}
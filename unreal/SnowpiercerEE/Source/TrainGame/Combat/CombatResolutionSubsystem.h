@@ -0,0 +1,226 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "TrainGame/Core/CombatTypes.h"
+#include "CombatResolutionSubsystem.generated.h"
+
+class UCombatComponent;
+
+/** One melee swing, as captured when it was issued */
+USTRUCT(BlueprintType)
+struct FCombatAttack
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EAttackDirection Direction = EAttackDirection::Mid;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EDamageType DamageType = EDamageType::Physical;
+
+	/** Weapon damage after degradation */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float BaseDamage = 0.f;
+
+	/** Attacker-side multiplier (Kronole mode) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float DamageBonus = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float CritChance = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float CritMultiplier = 1.f;
+
+	/** Damage multiplier for every target after the first */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float CleaveMultiplier = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Range = 150.f;
+
+	/** Half-angle of the swing arc (degrees) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ArcHalfAngle = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 MaxTargets = 1;
+};
+
+/** One target struck by a logged attack: the inputs to its resolution and the outcome */
+USTRUCT(BlueprintType)
+struct FCombatLogHit
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName Target = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FCombatDefense Defense;
+
+	/** Damage sent to the target, after criticals, bonus and cleave */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float IncomingDamage = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FHitResult_Combat Result;
+};
+
+USTRUCT(BlueprintType)
+struct FCombatLogAttack
+{
+	GENERATED_BODY()
+
+	/** Frames since recording started */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 Frame = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName Attacker = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FCombatAttack Attack;
+
+	/** Targets in the order they were resolved */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FCombatLogHit> Hits;
+};
+
+/** Every attack resolved while recording, with the seed the RNG stream started from */
+USTRUCT(BlueprintType)
+struct FCombatFightLog
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 Seed = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FCombatLogAttack> Attacks;
+};
+
+// ============================================================================
+// UCombatResolutionSubsystem
+//
+// Resolves every melee swing in the world in one batch per frame:
+//
+//   1. Queue: UCombatComponent::PerformAttack checks stance, cooldown and
+//      stamina on the spot, then queues the swing here.
+//   2. Sweep: on tick, each queued swing issues async pawn object-type
+//      sweeps fanned across its arc, so every pawn along it is found.
+//      Results are read back on a later tick, so no swing waits on a
+//      synchronous trace.
+//   3. Resolve: finished swings resolve in the order they were issued. Each
+//      swing hits its targets nearest first (ties broken by name), up to its
+//      target limit. Criticals come from one seeded FRandomStream, so the
+//      same swings against the same defenses give the same fight.
+//
+// While recording, each resolved swing is logged with the defense every
+// target presented. A log can then be re-resolved without a world (see
+// CombatReplay) to benchmark resolution or catch behavior changes.
+// ============================================================================
+
+UCLASS()
+class TRAINGAME_API UCombatResolutionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// --- Attacks ---
+
+	/** Queue a swing for this frame's batch */
+	void QueueAttack(UCombatComponent* Attacker, const FCombatAttack& Attack);
+
+	/**
+	 * Damage the HitIndex'th target of Attack receives before its defense.
+	 * Consumes exactly one roll from Stream for the critical check.
+	 */
+	static float RollHitDamage(const FCombatAttack& Attack, int32 HitIndex, FRandomStream& Stream, bool& bOutCritical);
+
+	// --- RNG ---
+
+	/** Restart the critical-hit stream from Seed */
+	void SetSeed(int32 NewSeed);
+	int32 GetSeed() const { return Seed; }
+
+	// --- Recording ---
+
+	/** Reseed and log every attack resolved from now on */
+	void StartRecording(int32 RecordSeed);
+
+	/** Stop logging and hand over everything recorded */
+	FCombatFightLog StopRecording();
+
+	bool IsRecording() const { return bRecording; }
+
+	// --- Stats ---
+
+	/** Swings waiting to sweep or for their sweep results */
+	int32 GetNumPendingAttacks() const { return Queued.Num() + InFlight.Num(); }
+
+	int32 GetNumAttacksResolvedLastFrame() const { return NumAttacksLastFrame; }
+	int32 GetNumHitsLastFrame() const { return NumHitsLastFrame; }
+
+private:
+	struct FPendingAttack
+	{
+		uint64 Sequence = 0;
+		TWeakObjectPtr<UCombatComponent> Attacker;
+		FCombatAttack Attack;
+		FVector Origin = FVector::ZeroVector;
+		FVector Forward = FVector::ForwardVector;
+		TArray<FTraceHandle, TInlineAllocator<3>> Sweeps;
+	};
+
+	struct FTargetCandidate
+	{
+		AActor* Actor = nullptr;
+		float DistSq = 0.f;
+	};
+
+	void IssueSweeps(FPendingAttack& Pending);
+
+	/** Merge a swing's sweep results into Candidates, nearest first. False while any sweep is still in flight. */
+	bool CollectTargets(const FPendingAttack& Pending);
+
+	void ResolveAttack(const FPendingAttack& Pending);
+
+	/** Swings queued this frame, sweeps not yet issued */
+	TArray<FPendingAttack> Queued;
+
+	/** Swings waiting for sweep results, in issue order */
+	TArray<FPendingAttack> InFlight;
+
+	uint64 NextSequence = 0;
+
+	FRandomStream Stream;
+	int32 Seed = 0;
+
+	bool bRecording = false;
+	uint64 RecordingStartFrame = 0;
+	FCombatFightLog Recording;
+
+	TArray<FTargetCandidate> Candidates;
+
+	int32 NumAttacksLastFrame = 0;
+	int32 NumHitsLastFrame = 0;
+
+	/** Sweeps fanned across each swing's arc: both edges and the centre */
+	static constexpr int32 NumArcSweeps = 3;
+
+	/** Radius of each sweep (cm), the width of the weapon */
+	static constexpr float SweepRadius = 50.f;
+
+	/** How far a landed or parried blow is heard (cm) */
+	static constexpr float CombatNoiseRadius = 1500.f;
+};
@@ -17,9 +17,22 @@ void ATrainGameCombatCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Weapon degradation is handled in the input handlers (Input_AttackHigh/Mid/Low)
-	// where we check the hit result and apply durability loss accordingly.
-	// A full implementation would use a delegate-based approach.
+	// Hits resolve a frame after the swing, once per target struck
+	if (CombatComp)
+	{
+		CombatComp->OnHitLanded.AddDynamic(this, &ATrainGameCombatCharacter::HandleHitLanded);
+	}
+}
+
+void ATrainGameCombatCharacter::HandleHitLanded(const FHitResult_Combat& HitResult)
+{
+	if (HitResult.bHit && WeaponComp && WeaponComp->HasWeaponEquipped())
+	{
+		if (HitResult.bBlocked)
+			WeaponComp->ApplyBlockDurabilityLoss();
+		else
+			WeaponComp->ApplyHitDurabilityLoss();
+	}
 }
 
 void ATrainGameCombatCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -49,47 +62,17 @@ void ATrainGameCombatCharacter::SetupPlayerInputComponent(UInputComponent* Playe
 
 void ATrainGameCombatCharacter::Input_AttackHigh()
 {
-	if (CombatComp)
-	{
-		FHitResult_Combat Result = CombatComp->PerformAttack(EAttackDirection::High);
-		if (Result.bHit && WeaponComp && WeaponComp->HasWeaponEquipped())
-		{
-			if (Result.bBlocked)
-				WeaponComp->ApplyBlockDurabilityLoss();
-			else
-				WeaponComp->ApplyHitDurabilityLoss();
-		}
-	}
+	if (CombatComp) CombatComp->PerformAttack(EAttackDirection::High);
 }
 
 void ATrainGameCombatCharacter::Input_AttackMid()
 {
-	if (CombatComp)
-	{
-		FHitResult_Combat Result = CombatComp->PerformAttack(EAttackDirection::Mid);
-		if (Result.bHit && WeaponComp && WeaponComp->HasWeaponEquipped())
-		{
-			if (Result.bBlocked)
-				WeaponComp->ApplyBlockDurabilityLoss();
-			else
-				WeaponComp->ApplyHitDurabilityLoss();
-		}
-	}
+	if (CombatComp) CombatComp->PerformAttack(EAttackDirection::Mid);
 }
 
 void ATrainGameCombatCharacter::Input_AttackLow()
 {
-	if (CombatComp)
-	{
-		FHitResult_Combat Result = CombatComp->PerformAttack(EAttackDirection::Low);
-		if (Result.bHit && WeaponComp && WeaponComp->HasWeaponEquipped())
-		{
-			if (Result.bBlocked)
-				WeaponComp->ApplyBlockDurabilityLoss();
-			else
-				WeaponComp->ApplyHitDurabilityLoss();
-		}
-	}
+	if (CombatComp) CombatComp->PerformAttack(EAttackDirection::Low);
 }
 
 void ATrainGameCombatCharacter::Input_BlockHigh()
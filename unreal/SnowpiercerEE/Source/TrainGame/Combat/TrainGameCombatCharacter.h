@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "TrainGame/Core/CombatTypes.h"
 #include "TrainGameCombatCharacter.generated.h"
 
 class UCombatComponent;
@@ -42,6 +43,10 @@ protected:
 	UWeaponComponent* WeaponComp;
 
 private:
+	/** Wears the weapon down for each target a swing struck */
+	UFUNCTION()
+	void HandleHitLanded(const FHitResult_Combat& HitResult);
+
 	// Input handlers for combat
 	void Input_AttackHigh();
 	void Input_AttackMid();
@@ -190,6 +190,64 @@ struct FHitResult_Combat
 	EDamageType DamageType = EDamageType::Physical;
 };
 
+/**
+ * What a combatant brings to one incoming hit: resistance, block and stance.
+ * Resolving a hit is a pure function of this, so fight logs can replay it.
+ */
+USTRUCT(BlueprintType)
+struct FCombatDefense
+{
+	GENERATED_BODY()
+
+	/** Resistance to the incoming damage type (0 = immune, 1 = normal) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ResistanceMultiplier = 1.f;
+
+	/** Inside dodge i-frames */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bInIFrames = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bBlocking = false;
+
+	/** Fraction of damage the block absorbs (already chosen for the attack direction) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float BlockReduction = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bStaggered = false;
+
+	FHitResult_Combat Resolve(float IncomingDamage, EAttackDirection Direction, EDamageType InDamageType) const
+	{
+		FHitResult_Combat Result;
+		Result.AttackDirection = Direction;
+		Result.DamageType = InDamageType;
+
+		if (bInIFrames)
+		{
+			Result.bDodged = true;
+			return Result;
+		}
+
+		float FinalDamage = IncomingDamage * ResistanceMultiplier;
+		if (bBlocking)
+		{
+			FinalDamage *= (1.f - BlockReduction);
+			Result.bBlocked = true;
+		}
+
+		// Staggered targets take more damage
+		if (bStaggered)
+		{
+			FinalDamage *= 1.5f;
+		}
+
+		Result.DamageDealt = FinalDamage;
+		Result.bHit = true;
+		return Result;
+	}
+};
+
 /** Stamina/fatigue state snapshot */
 USTRUCT(BlueprintType)
 struct FStaminaState
@@ -255,6 +313,10 @@ struct FWeaponStats
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float StaminaCostPerSwing = 15.f;
 
+	/** Targets one swing can hit; above 1 the weapon cleaves (great axes, pipes swung wide) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 MaxTargets = 1;
+
 	/** Current durability - weapon breaks at 0 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float Durability = 100.f;
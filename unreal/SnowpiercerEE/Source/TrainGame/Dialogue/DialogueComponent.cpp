@@ -34,14 +34,9 @@ FDialogueNode UDialogueComponent::StartDialogue()
 	FailedChecks.Empty();
 	PrimaryComponentTick.SetTickFunctionEnable(true);
 
-	// TODO: Load hub node from DialogueData asset
-	// CurrentNodeID = DialogueData->GetHubNodeID();
-
 	OnDialogueStarted.Broadcast(NPCID);
 
-	FDialogueNode HubNode;
-	HubNode.NodeType = EDialogueNodeType::Hub;
-	return HubNode;
+	return ReturnToHub();
 }
 
 FDialogueNode UDialogueComponent::SelectOption(int32 OptionIndex)
@@ -71,8 +66,12 @@ void UDialogueComponent::EndDialogue()
 
 FDialogueNode UDialogueComponent::ReturnToHub()
 {
-	// TODO: Navigate back to the hub node
-	// CurrentNodeID = DialogueData->GetHubNodeID();
+	const FDialogueNode* Hub = DialogueData ? DialogueData->FindNode(DialogueData->HubNodeID) : nullptr;
+	if (Hub)
+	{
+		CurrentNodeID = Hub->NodeID;
+		return *Hub;
+	}
 
 	FDialogueNode HubNode;
 	HubNode.NodeType = EDialogueNodeType::Hub;
@@ -146,8 +145,8 @@ float UDialogueComponent::GetRemainingTime() const
 
 EDialogueUrgency UDialogueComponent::GetCurrentUrgency() const
 {
-	// TODO: Get from current node
-	return EDialogueUrgency::None;
+	const FDialogueNode* Node = DialogueData ? DialogueData->FindNode(CurrentNodeID) : nullptr;
+	return Node ? Node->Urgency : EDialogueUrgency::None;
 }
 
 void UDialogueComponent::TickTimer(float DeltaTime)
@@ -270,9 +269,7 @@ FDialogueNode UDialogueComponent::ResumeAfterInterrupt()
 	// Return to hub with context about the interruption
 	// TODO: Add interrupt-specific spoke to hub
 
-	FDialogueNode HubNode;
-	HubNode.NodeType = EDialogueNodeType::Hub;
-	return HubNode;
+	return ReturnToHub();
 }
 
 // --- Internal ---
@@ -4,12 +4,9 @@
 
 FDialogueNode UDialogueDataAsset::GetNodeByID(FName NodeID) const
 {
-	for (const FDialogueNode& Node : Nodes)
+	if (const FDialogueNode* Node = FindNode(NodeID))
 	{
-		if (Node.NodeID == NodeID)
-		{
-			return Node;
-		}
+		return *Node;
 	}
 
 	// Return empty node if not found
@@ -24,13 +21,113 @@ FDialogueNode UDialogueDataAsset::GetHubNode() const
 
 TArray<FDialogueNode> UDialogueDataAsset::GetNodesByType(EDialogueNodeType Type) const
 {
+	const TArrayView<const int32> Indices = GetNodeIndicesByType(Type);
+
 	TArray<FDialogueNode> Result;
+	Result.Reserve(Indices.Num());
+	for (const int32 Index : Indices)
+	{
+		Result.Add(Nodes[Index]);
+	}
+	return Result;
+}
+
+// --- Compiled Lookups ---
+
+int32 UDialogueDataAsset::FindNodeIndex(FName NodeID) const
+{
+	EnsureCompiled();
+	const int32* Index = NodeIndexByID.Find(NodeID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+const FDialogueNode* UDialogueDataAsset::FindNode(FName NodeID) const
+{
+	const int32 Index = FindNodeIndex(NodeID);
+	return Index != INDEX_NONE ? &Nodes[Index] : nullptr;
+}
+
+TArrayView<const FDialogueOption> UDialogueDataAsset::GetNodeOptions(int32 NodeIndex) const
+{
+	EnsureCompiled();
+	if (!OptionRanges.IsValidIndex(NodeIndex))
+	{
+		return TArrayView<const FDialogueOption>();
+	}
+
+	const FOptionRange& Range = OptionRanges[NodeIndex];
+	return TArrayView<const FDialogueOption>(CompiledOptions.GetData() + Range.First, Range.Num);
+}
+
+TArrayView<const int32> UDialogueDataAsset::GetNodeIndicesByType(EDialogueNodeType Type) const
+{
+	EnsureCompiled();
+	if (const TArray<int32>* Indices = NodeIndicesByType.Find(Type))
+	{
+		return *Indices;
+	}
+	return TArrayView<const int32>();
+}
+
+void UDialogueDataAsset::CompileGraph() const
+{
+	NodeIndexByID.Reset();
+	NodeIndexByID.Reserve(Nodes.Num());
+	OptionRanges.Reset(Nodes.Num());
+	NodeIndicesByType.Reset();
+
+	int32 TotalOptions = 0;
 	for (const FDialogueNode& Node : Nodes)
 	{
-		if (Node.NodeType == Type)
+		TotalOptions += Node.Options.Num();
+	}
+	CompiledOptions.Reset(TotalOptions);
+
+	for (int32 i = 0; i < Nodes.Num(); ++i)
+	{
+		const FDialogueNode& Node = Nodes[i];
+
+		// First occurrence wins, matching the old linear scan
+		if (NodeIndexByID.Contains(Node.NodeID))
 		{
-			Result.Add(Node);
+			UE_LOG(LogTemp, Warning, TEXT("Dialogue %s: duplicate node ID %s ignored"), *GetName(), *Node.NodeID.ToString());
 		}
+		else
+		{
+			NodeIndexByID.Add(Node.NodeID, i);
+		}
+
+		FOptionRange& Range = OptionRanges.AddDefaulted_GetRef();
+		Range.First = CompiledOptions.Num();
+		Range.Num = Node.Options.Num();
+		CompiledOptions.Append(Node.Options);
+
+		NodeIndicesByType.FindOrAdd(Node.NodeType).Add(i);
 	}
-	return Result;
+
+	bGraphCompiled = true;
+}
+
+void UDialogueDataAsset::EnsureCompiled() const
+{
+	if (!bGraphCompiled)
+	{
+		CompileGraph();
+	}
+}
+
+void UDialogueDataAsset::PostLoad()
+{
+	Super::PostLoad();
+	CompileGraph();
+}
+
+#if WITH_EDITOR
+void UDialogueDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Recompile lazily on next lookup
+	bGraphCompiled = false;
 }
+#endif
@@ -12,6 +12,12 @@
  *
  * Contains the full dialogue graph for a single NPC. Authored in editor or
  * imported from external dialogue tools. Each NPC references one of these.
+ *
+ * On load the graph is compiled into lookup tables: NodeID -> dense node index,
+ * every node's options copied into one contiguous array, and node indices per
+ * type. The C++ accessors return references and views into those tables, so
+ * stepping through a conversation does not allocate. The Blueprint accessors
+ * still return copies.
  */
 UCLASS(BlueprintType)
 class TRAINGAME_API UDialogueDataAsset : public UPrimaryDataAsset
@@ -60,4 +66,44 @@ public:
 	/** Get all nodes of a specific type */
 	UFUNCTION(BlueprintCallable, Category = "Dialogue")
 	TArray<FDialogueNode> GetNodesByType(EDialogueNodeType Type) const;
+
+	// --- Compiled Lookups (C++) ---
+
+	/** Dense index of a node in Nodes, or INDEX_NONE */
+	int32 FindNodeIndex(FName NodeID) const;
+
+	/** Find a node by ID without copying it. Null if the graph has no such node. */
+	const FDialogueNode* FindNode(FName NodeID) const;
+
+	/** The options of the node at NodeIndex, as a view into the compiled option table */
+	TArrayView<const FDialogueOption> GetNodeOptions(int32 NodeIndex) const;
+
+	/** Indices into Nodes of every node of the given type, in authored order */
+	TArrayView<const int32> GetNodeIndicesByType(EDialogueNodeType Type) const;
+
+	/** Rebuild the lookup tables. Call after editing Nodes at runtime. */
+	void CompileGraph() const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** A node's slice of CompiledOptions */
+	struct FOptionRange
+	{
+		int32 First = 0;
+		int32 Num = 0;
+	};
+
+	void EnsureCompiled() const;
+
+	// Compiled lookup tables, rebuilt from Nodes
+	mutable TMap<FName, int32> NodeIndexByID;
+	mutable TArray<FOptionRange> OptionRanges;
+	mutable TArray<FDialogueOption> CompiledOptions;
+	mutable TMap<EDialogueNodeType, TArray<int32>> NodeIndicesByType;
+	mutable bool bGraphCompiled = false;
 };
@@ -1,6 +1,7 @@
 // Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
 
 #include "NPCMemoryComponent.h"
+#include "NPCRegistrySubsystem.h"
 
 UNPCMemoryComponent::UNPCMemoryComponent()
 {
@@ -11,6 +12,21 @@ UNPCMemoryComponent::UNPCMemoryComponent()
 void UNPCMemoryComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (UNPCRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UNPCRegistrySubsystem>())
+	{
+		Registry->RegisterNPC(this, CarIndex);
+	}
+}
+
+void UNPCMemoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UNPCRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UNPCRegistrySubsystem>())
+	{
+		Registry->UnregisterNPC(this, CarIndex);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UNPCMemoryComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -67,6 +83,27 @@ void UNPCMemoryComponent::RemoveMemory(FName MemoryTag)
 	});
 }
 
+TArray<FName> UNPCMemoryComponent::GetMemoryTags() const
+{
+	TArray<FName> Tags;
+	Tags.Reserve(Memories.Num());
+	for (const FNPCMemory& Memory : Memories)
+	{
+		Tags.Add(Memory.MemoryTag);
+	}
+	return Tags;
+}
+
+void UNPCMemoryComponent::ResetMemory()
+{
+	Memories.Reset();
+	ActiveLies.Reset();
+	ExposedLies.Reset();
+
+	const UNPCMemoryComponent* Archetype = CastChecked<UNPCMemoryComponent>(GetArchetype());
+	Disposition = Archetype->Disposition;
+}
+
 // --- Disposition ---
 
 ENPCDisposition UNPCMemoryComponent::GetDispositionBracket() const
@@ -136,6 +173,27 @@ float UNPCMemoryComponent::GetRumorFidelity(int32 DistanceFromOrigin) const
 	return 0.2f; // 6+ cars: mythologized
 }
 
+// --- Location ---
+
+void UNPCMemoryComponent::SetCarIndex(int32 NewCarIndex)
+{
+	if (NewCarIndex == CarIndex)
+	{
+		return;
+	}
+
+	const int32 OldCarIndex = CarIndex;
+	CarIndex = NewCarIndex;
+
+	if (HasBegunPlay())
+	{
+		if (UNPCRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UNPCRegistrySubsystem>())
+		{
+			Registry->MoveNPC(this, OldCarIndex, NewCarIndex);
+		}
+	}
+}
+
 // --- Lie Tracking ---
 
 void UNPCMemoryComponent::RecordLie(FName LieTag, FName ContradictoryTruth)
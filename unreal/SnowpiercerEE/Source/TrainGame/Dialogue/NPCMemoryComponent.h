@@ -40,6 +40,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NPC|Memory")
 	void RemoveMemory(FName MemoryTag);
 
+	/** Tags of every memory held, in the order they were formed */
+	UFUNCTION(BlueprintPure, Category = "NPC|Memory")
+	TArray<FName> GetMemoryTags() const;
+
+	/** Forget all memories and lies and return to the archetype's disposition (pooled NPCs being reused) */
+	void ResetMemory();
+
 	// --- Disposition ---
 
 	/** Get current disposition toward the player */
@@ -68,6 +75,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "NPC|Rumor")
 	float GetRumorFidelity(int32 DistanceFromOrigin) const;
 
+	// --- Location ---
+
+	/** Car this NPC is in */
+	UFUNCTION(BlueprintPure, Category = "NPC")
+	int32 GetCarIndex() const { return CarIndex; }
+
+	/** Move this NPC to another car (updates the NPC registry) */
+	UFUNCTION(BlueprintCallable, Category = "NPC")
+	void SetCarIndex(int32 NewCarIndex);
+
 	// --- Lie Tracking ---
 
 	/** Record a lie told to this NPC */
@@ -99,6 +116,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/** Decay mood memories over time */
@@ -117,7 +135,7 @@ private:
 	UPROPERTY(EditAnywhere, Category = "NPC")
 	FName FactionID = NAME_None;
 
-	/** Car index this NPC is in (for rumor distance calculation) */
+	/** Car index this NPC is in (for rumor distance calculation). Spawners set it on acquire; INDEX_NONE opts out of rumors. */
 	UPROPERTY(EditAnywhere, Category = "NPC")
 	int32 CarIndex = 0;
 
@@ -0,0 +1,80 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "NPCRegistrySubsystem.h"
+#include "NPCMemoryComponent.h"
+
+void UNPCRegistrySubsystem::Deinitialize()
+{
+	NPCsByCar.Empty();
+	OnCarPopulated.Clear();
+	Super::Deinitialize();
+}
+
+void UNPCRegistrySubsystem::RegisterNPC(UNPCMemoryComponent* NPC, int32 CarIndex)
+{
+	// An NPC with no car would otherwise pick up every rumor aimed at whichever car it defaulted to
+	if (!NPC || CarIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<UNPCMemoryComponent>>& CarNPCs = NPCsByCar.FindOrAdd(CarIndex);
+	const bool bWasEmpty = CarNPCs.Num() == 0;
+	CarNPCs.AddUnique(NPC);
+
+	if (bWasEmpty)
+	{
+		OnCarPopulated.Broadcast(CarIndex);
+	}
+}
+
+void UNPCRegistrySubsystem::UnregisterNPC(UNPCMemoryComponent* NPC, int32 CarIndex)
+{
+	TArray<TWeakObjectPtr<UNPCMemoryComponent>>* CarNPCs = NPCsByCar.Find(CarIndex);
+	if (!CarNPCs)
+	{
+		return;
+	}
+
+	// Drop the NPC along with any entries whose component was destroyed without unregistering
+	CarNPCs->RemoveAllSwap([NPC](const TWeakObjectPtr<UNPCMemoryComponent>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == NPC;
+	});
+
+	if (CarNPCs->Num() == 0)
+	{
+		NPCsByCar.Remove(CarIndex);
+	}
+}
+
+void UNPCRegistrySubsystem::MoveNPC(UNPCMemoryComponent* NPC, int32 OldCarIndex, int32 NewCarIndex)
+{
+	if (OldCarIndex == NewCarIndex)
+	{
+		return;
+	}
+
+	UnregisterNPC(NPC, OldCarIndex);
+	RegisterNPC(NPC, NewCarIndex);
+}
+
+TArrayView<const TWeakObjectPtr<UNPCMemoryComponent>> UNPCRegistrySubsystem::GetNPCsInCar(int32 CarIndex) const
+{
+	if (const TArray<TWeakObjectPtr<UNPCMemoryComponent>>* CarNPCs = NPCsByCar.Find(CarIndex))
+	{
+		return *CarNPCs;
+	}
+	return TArrayView<const TWeakObjectPtr<UNPCMemoryComponent>>();
+}
+
+bool UNPCRegistrySubsystem::IsCarPopulated(int32 CarIndex) const
+{
+	return NPCsByCar.Contains(CarIndex);
+}
+
+int32 UNPCRegistrySubsystem::GetNumNPCsInCar(int32 CarIndex) const
+{
+	const TArray<TWeakObjectPtr<UNPCMemoryComponent>>* CarNPCs = NPCsByCar.Find(CarIndex);
+	return CarNPCs ? CarNPCs->Num() : 0;
+}
@@ -0,0 +1,51 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NPCRegistrySubsystem.generated.h"
+
+class UNPCMemoryComponent;
+
+/**
+ * UNPCRegistrySubsystem
+ *
+ * World subsystem indexing NPC memory components by the car they are in.
+ * Components register on BeginPlay, unregister on EndPlay and move when their
+ * car index changes, so per-car lookups cost O(NPCs in that car) rather than a
+ * walk over every actor in the world. A car with no registered NPCs is treated
+ * as streamed out.
+ */
+UCLASS()
+class TRAINGAME_API UNPCRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterNPC(UNPCMemoryComponent* NPC, int32 CarIndex);
+	void UnregisterNPC(UNPCMemoryComponent* NPC, int32 CarIndex);
+
+	/** Move a registered NPC between cars */
+	void MoveNPC(UNPCMemoryComponent* NPC, int32 OldCarIndex, int32 NewCarIndex);
+
+	/** NPCs currently registered in a car. The view is invalidated by any registration change. */
+	TArrayView<const TWeakObjectPtr<UNPCMemoryComponent>> GetNPCsInCar(int32 CarIndex) const;
+
+	/** True while at least one NPC is registered in the car */
+	UFUNCTION(BlueprintPure, Category = "NPC|Registry")
+	bool IsCarPopulated(int32 CarIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "NPC|Registry")
+	int32 GetNumNPCsInCar(int32 CarIndex) const;
+
+	/** Fired when the first NPC registers in a previously empty car */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnCarPopulated, int32 /*CarIndex*/);
+	FOnCarPopulated OnCarPopulated;
+
+private:
+	/** Registered NPCs per car index; empty cars are removed */
+	TMap<int32, TArray<TWeakObjectPtr<UNPCMemoryComponent>>> NPCsByCar;
+};
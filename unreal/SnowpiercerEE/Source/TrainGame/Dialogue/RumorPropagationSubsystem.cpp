@@ -2,17 +2,35 @@
 
 #include "RumorPropagationSubsystem.h"
 #include "NPCMemoryComponent.h"
-#include "EngineUtils.h"
+#include "NPCRegistrySubsystem.h"
+#include "TimerManager.h"
 
 void URumorPropagationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	UNPCRegistrySubsystem* Registry = Collection.InitializeDependency<UNPCRegistrySubsystem>();
+	if (Registry)
+	{
+		CarPopulatedHandle = Registry->OnCarPopulated.AddUObject(this, &URumorPropagationSubsystem::HandleCarPopulated);
+	}
 }
 
 void URumorPropagationSubsystem::Deinitialize()
 {
+	if (UWorld* World = GetWorld())
+	{
+		if (UNPCRegistrySubsystem* Registry = World->GetSubsystem<UNPCRegistrySubsystem>())
+		{
+			Registry->OnCarPopulated.Remove(CarPopulatedHandle);
+		}
+		World->GetTimerManager().ClearTimer(FlushTimerHandle);
+	}
+
 	ActiveRumors.Empty();
 	DeliveredCars.Empty();
+	PendingDeliveries.Empty();
+	CarsAwaitingFlush.Empty();
 	Super::Deinitialize();
 }
 
@@ -46,6 +64,29 @@ bool URumorPropagationSubsystem::HasRumorReachedCar(FName RumorTag, int32 CarInd
 
 void URumorPropagationSubsystem::TickRumorPropagation(float GameMinutesElapsed)
 {
+	// Age queued deliveries; a car that never loads, or has no NPCs at all, must not hold them forever
+	for (auto It = PendingDeliveries.CreateIterator(); It; ++It)
+	{
+		TArray<FPendingRumor>& Pending = It.Value();
+		for (int32 i = Pending.Num() - 1; i >= 0; --i)
+		{
+			const FName RumorTag = Pending[i].RumorTag;
+			const FRumorData* Rumor = ActiveRumors.FindByPredicate([RumorTag](const FRumorData& R) { return R.RumorTag == RumorTag; });
+
+			Pending[i].MinutesQueued += GameMinutesElapsed;
+			const bool bStale = Rumor && Rumor->PendingLifetimeMinutes > 0.f && Pending[i].MinutesQueued >= Rumor->PendingLifetimeMinutes;
+			if (!Rumor || bStale)
+			{
+				Pending.RemoveAtSwap(i);
+			}
+		}
+
+		if (Pending.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
 	for (FRumorData& Rumor : ActiveRumors)
 	{
 		float NewReach = static_cast<float>(Rumor.CurrentReach) + (Rumor.PropagationRate * GameMinutesElapsed);
@@ -82,35 +123,77 @@ void URumorPropagationSubsystem::TickRumorPropagation(float GameMinutesElapsed)
 
 void URumorPropagationSubsystem::DeliverRumorToCar(const FRumorData& Rumor, int32 CarIndex)
 {
-	TArray<UNPCMemoryComponent*> NPCs = GetNPCsInCar(CarIndex);
-	for (UNPCMemoryComponent* NPC : NPCs)
+	UNPCRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UNPCRegistrySubsystem>();
+	if (!Registry || !Registry->IsCarPopulated(CarIndex))
 	{
-		if (NPC)
+		// Car is streamed out; hold the rumor until its NPCs are back
+		TArray<FPendingRumor>& Pending = PendingDeliveries.FindOrAdd(CarIndex);
+		if (!Pending.ContainsByPredicate([&Rumor](const FPendingRumor& P) { return P.RumorTag == Rumor.RumorTag; }))
+		{
+			Pending.Add({ Rumor.RumorTag });
+		}
+		return;
+	}
+
+	// ReceiveRumor fires events that may move NPCs between cars, so walk a copy
+	TArray<TWeakObjectPtr<UNPCMemoryComponent>, TInlineAllocator<16>> NPCs(Registry->GetNPCsInCar(CarIndex));
+	for (const TWeakObjectPtr<UNPCMemoryComponent>& NPC : NPCs)
+	{
+		if (NPC.IsValid())
 		{
 			NPC->ReceiveRumor(Rumor);
 		}
 	}
 }
 
-TArray<UNPCMemoryComponent*> URumorPropagationSubsystem::GetNPCsInCar(int32 CarIndex) const
+void URumorPropagationSubsystem::HandleCarPopulated(int32 CarIndex)
 {
-	TArray<UNPCMemoryComponent*> Result;
+	if (!PendingDeliveries.Contains(CarIndex))
+	{
+		return;
+	}
 
-	// TODO: Use car management system to find actors in specific car index
-	// For now, iterate all actors with NPCMemoryComponent
-	// This should be replaced with a spatial query once the car system is in place
+	// The first NPC of a streamed-in car registers before its neighbours have
+	// begun play; wait a tick so the whole car receives the rumors together
+	CarsAwaitingFlush.Add(CarIndex);
+	if (!FlushTimerHandle.IsValid())
+	{
+		FlushTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &URumorPropagationSubsystem::FlushPendingDeliveries);
+	}
+}
 
-	if (UWorld* World = GetWorld())
+void URumorPropagationSubsystem::FlushPendingDeliveries()
+{
+	FlushTimerHandle.Invalidate();
+
+	UNPCRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UNPCRegistrySubsystem>();
+	TSet<int32> Cars = MoveTemp(CarsAwaitingFlush);
+	CarsAwaitingFlush.Reset();
+
+	for (const int32 CarIndex : Cars)
 	{
-		for (TActorIterator<AActor> It(World); It; ++It)
+		// Streamed back out before the flush; stays queued for the next load
+		if (!Registry || !Registry->IsCarPopulated(CarIndex))
+		{
+			continue;
+		}
+
+		// Expired while the car was loading
+		TArray<FPendingRumor> Pending;
+		if (!PendingDeliveries.RemoveAndCopyValue(CarIndex, Pending))
 		{
-			if (UNPCMemoryComponent* MemComp = It->FindComponentByClass<UNPCMemoryComponent>())
+			continue;
+		}
+
+		for (const FPendingRumor& Queued : Pending)
+		{
+			const FName RumorTag = Queued.RumorTag;
+			if (const FRumorData* Rumor = ActiveRumors.FindByPredicate([RumorTag](const FRumorData& R) { return R.RumorTag == RumorTag; }))
 			{
-				// TODO: Check if actor is in the target car
-				// For now, add all NPCs (stub behavior)
+				// Copy: delivery can create rumors and reallocate ActiveRumors
+				const FRumorData RumorCopy = *Rumor;
+				DeliverRumorToCar(RumorCopy, CarIndex);
 			}
 		}
 	}
-
-	return Result;
 }
@@ -14,7 +14,10 @@ class UNPCMemoryComponent;
  *
  * World subsystem that manages rumor spread across the train. Tracks active
  * rumors, advances their reach over game time, and delivers them to NPCs
- * in newly-reached cars.
+ * in newly-reached cars. NPCs are looked up through UNPCRegistrySubsystem;
+ * rumors reaching a car with no registered NPCs (streamed out) are queued and
+ * delivered once the car's NPCs register. A queued rumor whose car does not
+ * load within the rumor's PendingLifetimeMinutes of game time is dropped.
  */
 UCLASS()
 class TRAINGAME_API URumorPropagationSubsystem : public UWorldSubsystem
@@ -49,8 +52,11 @@ protected:
 	/** Deliver a rumor to all NPCs in a specific car */
 	void DeliverRumorToCar(const FRumorData& Rumor, int32 CarIndex);
 
-	/** Find all NPC memory components in a car */
-	TArray<UNPCMemoryComponent*> GetNPCsInCar(int32 CarIndex) const;
+	/** A car's NPCs registered; deliver its queued rumors once the rest of the car has loaded */
+	void HandleCarPopulated(int32 CarIndex);
+
+	/** Deliver queued rumors to every car that became populated since the last flush */
+	void FlushPendingDeliveries();
 
 private:
 	/** All active rumors in the train */
@@ -59,4 +65,19 @@ private:
 
 	/** Track which cars have already received each rumor */
 	TMap<FName, TSet<int32>> DeliveredCars;
+
+	struct FPendingRumor
+	{
+		FName RumorTag;
+		float MinutesQueued = 0.0f;
+	};
+
+	/** Rumors that reached a car while it had no NPCs loaded */
+	TMap<int32, TArray<FPendingRumor>> PendingDeliveries;
+
+	/** Populated cars whose pending rumors go out on the next flush */
+	TSet<int32> CarsAwaitingFlush;
+
+	FDelegateHandle CarPopulatedHandle;
+	FTimerHandle FlushTimerHandle;
 };
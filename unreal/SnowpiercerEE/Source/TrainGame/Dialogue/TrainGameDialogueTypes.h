@@ -299,4 +299,8 @@ struct FRumorData
 	/** Propagation speed: cars per minute of game time */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float PropagationRate = 0.067f; // ~1 car per 15 min
+
+	/** Game minutes a delivery waits for a streamed-out car before the rumor is stale there (0 = waits until the car loads) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float PendingLifetimeMinutes = 240.f;
 };
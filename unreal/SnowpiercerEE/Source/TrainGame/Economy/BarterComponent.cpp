@@ -34,41 +34,56 @@ void UBarterComponent::EndTrade()
 
 void UBarterComponent::SetCurrentZone(ETrainZone Zone)
 {
+	if (Zone == CurrentZone)
+	{
+		return;
+	}
+
 	CurrentZone = Zone;
+
+	// Offer totals are in the current zone
+	CurrentProposal.PlayerOffer.TotalValue = GetOfferValue(CurrentProposal.PlayerOffer);
+	CurrentProposal.MerchantOffer.TotalValue = GetOfferValue(CurrentProposal.MerchantOffer);
 }
 
-float UBarterComponent::CalculateItemValue(FName ItemID, ETrainZone Zone, float Condition) const
+void UBarterComponent::SetFactionPriceModifier(EFaction Faction, float Modifier)
 {
-	if (!ResourceEconomyDataTable)
+	float& Current = FactionPriceModifiers.FindOrAdd(Faction, 1.0f);
+	if (Current == Modifier)
 	{
-		return 0.0f;
+		return;
 	}
 
-	static const FString ContextString(TEXT("BarterValueCalc"));
-	FResourceEconomyData* Data = ResourceEconomyDataTable->FindRow<FResourceEconomyData>(ItemID, ContextString);
-	if (!Data)
+	Current = Modifier;
+	if (bPriceTableValid)
 	{
-		return 0.0f;
+		RepriceFaction(static_cast<int32>(Faction));
 	}
+}
 
-	float ZoneMultiplier = 1.0f;
-	for (const FZoneValueEntry& Entry : Data->ZoneMultipliers)
+float UBarterComponent::CalculateItemValue(FName ItemID, ETrainZone Zone, float Condition) const
+{
+	const int32 Row = FindPriceRow(ItemID);
+	if (Row == INDEX_NONE)
 	{
-		if (Entry.Zone == Zone)
-		{
-			ZoneMultiplier = Entry.ValueMultiplier;
-			break;
-		}
+		return 0.0f;
 	}
 
 	float ConditionFactor = FMath::Clamp(Condition, 0.0f, 1.0f);
-	return Data->BaseTradeValue * ZoneMultiplier * ConditionFactor;
+	return ZoneValues[Row * NumTrainZones + static_cast<int32>(Zone)] * ConditionFactor;
 }
 
 float UBarterComponent::CalculateItemValueWithFaction(FName ItemID, ETrainZone Zone, EFaction MerchantFaction, float Condition) const
 {
-	float BaseValue = CalculateItemValue(ItemID, Zone, Condition);
-	return BaseValue * GetFactionPriceModifier(MerchantFaction);
+	const int32 Row = FindPriceRow(ItemID);
+	if (Row == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	float ConditionFactor = FMath::Clamp(Condition, 0.0f, 1.0f);
+	const int32 Cell = Row * NumTrainZones + static_cast<int32>(Zone);
+	return FactionValues[Cell * NumFactions + static_cast<int32>(MerchantFaction)] * ConditionFactor;
 }
 
 EHaggleResult UBarterComponent::ProposeTradeOffer(const FTradeProposal& Proposal)
@@ -79,24 +94,63 @@ EHaggleResult UBarterComponent::ProposeTradeOffer(const FTradeProposal& Proposal
 	}
 
 	CurrentProposal = Proposal;
-	CurrentProposal.HaggleRoundsUsed = 0;
-	CurrentProposal.HaggleModifier = 1.0f;
+	CurrentProposal.PlayerOffer.TotalValue = GetOfferValue(Proposal.PlayerOffer);
+	CurrentProposal.MerchantOffer.TotalValue = GetOfferValue(Proposal.MerchantOffer);
 
-	// Calculate offer values
-	float PlayerValue = 0.0f;
-	for (const auto& Pair : Proposal.PlayerOffer.Items)
+	return EvaluateCurrentProposal();
+}
+
+void UBarterComponent::AddItemToOffer(ETradeSide Side, FName ItemID, int32 Count)
+{
+	if (!ActiveMerchant || ItemID.IsNone() || Count <= 0)
 	{
-		PlayerValue += CalculateItemValue(Pair.Key, CurrentZone) * Pair.Value;
+		return;
 	}
 
-	float MerchantValue = 0.0f;
-	for (const auto& Pair : Proposal.MerchantOffer.Items)
+	FTradeOffer& Offer = GetOffer(Side);
+	Offer.Items.FindOrAdd(ItemID) += Count;
+	Offer.TotalValue += CalculateItemValue(ItemID, CurrentZone) * Count;
+}
+
+void UBarterComponent::RemoveItemFromOffer(ETradeSide Side, FName ItemID, int32 Count)
+{
+	FTradeOffer& Offer = GetOffer(Side);
+	int32* Offered = Offer.Items.Find(ItemID);
+	if (!Offered || Count <= 0)
 	{
-		MerchantValue += CalculateItemValue(Pair.Key, CurrentZone) * Pair.Value;
+		return;
+	}
+
+	const int32 Removed = FMath::Min(*Offered, Count);
+	*Offered -= Removed;
+	if (*Offered <= 0)
+	{
+		Offer.Items.Remove(ItemID);
+	}
+
+	// Don't let rounding drift survive an empty offer
+	Offer.TotalValue = Offer.Items.Num() > 0
+		? FMath::Max(0.0f, Offer.TotalValue - CalculateItemValue(ItemID, CurrentZone) * Removed)
+		: 0.0f;
+}
+
+EHaggleResult UBarterComponent::SubmitCurrentOffer()
+{
+	if (!ActiveMerchant)
+	{
+		return EHaggleResult::Rejected;
 	}
 
-	CurrentProposal.PlayerOffer.TotalValue = PlayerValue;
-	CurrentProposal.MerchantOffer.TotalValue = MerchantValue;
+	return EvaluateCurrentProposal();
+}
+
+EHaggleResult UBarterComponent::EvaluateCurrentProposal()
+{
+	CurrentProposal.HaggleRoundsUsed = 0;
+	CurrentProposal.HaggleModifier = 1.0f;
+
+	const float PlayerValue = CurrentProposal.PlayerOffer.TotalValue;
+	const float MerchantValue = CurrentProposal.MerchantOffer.TotalValue;
 
 	// Merchant accepts if player offers >= merchant's sell value
 	if (PlayerValue >= MerchantValue)
@@ -188,9 +242,9 @@ void UBarterComponent::ClearStolenFlag(const FGuid& InstanceID)
 
 float UBarterComponent::GetFactionPriceModifier(EFaction Faction) const
 {
-	// TODO: Query FactionReputationComponent for standing with this faction
 	// Hostile: cannot trade, Unfriendly: 1.3, Neutral: 1.0, Friendly: 0.9, Allied: 0.8
-	return 1.0f;
+	const float* Modifier = FactionPriceModifiers.Find(Faction);
+	return Modifier ? *Modifier : 1.0f;
 }
 
 float UBarterComponent::CalculateHaggleModifier(int32 Round, float SocialStat) const
@@ -218,3 +272,82 @@ bool UBarterComponent::ValidateTradeItems(const FTradeOffer& Offer, UInventoryCo
 
 	return true;
 }
+
+float UBarterComponent::GetOfferValue(const FTradeOffer& Offer) const
+{
+	float Total = 0.0f;
+	for (const auto& Pair : Offer.Items)
+	{
+		Total += CalculateItemValue(Pair.Key, CurrentZone) * Pair.Value;
+	}
+	return Total;
+}
+
+FTradeOffer& UBarterComponent::GetOffer(ETradeSide Side)
+{
+	return Side == ETradeSide::Player ? CurrentProposal.PlayerOffer : CurrentProposal.MerchantOffer;
+}
+
+// --- Price Cache ---
+
+void UBarterComponent::EnsurePriceTable() const
+{
+	if (bPriceTableValid)
+	{
+		return;
+	}
+
+	PriceRows.Reset();
+	ZoneValues.Reset();
+	bPriceTableValid = true;
+
+	if (!ResourceEconomyDataTable)
+	{
+		FactionValues.Reset();
+		return;
+	}
+
+	static const FString ContextString(TEXT("BarterValueCalc"));
+	ResourceEconomyDataTable->ForeachRow<FResourceEconomyData>(ContextString,
+		[this](const FName& RowName, const FResourceEconomyData& Data)
+		{
+			PriceRows.Add(RowName, PriceRows.Num());
+
+			for (int32 Zone = 0; Zone < NumTrainZones; ++Zone)
+			{
+				// First entry for a zone wins, as the per-item scan did
+				float ZoneMultiplier = 1.0f;
+				for (const FZoneValueEntry& Entry : Data.ZoneMultipliers)
+				{
+					if (static_cast<int32>(Entry.Zone) == Zone)
+					{
+						ZoneMultiplier = Entry.ValueMultiplier;
+						break;
+					}
+				}
+				ZoneValues.Add(Data.BaseTradeValue * ZoneMultiplier);
+			}
+		});
+
+	FactionValues.SetNumUninitialized(ZoneValues.Num() * NumFactions);
+	for (int32 Faction = 0; Faction < NumFactions; ++Faction)
+	{
+		RepriceFaction(Faction);
+	}
+}
+
+void UBarterComponent::RepriceFaction(int32 Faction) const
+{
+	const float Modifier = GetFactionPriceModifier(static_cast<EFaction>(Faction));
+	for (int32 Cell = 0; Cell < ZoneValues.Num(); ++Cell)
+	{
+		FactionValues[Cell * NumFactions + Faction] = ZoneValues[Cell] * Modifier;
+	}
+}
+
+int32 UBarterComponent::FindPriceRow(FName ItemID) const
+{
+	EnsurePriceTable();
+	const int32* Row = PriceRows.Find(ItemID);
+	return Row ? *Row : INDEX_NONE;
+}
@@ -62,12 +62,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
 	void SetCurrentZone(ETrainZone Zone);
 
+	/** Set the price modifier for a merchant faction (pushed from the game's faction standing). */
+	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
+	void SetFactionPriceModifier(EFaction Faction, float Modifier);
+
 	// --- Trade Proposals ---
 
 	/** Propose a trade: what the player offers vs. what they want from the merchant. */
 	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
 	EHaggleResult ProposeTradeOffer(const FTradeProposal& Proposal);
 
+	/** Add items to one side of the current proposal. Only that side's total changes. */
+	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
+	void AddItemToOffer(ETradeSide Side, FName ItemID, int32 Count = 1);
+
+	/** Remove items from one side of the current proposal. */
+	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
+	void RemoveItemFromOffer(ETradeSide Side, FName ItemID, int32 Count = 1);
+
+	/** Propose the current proposal as built with AddItemToOffer/RemoveItemFromOffer. */
+	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
+	EHaggleResult SubmitCurrentOffer();
+
 	/** Attempt to haggle for a better deal. Returns the merchant's response. */
 	UFUNCTION(BlueprintCallable, Category = "Economy|Barter")
 	EHaggleResult Haggle();
@@ -128,8 +144,41 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Economy|Config")
 	float StolenClearanceDays = 7.0f;
 
+	// Merchant price modifier per faction; factions not listed trade at 1.0
+	UPROPERTY(VisibleAnywhere, Category = "Economy|Runtime")
+	TMap<EFaction, float> FactionPriceModifiers;
+
 private:
 	float GetFactionPriceModifier(EFaction Faction) const;
 	float CalculateHaggleModifier(int32 Round, float SocialStat) const;
 	bool ValidateTradeItems(const FTradeOffer& Offer, UInventoryComponent* Source) const;
+
+	/** Merchant's verdict on CurrentProposal's totals; resets haggling */
+	EHaggleResult EvaluateCurrentProposal();
+
+	float GetOfferValue(const FTradeOffer& Offer) const;
+	FTradeOffer& GetOffer(ETradeSide Side);
+
+	// --- Price Cache ---
+	// Every row of ResourceEconomyDataTable priced in every zone, and again under every
+	// faction's modifier, so valuing an item is one index instead of a FindRow and a
+	// zone scan. Built on first use; a faction's slice is re-priced when its modifier changes.
+
+	static constexpr int32 NumFactions = static_cast<int32>(EFaction::TheThaw) + 1;
+
+	void EnsurePriceTable() const;
+	void RepriceFaction(int32 Faction) const;
+
+	/** INDEX_NONE if the item has no economy row */
+	int32 FindPriceRow(FName ItemID) const;
+
+	mutable TMap<FName, int32> PriceRows;
+
+	// [Row * NumTrainZones + Zone]
+	mutable TArray<float> ZoneValues;
+
+	// [(Row * NumTrainZones + Zone) * NumFactions + Faction]
+	mutable TArray<float> FactionValues;
+
+	mutable bool bPriceTableValid = false;
 };
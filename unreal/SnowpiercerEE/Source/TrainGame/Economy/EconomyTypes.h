@@ -18,6 +18,8 @@ enum class ETrainZone : uint8
 	Engine			UMETA(DisplayName = "Engine Section")
 };
 
+constexpr int32 NumTrainZones = static_cast<int32>(ETrainZone::Engine) + 1;
+
 // Merchant archetype — determines inventory pool and behavior
 UENUM(BlueprintType)
 enum class EMerchantType : uint8
@@ -43,6 +45,14 @@ enum class EHaggleResult : uint8
 	MerchantAngry	UMETA(DisplayName = "Merchant Angry (deal off)")
 };
 
+// Side of a trade proposal
+UENUM(BlueprintType)
+enum class ETradeSide : uint8
+{
+	Player			UMETA(DisplayName = "Player Offer"),
+	Merchant		UMETA(DisplayName = "Merchant Offer")
+};
+
 // Degradation category for perishable items
 UENUM(BlueprintType)
 enum class EDegradationCategory : uint8
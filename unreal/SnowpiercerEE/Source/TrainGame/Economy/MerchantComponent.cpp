@@ -1,5 +1,7 @@
 // MerchantComponent.cpp - NPC merchant implementation
 #include "MerchantComponent.h"
+#include "MerchantRestockSubsystem.h"
+#include "Engine/World.h"
 
 UMerchantComponent::UMerchantComponent()
 {
@@ -9,68 +11,73 @@ UMerchantComponent::UMerchantComponent()
 void UMerchantComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	RefreshInventory();
+
+	LocalStock.Reset(BaseInventory);
+	LastRefreshGameTime = GetWorld()->GetTimeSeconds();
+
+	// A merchant returning with its car resumes the stock it left with
+	RestockSubsystem = GetWorld()->GetSubsystem<UMerchantRestockSubsystem>();
+	if (RestockSubsystem.IsValid())
+	{
+		RestockSubsystem->RegisterMerchant(this);
+	}
+}
+
+void UMerchantComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (RestockSubsystem.IsValid())
+	{
+		RestockSubsystem->UnregisterMerchant(this);
+	}
+	RestockSubsystem.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 TArray<FMerchantInventorySlot> UMerchantComponent::GetAvailableInventory(int32 PlayerFavorTier) const
 {
 	TArray<FMerchantInventorySlot> Available;
-	for (const FMerchantInventorySlot& Slot : CurrentInventory)
+	ForEachAvailableSlot(PlayerFavorTier, [&Available](const FMerchantInventorySlot& Slot)
 	{
-		if (Slot.Quantity > 0 && Slot.RequiredFavorTier <= PlayerFavorTier)
-		{
-			Available.Add(Slot);
-		}
-	}
+		Available.Add(Slot);
+	});
 	return Available;
 }
 
+void UMerchantComponent::ForEachAvailableSlot(int32 PlayerFavorTier, TFunctionRef<void(const FMerchantInventorySlot&)> Visit) const
+{
+	GetStock().ForEachAvailable(PlayerFavorTier, Visit);
+}
+
 bool UMerchantComponent::HasItemInStock(FName ItemID, int32 Quantity) const
 {
-	for (const FMerchantInventorySlot& Slot : CurrentInventory)
-	{
-		if (Slot.ItemID == ItemID && Slot.Quantity >= Quantity)
-		{
-			return true;
-		}
-	}
-	return false;
+	return GetStock().GetQuantity(ItemID) >= Quantity;
 }
 
 void UMerchantComponent::RemoveFromStock(FName ItemID, int32 Quantity)
 {
-	for (FMerchantInventorySlot& Slot : CurrentInventory)
-	{
-		if (Slot.ItemID == ItemID)
-		{
-			Slot.Quantity = FMath::Max(0, Slot.Quantity - Quantity);
-			return;
-		}
-	}
+	GetStock().Remove(ItemID, Quantity);
 }
 
 void UMerchantComponent::AddToStock(FName ItemID, int32 Quantity)
 {
-	for (FMerchantInventorySlot& Slot : CurrentInventory)
+	GetStock().Add(ItemID, Quantity);
+}
+
+void UMerchantComponent::RefreshInventory()
+{
+	if (RestockSubsystem.IsValid() && RestockSubsystem->FindStock(MerchantID))
 	{
-		if (Slot.ItemID == ItemID)
-		{
-			Slot.Quantity += Quantity;
-			return;
-		}
+		RestockSubsystem->RestockNow(MerchantID); // Calls back into NotifyRestocked
+		return;
 	}
 
-	// Item not in inventory — add new slot
-	FMerchantInventorySlot NewSlot;
-	NewSlot.ItemID = ItemID;
-	NewSlot.Quantity = Quantity;
-	NewSlot.PriceMultiplier = 1.0f;
-	CurrentInventory.Add(NewSlot);
+	LocalStock.Reset(BaseInventory);
+	NotifyRestocked();
 }
 
-void UMerchantComponent::RefreshInventory()
+void UMerchantComponent::NotifyRestocked()
 {
-	CurrentInventory = BaseInventory;
 	LastRefreshGameTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 }
 
@@ -108,3 +115,15 @@ void UMerchantComponent::RecalculateFavorTier()
 		FavorTier = 0;
 	}
 }
+
+FMerchantStock& UMerchantComponent::GetStock()
+{
+	FMerchantStock* Shared = RestockSubsystem.IsValid() ? RestockSubsystem->FindStock(MerchantID) : nullptr;
+	return Shared ? *Shared : LocalStock;
+}
+
+const FMerchantStock& UMerchantComponent::GetStock() const
+{
+	const FMerchantStock* Shared = RestockSubsystem.IsValid() ? RestockSubsystem->FindStock(MerchantID) : nullptr;
+	return Shared ? *Shared : LocalStock;
+}
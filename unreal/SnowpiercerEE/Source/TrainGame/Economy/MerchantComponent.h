@@ -4,8 +4,11 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "EconomyTypes.h"
+#include "MerchantStock.h"
 #include "MerchantComponent.generated.h"
 
+class UMerchantRestockSubsystem;
+
 /**
  * UMerchantComponent
  *
@@ -41,12 +44,19 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Economy|Merchant")
 	bool DoesBuyStolenGoods() const { return bBuysStolenGoods; }
 
+	const TArray<FMerchantInventorySlot>& GetBaseInventory() const { return BaseInventory; }
+
+	float GetInventoryRefreshDays() const { return InventoryRefreshDays; }
+
 	// --- Inventory ---
 
 	/** Get all items available for sale (filtered by player's favor tier). */
 	UFUNCTION(BlueprintCallable, Category = "Economy|Merchant")
 	TArray<FMerchantInventorySlot> GetAvailableInventory(int32 PlayerFavorTier = 0) const;
 
+	/** Visit the slots GetAvailableInventory would return, without copying them. */
+	void ForEachAvailableSlot(int32 PlayerFavorTier, TFunctionRef<void(const FMerchantInventorySlot&)> Visit) const;
+
 	/** Check if the merchant has a specific item in stock. */
 	UFUNCTION(BlueprintPure, Category = "Economy|Merchant")
 	bool HasItemInStock(FName ItemID, int32 Quantity = 1) const;
@@ -59,10 +69,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Economy|Merchant")
 	void AddToStock(FName ItemID, int32 Quantity);
 
-	/** Force refresh merchant inventory (timer-based or event-triggered). */
+	/** Force refresh merchant inventory now. Scheduled restocks come from UMerchantRestockSubsystem. */
 	UFUNCTION(BlueprintCallable, Category = "Economy|Merchant")
 	void RefreshInventory();
 
+	/** Called by UMerchantRestockSubsystem after it replaces this merchant's stock. */
+	void NotifyRestocked();
+
 	// --- Pricing ---
 
 	/** Get buy price ratio (what fraction of value the merchant pays). */
@@ -97,7 +110,9 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	// Identifies this merchant train-wide; its stock persists under this ID while the car is streamed out
 	UPROPERTY(EditAnywhere, Category = "Merchant|Config")
 	FName MerchantID;
 
@@ -129,9 +144,6 @@ protected:
 	TArray<FMerchantInventorySlot> BaseInventory;
 
 	// Runtime state
-	UPROPERTY(VisibleAnywhere, Category = "Merchant|Runtime")
-	TArray<FMerchantInventorySlot> CurrentInventory;
-
 	UPROPERTY(VisibleAnywhere, Category = "Merchant|Runtime")
 	int32 FavorTier = 0;
 
@@ -146,4 +158,12 @@ protected:
 
 private:
 	void RecalculateFavorTier();
+
+	/** Stock held by the restock subsystem while registered with it, else LocalStock */
+	FMerchantStock& GetStock();
+	const FMerchantStock& GetStock() const;
+
+	FMerchantStock LocalStock;
+
+	TWeakObjectPtr<UMerchantRestockSubsystem> RestockSubsystem;
 };
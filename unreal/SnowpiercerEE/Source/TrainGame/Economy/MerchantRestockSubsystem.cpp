@@ -0,0 +1,207 @@
+// MerchantRestockSubsystem.cpp - Train-wide merchant restocking implementation
+#include "MerchantRestockSubsystem.h"
+#include "MerchantComponent.h"
+#include "TrainGame/AI/NPCScheduleSubsystem.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRestockBatchSize(
+	TEXT("Economy.Restock.BatchSize"),
+	64,
+	TEXT("Most merchants rebuilt by one background restock batch."));
+
+void UMerchantRestockSubsystem::Deinitialize()
+{
+	// A batch still in flight finds the subsystem gone and is dropped
+	Merchants.Empty();
+	RestockQueue.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UMerchantRestockSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMerchantRestockSubsystem, STATGROUP_Tickables);
+}
+
+// --- Merchants ---
+
+void UMerchantRestockSubsystem::RegisterMerchant(UMerchantComponent* Merchant)
+{
+	if (!Merchant || Merchant->GetMerchantID().IsNone())
+	{
+		return;
+	}
+
+	const FName MerchantID = Merchant->GetMerchantID();
+	const bool bKnown = Merchants.Contains(MerchantID);
+
+	FMerchantRecord& Record = Merchants.FindOrAdd(MerchantID);
+	Record.Component = Merchant;
+	Record.BaseInventory = Merchant->GetBaseInventory();
+	Record.RestockIntervalHours = FMath::Max(Merchant->GetInventoryRefreshDays(), 0.0f) * 24.0;
+
+	if (!bKnown)
+	{
+		Record.Stock.Reset(Record.BaseInventory);
+		QueueRestock(MerchantID, Record);
+	}
+}
+
+void UMerchantRestockSubsystem::UnregisterMerchant(UMerchantComponent* Merchant)
+{
+	FMerchantRecord* Record = Merchant ? Merchants.Find(Merchant->GetMerchantID()) : nullptr;
+	if (Record && Record->Component == Merchant)
+	{
+		Record->Component.Reset();
+	}
+}
+
+FMerchantStock* UMerchantRestockSubsystem::FindStock(FName MerchantID)
+{
+	FMerchantRecord* Record = Merchants.Find(MerchantID);
+	return Record ? &Record->Stock : nullptr;
+}
+
+const FMerchantStock* UMerchantRestockSubsystem::FindStock(FName MerchantID) const
+{
+	const FMerchantRecord* Record = Merchants.Find(MerchantID);
+	return Record ? &Record->Stock : nullptr;
+}
+
+void UMerchantRestockSubsystem::RestockNow(FName MerchantID)
+{
+	FMerchantRecord* Record = Merchants.Find(MerchantID);
+	if (!Record)
+	{
+		return;
+	}
+
+	// Requeueing bumps the serial, so a batch already building this merchant lands stale
+	Record->Stock.Reset(Record->BaseInventory);
+	QueueRestock(MerchantID, *Record);
+
+	if (UMerchantComponent* Merchant = Record->Component.Get())
+	{
+		Merchant->NotifyRestocked();
+	}
+}
+
+void UMerchantRestockSubsystem::QueueRestock(FName MerchantID, FMerchantRecord& Record)
+{
+	Record.Serial = NextSerial++;
+
+	if (Record.RestockIntervalHours <= 0.0)
+	{
+		return; // Never restocks on its own
+	}
+
+	FRestockDue Due;
+	Due.Hour = GetGameHours() + Record.RestockIntervalHours;
+	Due.MerchantID = MerchantID;
+	Due.Serial = Record.Serial;
+	RestockQueue.HeapPush(Due);
+}
+
+// --- Tick ---
+
+void UMerchantRestockSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// One batch at a time; anything that comes due meanwhile joins the next
+	if (!bBatchInFlight && RestockQueue.Num() > 0 && RestockQueue.HeapTop().Hour <= GetGameHours())
+	{
+		LaunchBatch();
+	}
+}
+
+void UMerchantRestockSubsystem::LaunchBatch()
+{
+	const double Now = GetGameHours();
+	const int32 BatchSize = FMath::Max(CVarRestockBatchSize.GetValueOnGameThread(), 1);
+
+	TArray<FRestockJob> Jobs;
+	while (RestockQueue.Num() > 0 && RestockQueue.HeapTop().Hour <= Now && Jobs.Num() < BatchSize)
+	{
+		FRestockDue Due;
+		RestockQueue.HeapPop(Due, EAllowShrinking::No);
+
+		const FMerchantRecord* Record = Merchants.Find(Due.MerchantID);
+		if (!Record || Record->Serial != Due.Serial)
+		{
+			continue; // Superseded by RestockNow
+		}
+
+		FRestockJob& Job = Jobs.AddDefaulted_GetRef();
+		Job.MerchantID = Due.MerchantID;
+		Job.Serial = Due.Serial;
+		Job.BaseInventory = Record->BaseInventory;
+	}
+
+	if (Jobs.Num() == 0)
+	{
+		return;
+	}
+
+	bBatchInFlight = true;
+
+	// The worker owns the jobs and never touches the subsystem
+	Async(EAsyncExecution::TaskGraph,
+		[Jobs = MoveTemp(Jobs), WeakThis = TWeakObjectPtr<UMerchantRestockSubsystem>(this)]() mutable
+	{
+		for (FRestockJob& Job : Jobs)
+		{
+			Job.Stock.Reset(Job.BaseInventory);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Jobs = MoveTemp(Jobs)]() mutable
+		{
+			if (UMerchantRestockSubsystem* This = WeakThis.Get())
+			{
+				This->OnBatchBuilt(MoveTemp(Jobs));
+			}
+		});
+	});
+}
+
+void UMerchantRestockSubsystem::OnBatchBuilt(TArray<FRestockJob>&& Jobs)
+{
+	bBatchInFlight = false;
+	NumRestockedLastBatch = 0;
+
+	for (FRestockJob& Job : Jobs)
+	{
+		FMerchantRecord* Record = Merchants.Find(Job.MerchantID);
+		if (!Record || Record->Serial != Job.Serial)
+		{
+			continue; // Restocked or removed while the batch was building
+		}
+
+		Record->Stock = MoveTemp(Job.Stock);
+		QueueRestock(Job.MerchantID, *Record);
+		++NumRestockedLastBatch;
+
+		if (UMerchantComponent* Merchant = Record->Component.Get())
+		{
+			Merchant->NotifyRestocked();
+		}
+	}
+}
+
+double UMerchantRestockSubsystem::GetGameHours() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	if (const UNPCScheduleSubsystem* Clock = World->GetSubsystem<UNPCScheduleSubsystem>())
+	{
+		return Clock->GetTotalGameHours();
+	}
+
+	// No train clock: the economy's default day length
+	return World->GetTimeSeconds() * 24.0 / 1440.0;
+}
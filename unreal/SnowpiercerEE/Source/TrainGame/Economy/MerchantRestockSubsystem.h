@@ -0,0 +1,107 @@
+// MerchantRestockSubsystem.h - Train-wide merchant stock and batched restocking
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MerchantStock.h"
+#include "MerchantRestockSubsystem.generated.h"
+
+class UMerchantComponent;
+
+/**
+ * UMerchantRestockSubsystem
+ *
+ * Holds every merchant's stock by MerchantID for the whole train, whether or not the
+ * merchant's car is loaded. A UMerchantComponent registers on BeginPlay and reads and
+ * writes its stock here; when its car streams out the stock stays, and it picks the same
+ * stock back up when the car returns.
+ *
+ * Restocks run on the train's game clock (UNPCScheduleSubsystem) every
+ * InventoryRefreshDays. Due merchants sit in a min-heap; once some come due, up to
+ * Economy.Restock.BatchSize of them are rebuilt together on a background task and the
+ * results swapped in on the game thread. A time skip restocks each merchant once.
+ */
+UCLASS()
+class TRAINGAME_API UMerchantRestockSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// --- Merchants ---
+
+	/** Track a merchant. One seen before keeps its stock, including restocks while it was streamed out. */
+	void RegisterMerchant(UMerchantComponent* Merchant);
+
+	/** The merchant's car is streaming out; its stock stays here and keeps restocking. */
+	void UnregisterMerchant(UMerchantComponent* Merchant);
+
+	FMerchantStock* FindStock(FName MerchantID);
+	const FMerchantStock* FindStock(FName MerchantID) const;
+
+	/** Restock a merchant immediately and restart its interval. */
+	void RestockNow(FName MerchantID);
+
+	// --- Stats ---
+
+	int32 GetNumMerchants() const { return Merchants.Num(); }
+
+	bool IsBatchInFlight() const { return bBatchInFlight; }
+
+	/** Merchants restocked by the last batch to land */
+	int32 GetNumRestockedLastBatch() const { return NumRestockedLastBatch; }
+
+private:
+	struct FMerchantRecord
+	{
+		TArray<FMerchantInventorySlot> BaseInventory;
+		FMerchantStock Stock;
+
+		double RestockIntervalHours = 72.0;
+
+		/** Matches the merchant's queued restock; a restock landing with another serial is stale */
+		uint32 Serial = 0;
+
+		/** Null while the merchant's car is streamed out */
+		TWeakObjectPtr<UMerchantComponent> Component;
+	};
+
+	struct FRestockDue
+	{
+		double Hour = 0.0;
+		FName MerchantID;
+		uint32 Serial = 0;
+
+		bool operator<(const FRestockDue& Other) const { return Hour < Other.Hour; }
+	};
+
+	/** One merchant's restock, built off the game thread */
+	struct FRestockJob
+	{
+		FName MerchantID;
+		uint32 Serial = 0;
+		TArray<FMerchantInventorySlot> BaseInventory;
+		FMerchantStock Stock;
+	};
+
+	/** Queue the merchant's next restock one interval from now, superseding any queued one */
+	void QueueRestock(FName MerchantID, FMerchantRecord& Record);
+
+	void LaunchBatch();
+	void OnBatchBuilt(TArray<FRestockJob>&& Jobs);
+
+	/** Hours on the train's game clock */
+	double GetGameHours() const;
+
+	TMap<FName, FMerchantRecord> Merchants;
+
+	/** Min-heap on Hour. Superseded entries stay until popped and are skipped by serial. */
+	TArray<FRestockDue> RestockQueue;
+	uint32 NextSerial = 1;
+
+	bool bBatchInFlight = false;
+	int32 NumRestockedLastBatch = 0;
+};
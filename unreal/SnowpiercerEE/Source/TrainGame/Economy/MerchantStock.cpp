@@ -0,0 +1,114 @@
+// MerchantStock.cpp - Merchant stock table implementation
+#include "MerchantStock.h"
+
+void FMerchantStock::Reset(const TArray<FMerchantInventorySlot>& InSlots)
+{
+	Slots.Reset(InSlots.Num());
+	SlotIndices.Reset();
+	for (TArray<int32>& Tier : TierSlots)
+	{
+		Tier.Reset();
+	}
+
+	for (const FMerchantInventorySlot& Slot : InSlots)
+	{
+		if (const int32* Index = SlotIndices.Find(Slot.ItemID))
+		{
+			Slots[*Index].Quantity += Slot.Quantity;
+		}
+		else
+		{
+			AddSlot(Slot);
+		}
+	}
+}
+
+const FMerchantInventorySlot* FMerchantStock::Find(FName ItemID) const
+{
+	const int32* Index = SlotIndices.Find(ItemID);
+	return Index ? &Slots[*Index] : nullptr;
+}
+
+int32 FMerchantStock::GetQuantity(FName ItemID) const
+{
+	const FMerchantInventorySlot* Slot = Find(ItemID);
+	return Slot ? Slot->Quantity : 0;
+}
+
+void FMerchantStock::Add(FName ItemID, int32 Quantity)
+{
+	if (const int32* Index = SlotIndices.Find(ItemID))
+	{
+		Slots[*Index].Quantity += Quantity;
+		return;
+	}
+
+	// Item not in stock — add new slot
+	FMerchantInventorySlot NewSlot;
+	NewSlot.ItemID = ItemID;
+	NewSlot.Quantity = Quantity;
+	NewSlot.PriceMultiplier = 1.0f;
+	AddSlot(NewSlot);
+}
+
+void FMerchantStock::Remove(FName ItemID, int32 Quantity)
+{
+	if (const int32* Index = SlotIndices.Find(ItemID))
+	{
+		FMerchantInventorySlot& Slot = Slots[*Index];
+		Slot.Quantity = FMath::Max(0, Slot.Quantity - Quantity);
+	}
+}
+
+void FMerchantStock::ForEachAvailable(int32 PlayerFavorTier, TFunctionRef<void(const FMerchantInventorySlot&)> Visit) const
+{
+	const int32 LastTier = FMath::Min(PlayerFavorTier, NumFavorTiers - 1);
+
+	// Merge the reached buckets by slot index so the listing keeps stock order
+	int32 Cursors[NumFavorTiers] = {};
+	for (;;)
+	{
+		int32 NextTier = INDEX_NONE;
+		int32 NextIndex = MAX_int32;
+		for (int32 Tier = 0; Tier <= LastTier; ++Tier)
+		{
+			if (Cursors[Tier] < TierSlots[Tier].Num() && TierSlots[Tier][Cursors[Tier]] < NextIndex)
+			{
+				NextTier = Tier;
+				NextIndex = TierSlots[Tier][Cursors[Tier]];
+			}
+		}
+		if (NextTier == INDEX_NONE)
+		{
+			return;
+		}
+
+		++Cursors[NextTier];
+		if (Slots[NextIndex].Quantity > 0)
+		{
+			Visit(Slots[NextIndex]);
+		}
+	}
+}
+
+int32 FMerchantStock::NumAvailable(int32 PlayerFavorTier) const
+{
+	int32 Count = 0;
+	ForEachAvailable(PlayerFavorTier, [&Count](const FMerchantInventorySlot&) { ++Count; });
+	return Count;
+}
+
+void FMerchantStock::AddSlot(const FMerchantInventorySlot& Slot)
+{
+	const int32 Index = Slots.Add(Slot);
+	SlotIndices.Add(Slot.ItemID, Index);
+
+	int32 Tier = FMath::Max(Slot.RequiredFavorTier, 0);
+	if (Tier >= NumFavorTiers)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MerchantStock: %s requires favor tier %d; offering it at tier %d"),
+			*Slot.ItemID.ToString(), Slot.RequiredFavorTier, NumFavorTiers - 1);
+		Tier = NumFavorTiers - 1;
+	}
+	TierSlots[Tier].Add(Index);
+}
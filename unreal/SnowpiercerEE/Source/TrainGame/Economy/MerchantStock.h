@@ -0,0 +1,50 @@
+// MerchantStock.h - ItemID-indexed merchant stock table with favor-tier buckets
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EconomyTypes.h"
+
+/**
+ * FMerchantStock
+ *
+ * One slot per item, found by ItemID through an index, and each slot filed under the
+ * favor tier that unlocks it. Stock checks and trades are a hash lookup; listing what
+ * a player may buy visits only the tiers they have reached.
+ *
+ * Plain data with no UObject references, so restocks can build it off the game thread.
+ */
+struct TRAINGAME_API FMerchantStock
+{
+	/** Favor tiers 0-3; slots requiring more are filed under the last tier */
+	static constexpr int32 NumFavorTiers = 4;
+
+	/** Replace the stock with Slots. Slots sharing an ItemID merge into the first. */
+	void Reset(const TArray<FMerchantInventorySlot>& InSlots);
+
+	const FMerchantInventorySlot* Find(FName ItemID) const;
+
+	int32 GetQuantity(FName ItemID) const;
+
+	/** Add to the item's slot, or open a tier 0 slot at standard price */
+	void Add(FName ItemID, int32 Quantity);
+
+	/** Remove up to Quantity; the slot stays (at 0) so restocks and tiers keep their place */
+	void Remove(FName ItemID, int32 Quantity);
+
+	/** Visit every slot with stock that PlayerFavorTier unlocks, in stock (BaseInventory) order */
+	void ForEachAvailable(int32 PlayerFavorTier, TFunctionRef<void(const FMerchantInventorySlot&)> Visit) const;
+
+	/** Number of slots ForEachAvailable would visit */
+	int32 NumAvailable(int32 PlayerFavorTier) const;
+
+	const TArray<FMerchantInventorySlot>& GetSlots() const { return Slots; }
+
+private:
+	TArray<FMerchantInventorySlot> Slots;
+	TMap<FName, int32> SlotIndices;
+
+	// Slot indices by RequiredFavorTier, each ascending since slots are only ever appended
+	TArray<int32> TierSlots[NumFavorTiers];
+
+	void AddSlot(const FMerchantInventorySlot& Slot);
+};
@@ -1,71 +1,158 @@
 // ResourceDegradationComponent.cpp - Perishable item degradation implementation
 #include "ResourceDegradationComponent.h"
 #include "SnowyEngine/Inventory/InventoryComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 UResourceDegradationComponent::UResourceDegradationComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 1.0f; // Tick once per second
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UResourceDegradationComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	LinkedInventory = GetOwner()->FindComponentByClass<UInventoryComponent>();
+
+	// Items registered before play are queued but had no timer to wake them
+	ScheduleWake();
 }
 
-void UResourceDegradationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UResourceDegradationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	if (SecondsPerGameDay <= 0.0f)
+	if (UWorld* World = GetWorld())
 	{
-		return;
+		World->GetTimerManager().ClearTimer(WakeTimer);
 	}
+	Super::EndPlay(EndPlayReason);
+}
+
+// --- Events ---
 
-	TArray<FGuid> ToRemove;
+void UResourceDegradationComponent::ProcessDueEvents()
+{
+	const double Now = GetGameTime();
 
-	for (auto& Pair : TrackedItems)
+	while (Events.Num() > 0 && Events.HeapTop().Time <= Now)
 	{
-		FDegradationEntry& Entry = Pair.Value;
-		if (Entry.bPaused || Entry.DegradationRatePerDay <= 0.0f)
+		FDegradationEvent Event;
+		Events.HeapPop(Event, EAllowShrinking::No);
+
+		FDegradationEntry* Entry = TrackedItems.Find(Event.InstanceID);
+		if (!Entry || Entry->Serial != Event.Serial)
 		{
-			continue;
+			continue; // Unregistered, paused or rescheduled
 		}
 
-		float OldCondition = Entry.Condition;
-		float DecayThisTick = (Entry.DegradationRatePerDay / SecondsPerGameDay) * DeltaTime;
-		Entry.Condition = FMath::Max(0.0f, Entry.Condition - DecayThisTick);
+		// Snap to the threshold so rounding can't leave the item just above it
+		Entry->AnchorCondition = Event.Threshold;
+		Entry->AnchorTime = Event.Time;
 
-		// Broadcast on threshold crossings (every 25%)
-		int32 OldBucket = FMath::FloorToInt(OldCondition * 4.0f);
-		int32 NewBucket = FMath::FloorToInt(Entry.Condition * 4.0f);
-		if (OldBucket != NewBucket)
+		if (Event.Threshold <= 0.0f)
 		{
-			OnItemDegraded.Broadcast(Entry.ItemID, Entry.Condition);
-		}
+			const FName ItemID = Entry->ItemID;
+			TrackedItems.Remove(Event.InstanceID);
 
-		if (Entry.Condition <= 0.0f)
-		{
-			OnItemDestroyed.Broadcast(Entry.ItemID);
+			OnItemDestroyed.Broadcast(ItemID);
 			if (LinkedInventory)
 			{
-				LinkedInventory->RemoveItemByInstance(Pair.Key);
+				LinkedInventory->RemoveItemByInstance(Event.InstanceID);
 			}
-			ToRemove.Add(Pair.Key);
+			continue;
+		}
+
+		QueueNextEvent(Event.InstanceID, *Entry);
+		OnItemDegraded.Broadcast(Entry->ItemID, Event.Threshold);
+	}
+
+	ScheduleWake();
+}
+
+void UResourceDegradationComponent::QueueNextEvent(const FGuid& InstanceID, FDegradationEntry& Entry)
+{
+	Entry.Serial = NextSerial++;
+
+	if (Entry.bPaused || Entry.DegradationRatePerDay <= 0.0f || SecondsPerGameDay <= 0.0f)
+	{
+		return; // Not falling; the serial bump drops any queued event
+	}
+
+	// Highest 25% step strictly below the current condition
+	const float Condition = FMath::Max(Entry.AnchorCondition, 0.0f);
+	const float Threshold = FMath::Max(FMath::CeilToFloat(Condition * 4.0f) - 1.0f, 0.0f) * 0.25f;
+	const double RatePerSecond = static_cast<double>(Entry.DegradationRatePerDay) / SecondsPerGameDay;
+
+	FDegradationEvent Event;
+	Event.Time = Entry.AnchorTime + (Condition - Threshold) / RatePerSecond;
+	Event.InstanceID = InstanceID;
+	Event.Threshold = Threshold;
+	Event.Serial = Entry.Serial;
+	Events.HeapPush(Event);
+}
+
+void UResourceDegradationComponent::ScheduleWake()
+{
+	// Drop superseded events off the top so they don't cause empty wakes
+	while (Events.Num() > 0)
+	{
+		const FDegradationEvent& Top = Events.HeapTop();
+		const FDegradationEntry* Entry = TrackedItems.Find(Top.InstanceID);
+		if (Entry && Entry->Serial == Top.Serial)
+		{
+			break;
 		}
+		FDegradationEvent Stale;
+		Events.HeapPop(Stale, EAllowShrinking::No);
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || !HasBegunPlay())
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (Events.Num() == 0)
+	{
+		TimerManager.ClearTimer(WakeTimer);
+		return;
 	}
 
-	for (const FGuid& ID : ToRemove)
+	// A zero or negative rate would clear the timer; anything due fires next frame
+	const float Delay = FMath::Max(static_cast<float>(Events.HeapTop().Time - GetGameTime()), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(WakeTimer, this, &UResourceDegradationComponent::ProcessDueEvents, Delay, false);
+}
+
+// --- Condition ---
+
+double UResourceDegradationComponent::GetGameTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UResourceDegradationComponent::EvaluateCondition(const FDegradationEntry& Entry, double Time) const
+{
+	if (Entry.bPaused || Entry.DegradationRatePerDay <= 0.0f || SecondsPerGameDay <= 0.0f)
 	{
-		TrackedItems.Remove(ID);
+		return Entry.AnchorCondition;
 	}
+
+	const double Elapsed = FMath::Max(Time - Entry.AnchorTime, 0.0);
+	const double Decay = Elapsed * Entry.DegradationRatePerDay / SecondsPerGameDay;
+	return FMath::Max(0.0f, static_cast<float>(Entry.AnchorCondition - Decay));
+}
+
+void UResourceDegradationComponent::Rebase(FDegradationEntry& Entry, double Time) const
+{
+	Entry.AnchorCondition = EvaluateCondition(Entry, Time);
+	Entry.AnchorTime = Time;
 }
 
 float UResourceDegradationComponent::GetItemCondition(const FGuid& InstanceID) const
 {
 	const FDegradationEntry* Entry = TrackedItems.Find(InstanceID);
-	return Entry ? Entry->Condition : 1.0f;
+	return Entry ? EvaluateCondition(*Entry, GetGameTime()) : 1.0f;
 }
 
 FText UResourceDegradationComponent::GetConditionLabel(const FGuid& InstanceID) const
@@ -89,18 +176,24 @@ float UResourceDegradationComponent::GetEffectivenessMultiplier(const FGuid& Ins
 void UResourceDegradationComponent::PauseItemDegradation(const FGuid& InstanceID)
 {
 	FDegradationEntry* Entry = TrackedItems.Find(InstanceID);
-	if (Entry)
+	if (Entry && !Entry->bPaused)
 	{
+		Rebase(*Entry, GetGameTime());
 		Entry->bPaused = true;
+		QueueNextEvent(InstanceID, *Entry);
+		ScheduleWake();
 	}
 }
 
 void UResourceDegradationComponent::ResumeItemDegradation(const FGuid& InstanceID)
 {
 	FDegradationEntry* Entry = TrackedItems.Find(InstanceID);
-	if (Entry)
+	if (Entry && Entry->bPaused)
 	{
+		Entry->AnchorTime = GetGameTime();
 		Entry->bPaused = false;
+		QueueNextEvent(InstanceID, *Entry);
+		ScheduleWake();
 	}
 }
 
@@ -109,7 +202,10 @@ void UResourceDegradationComponent::SetItemCondition(const FGuid& InstanceID, fl
 	FDegradationEntry* Entry = TrackedItems.Find(InstanceID);
 	if (Entry)
 	{
-		Entry->Condition = FMath::Clamp(Condition, 0.0f, 1.0f);
+		Entry->AnchorCondition = FMath::Clamp(Condition, 0.0f, 1.0f);
+		Entry->AnchorTime = GetGameTime();
+		QueueNextEvent(InstanceID, *Entry);
+		ScheduleWake();
 	}
 }
 
@@ -117,17 +213,20 @@ void UResourceDegradationComponent::RegisterItem(const FGuid& InstanceID, FName
 {
 	float Rate = GetDegradationRate(ItemID);
 
-	FDegradationEntry Entry;
+	FDegradationEntry& Entry = TrackedItems.Add(InstanceID);
 	Entry.ItemID = ItemID;
-	Entry.Condition = 1.0f;
+	Entry.AnchorCondition = 1.0f;
+	Entry.AnchorTime = GetGameTime();
 	Entry.DegradationRatePerDay = Rate;
 	Entry.bPaused = false;
 
-	TrackedItems.Add(InstanceID, Entry);
+	QueueNextEvent(InstanceID, Entry);
+	ScheduleWake();
 }
 
 void UResourceDegradationComponent::UnregisterItem(const FGuid& InstanceID)
 {
+	// Its queued event no longer finds an entry and is dropped when popped
 	TrackedItems.Remove(InstanceID);
 }
 
@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "EconomyTypes.h"
+#include "Engine/TimerHandle.h"
 #include "ResourceDegradationComponent.generated.h"
 
 class UInventoryComponent;
@@ -11,9 +12,14 @@ class UInventoryComponent;
 /**
  * UResourceDegradationComponent
  *
- * Ticks on the player character alongside UInventoryComponent. Tracks condition
- * values for perishable items and degrades them over time. Items at 0% condition
- * are auto-removed from inventory.
+ * Lives on the player character (or any merchant/container) alongside UInventoryComponent.
+ * Tracks condition values for perishable items, which fall linearly with game time.
+ * Items at 0% condition are auto-removed from inventory.
+ *
+ * Condition is never stepped: each item stores the condition it had at an anchor time
+ * and its rate, and queries evaluate the line. The only scheduled work is the next
+ * 25% threshold crossing of each item, kept in a min-heap, and a single timer wakes
+ * the component when the earliest one is due. It does not tick.
  *
  * Degradation can be halted by storing items in appropriate storage actors
  * (refrigeration, sealed containers, etc.) — those actors call PauseItemDegradation().
@@ -26,8 +32,6 @@ class TRAINGAME_API UResourceDegradationComponent : public UActorComponent
 public:
 	UResourceDegradationComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	// --- Condition Queries ---
 
 	/** Get the current condition (0.0-1.0) of an item instance. Returns 1.0 for durable items. */
@@ -76,6 +80,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditAnywhere, Category = "Economy|Config")
 	UDataTable* ResourceEconomyDataTable = nullptr;
@@ -89,15 +94,56 @@ private:
 	struct FDegradationEntry
 	{
 		FName ItemID;
-		float Condition = 1.0f;
+
+		/** Condition at AnchorTime; it falls at DegradationRatePerDay from there unless paused */
+		float AnchorCondition = 1.0f;
+		double AnchorTime = 0.0;
+
 		float DegradationRatePerDay = 0.0f;
 		bool bPaused = false;
+
+		/** Matches the item's queued threshold event while that event is current */
+		uint32 Serial = 0;
+	};
+
+	// Next threshold crossing for one item
+	struct FDegradationEvent
+	{
+		double Time = 0.0;
+		FGuid InstanceID;
+
+		/** Condition the item reaches at Time: 0.75, 0.5, 0.25 or 0 (destroyed) */
+		float Threshold = 0.0f;
+
+		uint32 Serial = 0;
+
+		bool operator<(const FDegradationEvent& Other) const { return Time < Other.Time; }
 	};
 
 	TMap<FGuid, FDegradationEntry> TrackedItems;
 
+	/** Min-heap on Time. Superseded entries stay until popped and are skipped by serial. */
+	TArray<FDegradationEvent> Events;
+	uint32 NextSerial = 1;
+
+	FTimerHandle WakeTimer;
+
 	UPROPERTY()
 	UInventoryComponent* LinkedInventory = nullptr;
 
 	float GetDegradationRate(FName ItemID) const;
+
+	double GetGameTime() const;
+	float EvaluateCondition(const FDegradationEntry& Entry, double Time) const;
+
+	/** Move Entry's anchor to Time without changing its condition */
+	void Rebase(FDegradationEntry& Entry, double Time) const;
+
+	/** Queue Entry's next threshold crossing, superseding any queued one */
+	void QueueNextEvent(const FGuid& InstanceID, FDegradationEntry& Entry);
+
+	void ProcessDueEvents();
+
+	/** Point the wake timer at the earliest live event, or clear it */
+	void ScheduleWake();
 };
@@ -1,51 +1,79 @@
 // Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
 
 #include "EnvironmentalHazardComponent.h"
+#include "HazardSubsystem.h"
 #include "TrainGame/Combat/CombatComponent.h"
+#include "TrainGame/Stealth/NoisePropagationSubsystem.h"
+#include "Components/SphereComponent.h"
 #include "GameFramework/Character.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Engine/World.h"
-#include "Engine/OverlapResult.h"
 
 UEnvironmentalHazardComponent::UEnvironmentalHazardComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UEnvironmentalHazardComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>();
+	if (Hazards)
+	{
+		Hazards->RegisterHazard(this);
+	}
+
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	// Pawns only, so the trigger stays quiet around props and projectiles.
+	// Uniquely named: an actor may carry several hazards, and a fixed name would collide
+	HazardZone = NewObject<USphereComponent>(Owner, MakeUniqueObjectName(Owner, USphereComponent::StaticClass(), TEXT("HazardZone")));
+	HazardZone->InitSphereRadius(HazardRadius);
+	HazardZone->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	HazardZone->SetCollisionObjectType(ECC_WorldDynamic);
+	HazardZone->SetCollisionResponseToAllChannels(ECR_Ignore);
+	HazardZone->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	HazardZone->SetGenerateOverlapEvents(true);
+	HazardZone->OnComponentBeginOverlap.AddDynamic(this, &UEnvironmentalHazardComponent::OnZoneBeginOverlap);
+	HazardZone->OnComponentEndOverlap.AddDynamic(this, &UEnvironmentalHazardComponent::OnZoneEndOverlap);
+
+	if (USceneComponent* Root = Owner->GetRootComponent())
+	{
+		HazardZone->SetupAttachment(Root);
+	}
+	else
+	{
+		Owner->SetRootComponent(HazardZone);
+	}
+	HazardZone->RegisterComponent();
+
+	// Pick up anyone already standing in the zone
+	HazardZone->UpdateOverlaps();
 }
 
-void UEnvironmentalHazardComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UEnvironmentalHazardComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->UnregisterHazard(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
+bool UEnvironmentalHazardComponent::AdvanceTimers(float DeltaTime)
+{
 	// Cooldown
 	if (CooldownTimer > 0.f)
 	{
 		CooldownTimer -= DeltaTime;
 	}
 
-	// Active hazard applies damage over time
 	if (bIsHazardActive)
 	{
 		ActiveTimer -= DeltaTime;
 
-		if (bDamageOverTime)
-		{
-			TArray<AActor*> VictimsInZone = GetActorsInHazardZone();
-			for (AActor* Victim : VictimsInZone)
-			{
-				UCombatComponent* CombatComp = Victim->FindComponentByClass<UCombatComponent>();
-				if (CombatComp && CombatComp->IsAlive())
-				{
-					EDamageType DmgType = GetDamageTypeForHazard();
-					CombatComp->ReceiveAttack(DamagePerSecond * DeltaTime, EAttackDirection::Mid, DmgType, GetOwner());
-				}
-			}
-		}
-
 		if (ActiveTimer <= 0.f)
 		{
 			bIsHazardActive = false;
@@ -55,6 +83,8 @@ void UEnvironmentalHazardComponent::TickComponent(float DeltaTime, ELevelTick Ti
 			}
 		}
 	}
+
+	return bIsHazardActive || CooldownTimer > 0.f;
 }
 
 void UEnvironmentalHazardComponent::TriggerHazard(AActor* Instigator)
@@ -65,6 +95,21 @@ void UEnvironmentalHazardComponent::TriggerHazard(AActor* Instigator)
 	bHasBeenTriggered = true;
 	ActiveTimer = ActiveDuration;
 
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->WakeHazard(this);
+	}
+
+	if (UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>())
+	{
+		FNoiseEvent Event;
+		Event.Origin = GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector;
+		Event.Radius = NoiseRadius;
+		Event.Intensity = ESoundIntensity::High;
+		Event.Instigator = Instigator;
+		Noise->ReportNoise(Event);
+	}
+
 	// Apply immediate effects to everyone in zone
 	TArray<AActor*> Victims = GetActorsInHazardZone();
 	for (AActor* Victim : Victims)
@@ -153,29 +198,33 @@ EDamageType UEnvironmentalHazardComponent::GetDamageTypeForHazard() const
 TArray<AActor*> UEnvironmentalHazardComponent::GetActorsInHazardZone() const
 {
 	TArray<AActor*> Results;
-	if (!GetOwner()) return Results;
-
-	// Overlap sphere to find actors in zone
-	TArray<FOverlapResult> Overlaps;
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(GetOwner());
+	if (const UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->GetOccupants(this, Results);
+	}
+	return Results;
+}
 
-	GetWorld()->OverlapMultiByChannel(
-		Overlaps,
-		GetOwner()->GetActorLocation(),
-		FQuat::Identity,
-		ECollisionChannel::ECC_Pawn,
-		FCollisionShape::MakeSphere(HazardRadius),
-		Params
-	);
+void UEnvironmentalHazardComponent::OnZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
+	bool bFromSweep, const FHitResult& SweepResult)
+{
+	if (!OtherActor || OtherActor == GetOwner()) return;
 
-	for (const FOverlapResult& Overlap : Overlaps)
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
 	{
-		if (AActor* Actor = Overlap.GetActor())
-		{
-			Results.AddUnique(Actor);
-		}
+		Hazards->AddOccupant(this, OtherActor);
 	}
+}
 
-	return Results;
+void UEnvironmentalHazardComponent::OnZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	// An actor with several pawn-channel bodies leaves only when the last one does
+	if (!OtherActor || HazardZone->IsOverlappingActor(OtherActor)) return;
+
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->RemoveOccupant(this, OtherActor);
+	}
 }
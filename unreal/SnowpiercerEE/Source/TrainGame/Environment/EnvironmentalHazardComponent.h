@@ -7,12 +7,17 @@
 #include "TrainGame/Core/CombatTypes.h"
 #include "EnvironmentalHazardComponent.generated.h"
 
+class USphereComponent;
+
 // ============================================================================
 // UEnvironmentalHazardComponent
 //
 // Attach to environmental objects in train cars that can be triggered
 // during combat for environmental kills. Steam vents scald, electrical
 // panels shock, window breaches suck enemies into the frozen void.
+//
+// Hazards don't tick. A sphere trigger of HazardRadius reports who is inside
+// to UHazardSubsystem, which also runs the timers and damage over time.
 // ============================================================================
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHazardTriggered, EEnvironmentalHazard, HazardType, AActor*, Victim);
@@ -25,8 +30,6 @@ class TRAINGAME_API UEnvironmentalHazardComponent : public UActorComponent
 public:
 	UEnvironmentalHazardComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	/** Trigger the hazard, affecting all actors in the hazard zone */
 	UFUNCTION(BlueprintCallable, Category = "Environment|Hazard")
 	void TriggerHazard(AActor* Instigator);
@@ -42,8 +45,18 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Environment|Hazard")
 	FOnHazardTriggered OnHazardTriggered;
 
+	// --- Subsystem ---
+
+	/** Count down the active and cooldown timers. Returns false once neither is running. */
+	bool AdvanceTimers(float DeltaTime);
+
+	bool IsDealingDamageOverTime() const { return bIsHazardActive && bDamageOverTime; }
+	float GetDamagePerSecond() const { return DamagePerSecond; }
+	EDamageType GetDamageTypeForHazard() const;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** What type of hazard this is */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hazard")
@@ -101,12 +114,28 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hazard")
 	bool bEnemiesCanTrigger = true;
 
+	/** How far the hazard going off is heard (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hazard")
+	float NoiseRadius = 1500.f;
+
 private:
 	void ApplyHazardEffect(AActor* Victim, AActor* Instigator);
 	void ApplyKnockback(AActor* Victim) const;
-	EDamageType GetDamageTypeForHazard() const;
 	TArray<AActor*> GetActorsInHazardZone() const;
 
+	UFUNCTION()
+	void OnZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
+		bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	/** Pawn-only overlap trigger created on BeginPlay */
+	UPROPERTY(Transient)
+	USphereComponent* HazardZone = nullptr;
+
 	bool bIsHazardActive = false;
 	float ActiveTimer = 0.f;
 	float CooldownTimer = 0.f;
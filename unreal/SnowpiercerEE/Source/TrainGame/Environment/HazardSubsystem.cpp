@@ -0,0 +1,183 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "HazardSubsystem.h"
+#include "EnvironmentalHazardComponent.h"
+#include "TrainGame/Combat/CombatComponent.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarHazardDamageTickRate(
+	TEXT("Hazard.DamageTickRate"),
+	4.f,
+	TEXT("Damage-over-time steps per second applied by environmental hazards."));
+
+void UHazardSubsystem::Deinitialize()
+{
+	Hazards.Empty();
+	TickingHazards.Empty();
+	PendingDamage.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UHazardSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHazardSubsystem, STATGROUP_Tickables);
+}
+
+// --- Hazards ---
+
+void UHazardSubsystem::RegisterHazard(UEnvironmentalHazardComponent* Hazard)
+{
+	if (!Hazard) return;
+
+	FHazardEntry& Entry = Hazards.FindOrAdd(Hazard);
+	Entry.Hazard = Hazard;
+}
+
+void UHazardSubsystem::UnregisterHazard(UEnvironmentalHazardComponent* Hazard)
+{
+	Hazards.Remove(Hazard);
+	TickingHazards.Remove(Hazard);
+}
+
+void UHazardSubsystem::WakeHazard(UEnvironmentalHazardComponent* Hazard)
+{
+	if (Hazard && Hazards.Contains(Hazard))
+	{
+		TickingHazards.AddUnique(Hazard);
+	}
+}
+
+UEnvironmentalHazardComponent* UHazardSubsystem::FindTriggerableHazard(const FVector& Location, float Radius) const
+{
+	UEnvironmentalHazardComponent* Closest = nullptr;
+	float ClosestDistSq = FMath::Square(Radius);
+
+	for (const TPair<TObjectKey<UEnvironmentalHazardComponent>, FHazardEntry>& Pair : Hazards)
+	{
+		UEnvironmentalHazardComponent* Hazard = Pair.Value.Hazard.Get();
+		if (!Hazard || !Hazard->CanTrigger() || !Hazard->GetOwner()) continue;
+
+		const float DistSq = FVector::DistSquared(Location, Hazard->GetOwner()->GetActorLocation());
+		if (DistSq < ClosestDistSq)
+		{
+			ClosestDistSq = DistSq;
+			Closest = Hazard;
+		}
+	}
+	return Closest;
+}
+
+// --- Occupants ---
+
+void UHazardSubsystem::AddOccupant(UEnvironmentalHazardComponent* Hazard, AActor* Actor)
+{
+	FHazardEntry* Entry = Hazard ? Hazards.Find(Hazard) : nullptr;
+	if (!Entry || !Actor) return;
+
+	for (const FOccupant& Occupant : Entry->Occupants)
+	{
+		if (Occupant.Actor == Actor) return;
+	}
+
+	UCombatComponent* Combat = Actor->FindComponentByClass<UCombatComponent>();
+	if (!Combat) return;
+
+	FOccupant& Occupant = Entry->Occupants.AddDefaulted_GetRef();
+	Occupant.Actor = Actor;
+	Occupant.Combat = Combat;
+}
+
+void UHazardSubsystem::RemoveOccupant(UEnvironmentalHazardComponent* Hazard, AActor* Actor)
+{
+	if (FHazardEntry* Entry = Hazard ? Hazards.Find(Hazard) : nullptr)
+	{
+		Entry->Occupants.RemoveAllSwap([Actor](const FOccupant& Occupant)
+		{
+			return Occupant.Actor == Actor || !Occupant.Actor.IsValid();
+		});
+	}
+}
+
+void UHazardSubsystem::GetOccupants(const UEnvironmentalHazardComponent* Hazard, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+	if (const FHazardEntry* Entry = Hazard ? Hazards.Find(Hazard) : nullptr)
+	{
+		for (const FOccupant& Occupant : Entry->Occupants)
+		{
+			if (AActor* Actor = Occupant.Actor.Get())
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	}
+}
+
+// --- Tick ---
+
+void UHazardSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	NumDamageAppliedLastFrame = 0;
+	if (TickingHazards.Num() == 0)
+	{
+		DamageAccumulator = 0.f;
+		LastTickMs = 0.0;
+		return;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// Damage before timers so a hazard's last partial step still lands
+	const float StepSeconds = 1.f / FMath::Max(CVarHazardDamageTickRate.GetValueOnGameThread(), 0.1f);
+	DamageAccumulator = FMath::Min(DamageAccumulator + DeltaTime, StepSeconds * MaxDamageStepsPerFrame);
+	while (DamageAccumulator >= StepSeconds)
+	{
+		DamageAccumulator -= StepSeconds;
+		ApplyDamageStep(StepSeconds);
+	}
+
+	for (int32 i = TickingHazards.Num() - 1; i >= 0; --i)
+	{
+		UEnvironmentalHazardComponent* Hazard = TickingHazards[i].Get();
+		if (!Hazard || !Hazard->AdvanceTimers(DeltaTime))
+		{
+			TickingHazards.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	LastTickMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+}
+
+void UHazardSubsystem::ApplyDamageStep(float StepSeconds)
+{
+	// Gather first: damage can kill or destroy an occupant, which ends its
+	// overlap and edits the occupant lists mid-iteration
+	PendingDamage.Reset();
+	for (const TWeakObjectPtr<UEnvironmentalHazardComponent>& HazardPtr : TickingHazards)
+	{
+		UEnvironmentalHazardComponent* Hazard = HazardPtr.Get();
+		if (!Hazard || !Hazard->IsDealingDamageOverTime()) continue;
+
+		const FHazardEntry* Entry = Hazards.Find(Hazard);
+		if (!Entry) continue;
+
+		const float Damage = Hazard->GetDamagePerSecond() * StepSeconds;
+		for (const FOccupant& Occupant : Entry->Occupants)
+		{
+			PendingDamage.Add({ Occupant.Combat, HazardPtr, Damage });
+		}
+	}
+
+	for (const FPendingDamage& Pending : PendingDamage)
+	{
+		UCombatComponent* Combat = Pending.Combat.Get();
+		UEnvironmentalHazardComponent* Hazard = Pending.Hazard.Get();
+		if (Combat && Hazard && Combat->IsAlive())
+		{
+			Combat->ReceiveAttack(Pending.Damage, EAttackDirection::Mid, Hazard->GetDamageTypeForHazard(), Hazard->GetOwner());
+			++NumDamageAppliedLastFrame;
+		}
+	}
+}
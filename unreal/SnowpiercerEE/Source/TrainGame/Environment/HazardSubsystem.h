@@ -0,0 +1,111 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HazardSubsystem.generated.h"
+
+class UCombatComponent;
+class UEnvironmentalHazardComponent;
+
+// ============================================================================
+// UHazardSubsystem
+//
+// Runs every UEnvironmentalHazardComponent in the world from one tick:
+//
+//   1. Membership: each hazard owns a sphere trigger whose begin/end overlap
+//      events add and remove occupants here, caching the occupant's
+//      UCombatComponent once on entry. No overlap queries run while a hazard
+//      is active.
+//   2. Timers: only hazards that are active or cooling down are visited.
+//   3. Damage over time is applied at a fixed rate (Hazard.DamageTickRate)
+//      in one pass over the active hazards' cached occupants, independent of
+//      frame rate.
+//
+// Cars with many vents and panels therefore cost nothing until one fires.
+// ============================================================================
+
+UCLASS()
+class TRAINGAME_API UHazardSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// --- Hazards ---
+
+	void RegisterHazard(UEnvironmentalHazardComponent* Hazard);
+	void UnregisterHazard(UEnvironmentalHazardComponent* Hazard);
+
+	/** Start advancing a hazard's timers; called when it is triggered */
+	void WakeHazard(UEnvironmentalHazardComponent* Hazard);
+
+	/** Closest registered hazard that can trigger within Radius of Location, or null */
+	UEnvironmentalHazardComponent* FindTriggerableHazard(const FVector& Location, float Radius) const;
+
+	// --- Occupants ---
+
+	/** Called from the hazard's trigger. Actors without a combat component are ignored. */
+	void AddOccupant(UEnvironmentalHazardComponent* Hazard, AActor* Actor);
+	void RemoveOccupant(UEnvironmentalHazardComponent* Hazard, AActor* Actor);
+
+	/** Actors currently inside a hazard's trigger */
+	void GetOccupants(const UEnvironmentalHazardComponent* Hazard, TArray<AActor*>& OutActors) const;
+
+	// --- Stats ---
+
+	int32 GetNumHazards() const { return Hazards.Num(); }
+
+	/** Hazards active or cooling down */
+	int32 GetNumTickingHazards() const { return TickingHazards.Num(); }
+
+	/** ReceiveAttack calls made on the last tick */
+	int32 GetNumDamageAppliedLastFrame() const { return NumDamageAppliedLastFrame; }
+
+	/** Wall time of the last tick (ms) */
+	double GetLastTickMs() const { return LastTickMs; }
+
+private:
+	struct FOccupant
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UCombatComponent> Combat;
+	};
+
+	struct FHazardEntry
+	{
+		TWeakObjectPtr<UEnvironmentalHazardComponent> Hazard;
+		TArray<FOccupant> Occupants;
+	};
+
+	/** One fixed damage step over every active damage-over-time hazard */
+	void ApplyDamageStep(float StepSeconds);
+
+	TMap<TObjectKey<UEnvironmentalHazardComponent>, FHazardEntry> Hazards;
+
+	/** Hazards whose timers are running */
+	TArray<TWeakObjectPtr<UEnvironmentalHazardComponent>> TickingHazards;
+
+	/** Unspent time towards the next damage step */
+	float DamageAccumulator = 0.f;
+
+	/** Targets of the current damage step, gathered before any damage lands */
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<UCombatComponent> Combat;
+		TWeakObjectPtr<UEnvironmentalHazardComponent> Hazard;
+		float Damage = 0.f;
+	};
+	TArray<FPendingDamage> PendingDamage;
+
+	int32 NumDamageAppliedLastFrame = 0;
+	double LastTickMs = 0.0;
+
+	/** Damage steps per frame are capped so a long hitch doesn't land them all at once */
+	static constexpr int32 MaxDamageStepsPerFrame = 4;
+};
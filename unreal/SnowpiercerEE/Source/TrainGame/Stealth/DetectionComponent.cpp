@@ -1,22 +1,47 @@
 // Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
 
 #include "DetectionComponent.h"
+#include "PerceptionSubsystem.h"
+#include "NoisePropagationSubsystem.h"
+#include "Engine/World.h"
 
 UDetectionComponent::UDetectionComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Updated by UPerceptionSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UDetectionComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (UPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UPerceptionSubsystem>())
+	{
+		Perception->RegisterDetector(this);
+	}
+	if (UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>())
+	{
+		Noise->RegisterListener(this);
+	}
 }
 
-void UDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UDetectionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (UPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UPerceptionSubsystem>())
+	{
+		Perception->UnregisterDetector(this);
+	}
+	if (UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>())
+	{
+		Noise->UnregisterListener(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
-	UpdateSightDetection(DeltaTime);
+void UDetectionComponent::TickPerception(float DeltaTime, const FSightSample& Sample)
+{
+	UpdateSightDetection(DeltaTime, Sample);
 	DrainDetectionMeter(DeltaTime);
 	UpdateDetectionState();
 	UpdateSearchTimer(DeltaTime);
@@ -47,26 +72,57 @@ void UDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 
 bool UDetectionComponent::ProcessNoiseEvent(const FNoiseEvent& NoiseEvent)
 {
-	// TODO: Check distance against noise radius (accounting for environmental masking)
+	// Masking and bulkheads are already folded into the radius by UNoisePropagationSubsystem
+	if (FVector::Dist(GetOwner()->GetActorLocation(), NoiseEvent.Origin) > NoiseEvent.Radius + HearingRadius)
+	{
+		return false;
+	}
+
 	// TODO: Turn toward sound origin
 	// TODO: Escalate based on intensity (High → Suspicious, Combat → Alerted)
 	// TODO: Track recent sounds for double-sound escalation
 
 	OnNoiseHeard.Broadcast(NoiseEvent);
-	return false;
+	return true;
+}
+
+void UDetectionComponent::GetEyeViewPoint(FVector& OutLocation, FVector& OutForward) const
+{
+	FRotator EyeRotation;
+	GetOwner()->GetActorEyesViewPoint(OutLocation, EyeRotation);
+	OutForward = EyeRotation.Vector();
 }
 
 bool UDetectionComponent::IsTargetInVisionCone(const AActor* Target) const
 {
-	// TODO: Calculate angle to target, check against inner/outer cone
+	if (!Target) return false;
+
+	// Same test UPerceptionSubsystem runs in bulk
+	FVector Eye, Forward;
+	GetEyeViewPoint(Eye, Forward);
+
+	const FVector ToTarget = Target->GetActorLocation() - Eye;
+	const float Distance = ToTarget.Size();
+	if (Distance <= VisionConfig.CloseRange) return true;
+	if (Distance > VisionConfig.MaxRange) return false;
+
 	// TODO: Account for corridor clamping in narrow spaces
-	return false;
+	const float CosAngle = FVector::DotProduct(ToTarget / Distance, Forward);
+	return CosAngle >= FMath::Cos(FMath::DegreesToRadians(VisionConfig.OuterConeHalfAngle));
 }
 
 bool UDetectionComponent::HasLineOfSightTo(const AActor* Target) const
 {
-	// TODO: Line trace from NPC eye height to target, check for blocking geometry
-	return false;
+	if (!Target) return false;
+
+	FVector Eye, Forward;
+	GetEyeViewPoint(Eye, Forward);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(DetectionLineOfSight), false);
+	Params.AddIgnoredActor(GetOwner());
+	Params.AddIgnoredActor(Target);
+
+	return !GetWorld()->LineTraceTestByChannel(Eye, Target->GetActorLocation(), ECC_Visibility, Params);
 }
 
 void UDetectionComponent::NotifyBodyDiscovered(AActor* Body, EBodyState BodyState)
@@ -83,13 +139,47 @@ void UDetectionComponent::ReceiveAlert(EDetectionState MinimumState, FVector Inv
 	LastKnownTargetLocation = InvestigationPoint;
 }
 
-void UDetectionComponent::UpdateSightDetection(float DeltaTime)
+void UDetectionComponent::ResetDetection()
 {
-	// TODO: Find player, check vision cone, check LOS
+	const EDetectionState OldState = CurrentState;
+	const float OldMeter = DetectionMeter;
+
+	CurrentState = EDetectionState::Unaware;
+	DetectionMeter = 0.f;
+	LastKnownTargetLocation = FVector::ZeroVector;
+	bHeightenedAwareness = false;
+	TimeSinceLostSight = 0.f;
+	SearchTimer = 0.f;
+	RadioAlertTimer = 0.f;
+	bRadioAlertPending = false;
+	RecentSoundCount = 0;
+	RecentSoundTimer = 0.f;
+
+	if (OldMeter != DetectionMeter)
+	{
+		OnDetectionMeterChanged.Broadcast(DetectionMeter);
+	}
+	if (OldState != CurrentState)
+	{
+		OnDetectionStateChanged.Broadcast(OldState, CurrentState);
+	}
+}
+
+void UDetectionComponent::UpdateSightDetection(float DeltaTime, const FSightSample& Sample)
+{
+	if (!Sample.bTargetVisible)
+	{
+		TimeSinceLostSight += DeltaTime;
+		return;
+	}
+
+	TimeSinceLostSight = 0.f;
+	LastKnownTargetLocation = Sample.TargetLocation;
+
 	// TODO: Calculate fill rate based on distance band
 	// TODO: Apply lighting, movement, and disguise modifiers
 	// TODO: Apply heightened awareness bonus if flagged
-	// TODO: Fill or drain detection meter
+	// TODO: Fill detection meter
 }
 
 void UDetectionComponent::UpdateDetectionState()
@@ -13,8 +13,24 @@
 // Attached to NPCs. Handles sight and sound perception of the player.
 // Drives the detection meter and state machine (Unaware → Suspicious →
 // Alerted → Combat). Corridor-aware: vision cones clamp to narrow spaces.
+//
+// Does not tick on its own: UPerceptionSubsystem batches the cone and
+// line-of-sight tests for all detectors and calls TickPerception at a rate
+// that depends on how engaged and how close to the player this NPC is.
 // ============================================================================
 
+/** What the perception subsystem saw of the target on one update */
+struct FSightSample
+{
+	const AActor* Target = nullptr;
+	FVector TargetLocation = FVector::ZeroVector;
+	float Distance = 0.f;
+
+	/** In range, in the cone (or close range) and with clear line of sight */
+	bool bTargetVisible = false;
+	bool bInInnerCone = false;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDetectionStateChanged, EDetectionState, OldState, EDetectionState, NewState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDetectionMeterChanged, float, NewMeterValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNoiseHeard, const FNoiseEvent&, NoiseEvent);
@@ -28,11 +44,19 @@ class TRAINGAME_API UDetectionComponent : public UActorComponent
 public:
 	UDetectionComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	/** Advance perception by DeltaTime (all time since this detector's last update). Called by UPerceptionSubsystem. */
+	void TickPerception(float DeltaTime, const FSightSample& Sample);
+
+	/** Eye position and view direction used for sight tests */
+	void GetEyeViewPoint(FVector& OutLocation, FVector& OutForward) const;
+
+	const FVisionConeConfig& GetVisionConfig() const { return VisionConfig; }
+
+	float GetHearingRadius() const { return HearingRadius; }
 
 	// --- Perception ---
 
-	/** Process a noise event. Returns true if the NPC heard it. */
+	/** Process a noise event. Returns true if the NPC heard it. Normally routed here by UNoisePropagationSubsystem. */
 	UFUNCTION(BlueprintCallable, Category = "Stealth|Detection")
 	bool ProcessNoiseEvent(const FNoiseEvent& NoiseEvent);
 
@@ -54,6 +78,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stealth|Detection")
 	void ReceiveAlert(EDetectionState MinimumState, FVector InvestigationPoint);
 
+	/** Return to Unaware with an empty meter and no pending alerts (pooled NPCs being reused) */
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Detection")
+	void ResetDetection();
+
 	/** Whether this NPC has a radio (enables car-wide alert propagation) */
 	UFUNCTION(BlueprintPure, Category = "Stealth|Detection")
 	bool HasRadio() const { return bHasRadio; }
@@ -88,12 +116,19 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// --- Vision ---
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stealth|Vision")
 	FVisionConeConfig VisionConfig;
 
+	// --- Hearing ---
+
+	/** Distance beyond a noise's radius at which this NPC still hears it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stealth|Hearing")
+	float HearingRadius = 200.f;
+
 	// --- Detection Meter ---
 
 	/** Current detection meter value (0-100) */
@@ -147,7 +182,7 @@ protected:
 	bool bIsSecurity = false;
 
 private:
-	void UpdateSightDetection(float DeltaTime);
+	void UpdateSightDetection(float DeltaTime, const FSightSample& Sample);
 	void UpdateDetectionState();
 	void UpdateSearchTimer(float DeltaTime);
 	void DrainDetectionMeter(float DeltaTime);
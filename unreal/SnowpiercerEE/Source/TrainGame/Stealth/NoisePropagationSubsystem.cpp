@@ -0,0 +1,234 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "NoisePropagationSubsystem.h"
+#include "DetectionComponent.h"
+#include "TrainGame/AI/PawnQuerySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+void UNoisePropagationSubsystem::Deinitialize()
+{
+	PendingEvents.Empty();
+	ListenerByPawn.Empty();
+	MaskingSources.Empty();
+	Bulkheads.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UNoisePropagationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNoisePropagationSubsystem, STATGROUP_Tickables);
+}
+
+// --- Noise ---
+
+void UNoisePropagationSubsystem::ReportNoise(const FNoiseEvent& NoiseEvent)
+{
+	if (NoiseEvent.Intensity == ESoundIntensity::None)
+	{
+		return;
+	}
+
+	const float MaskedRadius = NoiseEvent.Radius - GetMaskingAt(NoiseEvent.Origin);
+	if (MaskedRadius <= 0.f)
+	{
+		return; // Completely masked
+	}
+
+	// Merge with an earlier event from the same source this frame
+	for (FNoiseEvent& Pending : PendingEvents)
+	{
+		if (Pending.Instigator == NoiseEvent.Instigator
+			&& FVector::DistSquared(Pending.Origin, NoiseEvent.Origin) <= FMath::Square(CoalesceDistance))
+		{
+			if (MaskedRadius > Pending.Radius)
+			{
+				Pending.Origin = NoiseEvent.Origin;
+				Pending.Radius = MaskedRadius;
+			}
+			Pending.Intensity = FMath::Max(Pending.Intensity, NoiseEvent.Intensity);
+			return;
+		}
+	}
+
+	FNoiseEvent& Queued = PendingEvents.Add_GetRef(NoiseEvent);
+	Queued.Radius = MaskedRadius;
+}
+
+float UNoisePropagationSubsystem::GetMaskingAt(const FVector& Location) const
+{
+	float LocalMasking = 0.f;
+	for (const FMaskingSource& Source : MaskingSources)
+	{
+		if (FVector::DistSquared(Source.Location, Location) <= Source.RadiusSq)
+		{
+			LocalMasking = FMath::Max(LocalMasking, Source.Amount);
+		}
+	}
+	return GlobalMasking + LocalMasking;
+}
+
+// --- Environment ---
+
+void UNoisePropagationSubsystem::RegisterMaskingSource(AActor* Source, float Radius, float Amount)
+{
+	if (!Source)
+	{
+		return;
+	}
+
+	FMaskingSource* Existing = MaskingSources.FindByPredicate([Source](const FMaskingSource& Entry) { return Entry.Source == Source; });
+	FMaskingSource& Entry = Existing ? *Existing : MaskingSources.AddDefaulted_GetRef();
+	Entry.Source = Source;
+	Entry.Location = Source->GetActorLocation();
+	Entry.RadiusSq = FMath::Square(FMath::Max(0.f, Radius));
+	Entry.Amount = FMath::Max(0.f, Amount);
+}
+
+void UNoisePropagationSubsystem::UnregisterMaskingSource(AActor* Source)
+{
+	MaskingSources.RemoveAllSwap([Source](const FMaskingSource& Entry) { return Entry.Source == Source || !Entry.Source.IsValid(); });
+}
+
+void UNoisePropagationSubsystem::RegisterBulkhead(AActor* Bulkhead, float Transmission)
+{
+	if (!Bulkhead)
+	{
+		return;
+	}
+
+	FBulkhead* Existing = Bulkheads.FindByPredicate([Bulkhead](const FBulkhead& Entry) { return Entry.Actor == Bulkhead; });
+	FBulkhead& Entry = Existing ? *Existing : Bulkheads.AddDefaulted_GetRef();
+	Entry.Actor = Bulkhead;
+	Entry.Plane = FPlane(Bulkhead->GetActorLocation(), Bulkhead->GetActorForwardVector());
+	Entry.Transmission = FMath::Clamp(Transmission, 0.f, 1.f);
+}
+
+void UNoisePropagationSubsystem::UnregisterBulkhead(AActor* Bulkhead)
+{
+	Bulkheads.RemoveAllSwap([Bulkhead](const FBulkhead& Entry) { return Entry.Actor == Bulkhead || !Entry.Actor.IsValid(); });
+}
+
+// --- Listeners ---
+
+void UNoisePropagationSubsystem::RegisterListener(UDetectionComponent* Detector)
+{
+	APawn* Pawn = Detector ? Cast<APawn>(Detector->GetOwner()) : nullptr;
+	if (!Pawn)
+	{
+		return;
+	}
+
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery)
+	{
+		return;
+	}
+
+	if (!ListenerByPawn.Contains(Pawn))
+	{
+		PawnQuery->RegisterPawn(Pawn, EPawnQueryTag::Listener);
+	}
+	ListenerByPawn.Add(Pawn, Detector);
+	MaxHearingRadius = FMath::Max(MaxHearingRadius, Detector->GetHearingRadius());
+}
+
+void UNoisePropagationSubsystem::UnregisterListener(UDetectionComponent* Detector)
+{
+	APawn* Pawn = Detector ? Cast<APawn>(Detector->GetOwner()) : nullptr;
+	if (!Pawn || !ListenerByPawn.Remove(Pawn))
+	{
+		return;
+	}
+
+	if (UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>())
+	{
+		PawnQuery->UnregisterPawn(Pawn, EPawnQueryTag::Listener);
+	}
+}
+
+// --- Tick ---
+
+void UNoisePropagationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	NumEventsLastFrame = PendingEvents.Num();
+	NumDeliveriesLastFrame = 0;
+	if (PendingEvents.Num() == 0)
+	{
+		return;
+	}
+
+	// Listeners may raise new noise while reacting; that goes out next frame
+	TArray<FNoiseEvent> Events = MoveTemp(PendingEvents);
+	PendingEvents.Reset();
+
+	for (const FNoiseEvent& Event : Events)
+	{
+		DispatchEvent(Event);
+	}
+}
+
+void UNoisePropagationSubsystem::DispatchEvent(const FNoiseEvent& NoiseEvent)
+{
+	UPawnQuerySubsystem* PawnQuery = GetWorld()->GetSubsystem<UPawnQuerySubsystem>();
+	if (!PawnQuery || ListenerByPawn.Num() == 0)
+	{
+		return;
+	}
+
+	const float Reach = NoiseEvent.Radius + MaxHearingRadius;
+
+	// Only bulkheads within reach of the origin can separate it from a listener
+	NearbyBulkheads.Reset();
+	for (const FBulkhead& Bulkhead : Bulkheads)
+	{
+		if (FMath::Abs(Bulkhead.Plane.PlaneDot(NoiseEvent.Origin)) <= Reach)
+		{
+			NearbyBulkheads.Add(&Bulkhead);
+		}
+	}
+
+	PawnQuery->QueryRadius(NoiseEvent.Origin, Reach, EPawnQueryTag::Listener, CandidatePawns, Cast<APawn>(NoiseEvent.Instigator));
+
+	for (APawn* Pawn : CandidatePawns)
+	{
+		UDetectionComponent* Detector = ListenerByPawn.FindRef(Pawn).Get();
+		if (!Detector)
+		{
+			continue;
+		}
+
+		const FVector ListenerLocation = Pawn->GetActorLocation();
+
+		// A sealed bulkhead stops the noise outright, however keen the listener's hearing
+		const float Transmission = GetTransmissionBetween(NoiseEvent.Origin, ListenerLocation);
+		if (Transmission <= 0.f)
+		{
+			continue;
+		}
+
+		FNoiseEvent Heard = NoiseEvent;
+		Heard.Radius *= Transmission;
+
+		if (FVector::Dist(NoiseEvent.Origin, ListenerLocation) <= Heard.Radius + Detector->GetHearingRadius())
+		{
+			Detector->ProcessNoiseEvent(Heard);
+			++NumDeliveriesLastFrame;
+		}
+	}
+}
+
+float UNoisePropagationSubsystem::GetTransmissionBetween(const FVector& From, const FVector& To) const
+{
+	float Transmission = 1.f;
+	for (const FBulkhead* Bulkhead : NearbyBulkheads)
+	{
+		if ((Bulkhead->Plane.PlaneDot(From) >= 0.f) != (Bulkhead->Plane.PlaneDot(To) >= 0.f))
+		{
+			Transmission *= Bulkhead->Transmission;
+		}
+	}
+	return Transmission;
+}
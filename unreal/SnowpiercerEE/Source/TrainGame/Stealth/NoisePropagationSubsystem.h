@@ -0,0 +1,134 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "TrainGame/Stealth/StealthTypes.h"
+#include "NoisePropagationSubsystem.generated.h"
+
+class UDetectionComponent;
+
+// ============================================================================
+// UNoisePropagationSubsystem
+//
+// Broadcast bus for FNoiseEvents. Footsteps, takedowns, combat and hazards
+// report noise here instead of searching for listeners themselves:
+//
+//   1. Masking: on report, the radius shrinks by the global masking (train
+//      motion) plus the strongest masking source covering the origin (engine
+//      room, kitchen). Fully masked noise is dropped immediately.
+//   2. Coalescing: events from the same instigator within CoalesceDistance in
+//      one frame merge into one, keeping the largest radius and intensity, so
+//      a burst of footsteps and a takedown cost a single dispatch.
+//   3. Routing: once per tick each event queries UPawnQuerySubsystem for
+//      listeners within its radius plus the largest hearing radius, then
+//      checks each candidate against its own hearing radius. Every car
+//      bulkhead between the origin and a listener scales the radius by that
+//      bulkhead's transmission, so noise mostly stays in its own car; a
+//      sealed bulkhead (transmission 0) blocks it outright.
+//
+// Cost therefore scales with the listeners in range of a noise rather than
+// with the number of NPCs on the train.
+// ============================================================================
+
+UCLASS()
+class TRAINGAME_API UNoisePropagationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// --- Noise ---
+
+	/** Queue a noise for dispatch at the end of this frame. Radius is before masking. */
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Noise")
+	void ReportNoise(const FNoiseEvent& NoiseEvent);
+
+	/** Masking (cm of radius removed) that applies to a noise made at Location */
+	UFUNCTION(BlueprintPure, Category = "Stealth|Noise")
+	float GetMaskingAt(const FVector& Location) const;
+
+	// --- Environment ---
+
+	/** Masking applied everywhere, e.g. while the train is moving */
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Noise")
+	void SetGlobalMasking(float Amount) { GlobalMasking = FMath::Max(0.f, Amount); }
+
+	/** Register (or update) a loud area centred on Source. Overlapping sources do not stack. */
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Noise")
+	void RegisterMaskingSource(AActor* Source, float Radius, float Amount);
+
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Noise")
+	void UnregisterMaskingSource(AActor* Source);
+
+	/**
+	 * Register (or update) a car boundary. The plane passes through the actor's
+	 * location with its forward vector as normal. Transmission is the fraction
+	 * of a noise's radius that carries through (1 = open gangway, 0 = sealed).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Noise")
+	void RegisterBulkhead(AActor* Bulkhead, float Transmission);
+
+	UFUNCTION(BlueprintCallable, Category = "Stealth|Noise")
+	void UnregisterBulkhead(AActor* Bulkhead);
+
+	// --- Listeners ---
+
+	void RegisterListener(UDetectionComponent* Detector);
+	void UnregisterListener(UDetectionComponent* Detector);
+
+	int32 GetNumListeners() const { return ListenerByPawn.Num(); }
+
+	/** Events dispatched on the last tick, after coalescing */
+	int32 GetNumEventsLastFrame() const { return NumEventsLastFrame; }
+
+	/** ProcessNoiseEvent calls made on the last tick */
+	int32 GetNumDeliveriesLastFrame() const { return NumDeliveriesLastFrame; }
+
+	/** Same-instigator events closer than this (cm) in one frame are merged */
+	static constexpr float CoalesceDistance = 150.f;
+
+private:
+	struct FMaskingSource
+	{
+		TWeakObjectPtr<AActor> Source;
+		FVector Location = FVector::ZeroVector;
+		float RadiusSq = 0.f;
+		float Amount = 0.f;
+	};
+
+	struct FBulkhead
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FPlane Plane;
+		float Transmission = 0.f;
+	};
+
+	void DispatchEvent(const FNoiseEvent& NoiseEvent);
+
+	/** Product of the transmissions of every bulkhead between From and To */
+	float GetTransmissionBetween(const FVector& From, const FVector& To) const;
+
+	TArray<FNoiseEvent> PendingEvents;
+
+	TMap<TObjectKey<APawn>, TWeakObjectPtr<UDetectionComponent>> ListenerByPawn;
+
+	/** Largest hearing radius ever registered; pads the spatial query */
+	float MaxHearingRadius = 0.f;
+
+	float GlobalMasking = 0.f;
+	TArray<FMaskingSource> MaskingSources;
+	TArray<FBulkhead> Bulkheads;
+
+	// Scratch for routing
+	TArray<APawn*> CandidatePawns;
+	TArray<const FBulkhead*> NearbyBulkheads;
+
+	int32 NumEventsLastFrame = 0;
+	int32 NumDeliveriesLastFrame = 0;
+};
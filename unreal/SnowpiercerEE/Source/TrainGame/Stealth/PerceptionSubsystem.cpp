@@ -0,0 +1,279 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#include "PerceptionSubsystem.h"
+#include "DetectionComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+static TAutoConsoleVariable<int32> CVarPerceptionTraceBudget(
+	TEXT("Stealth.Perception.TraceBudget"),
+	16,
+	TEXT("Maximum line-of-sight traces the perception subsystem issues per frame."));
+
+void UPerceptionSubsystem::Deinitialize()
+{
+	Detectors.Empty();
+	SlotByDetector.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UPerceptionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPerceptionSubsystem, STATGROUP_Tickables);
+}
+
+// --- Registration ---
+
+void UPerceptionSubsystem::RegisterDetector(UDetectionComponent* Detector)
+{
+	if (!Detector || SlotByDetector.Contains(Detector))
+	{
+		return;
+	}
+
+	FDetectorSlot Slot;
+	Slot.Detector = Detector;
+
+	// Spread first updates so detectors spawned together don't share a frame forever
+	Slot.NextUpdateTime = GetWorld()->GetTimeSeconds() + FMath::FRand() * NearIdleInterval;
+
+	SlotByDetector.Add(Detector, Detectors.Add(MoveTemp(Slot)));
+}
+
+void UPerceptionSubsystem::UnregisterDetector(UDetectionComponent* Detector)
+{
+	int32 SlotIndex = INDEX_NONE;
+	if (SlotByDetector.RemoveAndCopyValue(Detector, SlotIndex))
+	{
+		Detectors.RemoveAt(SlotIndex);
+	}
+}
+
+// --- Tick ---
+
+void UPerceptionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	const float Now = World->GetTimeSeconds();
+
+	const APawn* Target = UGameplayStatics::GetPlayerPawn(World, 0);
+	TargetLocation = Target ? Target->GetActorLocation() : FVector::ZeroVector;
+
+	// 1. Schedule
+	DueSlots.Reset();
+	for (TSparseArray<FDetectorSlot>::TIterator It(Detectors); It; ++It)
+	{
+		FDetectorSlot& Slot = *It;
+		UDetectionComponent* Detector = Slot.Detector.Get();
+		if (!Detector)
+		{
+			continue;
+		}
+
+		Slot.AccumulatedTime += DeltaTime;
+		if (Now < Slot.NextUpdateTime)
+		{
+			continue;
+		}
+
+		float Interval = 0.f;
+		if (Detector->GetDetectionState() == EDetectionState::Unaware)
+		{
+			const float FarRange = Detector->GetVisionConfig().MaxRange * FarRangeMultiplier;
+			const bool bFar = !Target
+				|| FVector::DistSquared(Detector->GetOwner()->GetActorLocation(), TargetLocation) > FMath::Square(FarRange);
+			Interval = bFar ? FarIdleInterval : NearIdleInterval;
+		}
+		Slot.NextUpdateTime = Now + Interval;
+
+		DueSlots.Add(It.GetIndex());
+	}
+
+	// 2. Pack and run the cone pass
+	const int32 NumDue = DueSlots.Num();
+	for (TArray<float>* Column : { &EyeX, &EyeY, &EyeZ, &ForwardX, &ForwardY, &ForwardZ, &MaxRangeSq, &CloseRangeSq, &CosInnerSq, &CosOuterSq, &DistanceSq })
+	{
+		Column->SetNumUninitialized(NumDue, EAllowShrinking::No);
+	}
+	ConeResults.SetNumUninitialized(NumDue, EAllowShrinking::No);
+
+	for (int32 i = 0; i < NumDue; ++i)
+	{
+		const UDetectionComponent* Detector = Detectors[DueSlots[i]].Detector.Get();
+		const FVisionConeConfig& Config = Detector->GetVisionConfig();
+
+		FVector Eye, Forward;
+		Detector->GetEyeViewPoint(Eye, Forward);
+		EyeX[i] = Eye.X;
+		EyeY[i] = Eye.Y;
+		EyeZ[i] = Eye.Z;
+		ForwardX[i] = Forward.X;
+		ForwardY[i] = Forward.Y;
+		ForwardZ[i] = Forward.Z;
+
+		MaxRangeSq[i] = FMath::Square(Config.MaxRange);
+		CloseRangeSq[i] = FMath::Square(Config.CloseRange);
+
+		// The squared-dot cone test below only holds for half-angles under 90 degrees
+		CosInnerSq[i] = FMath::Square(FMath::Cos(FMath::DegreesToRadians(FMath::Min(Config.InnerConeHalfAngle, 89.f))));
+		CosOuterSq[i] = FMath::Square(FMath::Cos(FMath::DegreesToRadians(FMath::Min(Config.OuterConeHalfAngle, 89.f))));
+	}
+
+	if (Target)
+	{
+		RunConePass();
+
+		// 3. Line of sight for cone survivors, within budget
+		IssueLineOfSightTraces(Target);
+	}
+	else
+	{
+		// Nothing to see: the columns still hold the last pass, which the samples below must not read
+		FMemory::Memzero(ConeResults.GetData(), NumDue * sizeof(EConeResult));
+		FMemory::Memzero(DistanceSq.GetData(), NumDue * sizeof(float));
+	}
+
+	// 4. Hand each due detector its sample
+	NumUpdatedLastFrame = 0;
+	for (int32 i = 0; i < NumDue; ++i)
+	{
+		// A previous detector's events may have unregistered this one
+		if (!Detectors.IsValidIndex(DueSlots[i]))
+		{
+			continue;
+		}
+
+		FDetectorSlot& Slot = Detectors[DueSlots[i]];
+		UDetectionComponent* Detector = Slot.Detector.Get();
+		if (!Detector)
+		{
+			continue;
+		}
+
+		// Out of cone or range: drop the cached sight line and any trace still in flight, so
+		// re-entering the cone waits for a fresh trace instead of reusing one from before
+		if (ConeResults[i] == EConeResult::None)
+		{
+			Slot.bHasLineOfSight = false;
+			Slot.PendingTrace.Invalidate();
+		}
+
+		FSightSample Sample;
+		Sample.Target = Target;
+		Sample.TargetLocation = TargetLocation;
+		Sample.Distance = FMath::Sqrt(DistanceSq[i]);
+		Sample.bTargetVisible = Target && ConeResults[i] != EConeResult::None && Slot.bHasLineOfSight;
+		Sample.bInInnerCone = ConeResults[i] >= EConeResult::InnerCone;
+
+		const float SliceTime = Slot.AccumulatedTime;
+		Slot.AccumulatedTime = 0.f;
+
+		Detector->TickPerception(SliceTime, Sample);
+		++NumUpdatedLastFrame;
+	}
+}
+
+void UPerceptionSubsystem::RunConePass()
+{
+	const int32 Num = DueSlots.Num();
+	const float TX = TargetLocation.X;
+	const float TY = TargetLocation.Y;
+	const float TZ = TargetLocation.Z;
+
+	// Straight-line arithmetic over contiguous columns; no branches, so the compiler vectorizes it
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const float DX = TX - EyeX[i];
+		const float DY = TY - EyeY[i];
+		const float DZ = TZ - EyeZ[i];
+		const float DistSq = DX * DX + DY * DY + DZ * DZ;
+		const float Dot = DX * ForwardX[i] + DY * ForwardY[i] + DZ * ForwardZ[i];
+
+		// Angle to target within half-angle A  <=>  Dot >= |D| cos A  <=>  Dot > 0 and Dot^2 >= |D|^2 cos^2 A
+		const uint8 bInRange = DistSq <= MaxRangeSq[i];
+		const uint8 bClose = DistSq <= CloseRangeSq[i];
+		const uint8 bFacing = Dot > 0.f;
+		const uint8 bInOuter = bFacing & (Dot * Dot >= DistSq * CosOuterSq[i]);
+		const uint8 bInInner = bFacing & (Dot * Dot >= DistSq * CosInnerSq[i]);
+
+		const uint8 ConeLevel = bInRange * (bInOuter + bInInner);
+		DistanceSq[i] = DistSq;
+		ConeResults[i] = static_cast<EConeResult>(bClose ? static_cast<uint8>(EConeResult::CloseRange) : ConeLevel);
+	}
+}
+
+void UPerceptionSubsystem::IssueLineOfSightTraces(const AActor* Target)
+{
+	NumTracesLastFrame = 0;
+
+	const int32 Budget = CVarPerceptionTraceBudget.GetValueOnGameThread();
+	if (Budget <= 0)
+	{
+		return;
+	}
+
+	// Survivors without a trace in flight, oldest result first
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	for (int32 i = 0; i < DueSlots.Num(); ++i)
+	{
+		if (ConeResults[i] != EConeResult::None && !Detectors[DueSlots[i]].PendingTrace.IsValid())
+		{
+			Candidates.Add(i);
+		}
+	}
+
+	if (Candidates.Num() > Budget)
+	{
+		Candidates.Sort([this](int32 A, int32 B)
+		{
+			return Detectors[DueSlots[A]].LineOfSightFrame < Detectors[DueSlots[B]].LineOfSightFrame;
+		});
+		Candidates.SetNum(Budget, EAllowShrinking::No);
+	}
+
+	UWorld* World = GetWorld();
+	FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &UPerceptionSubsystem::OnTraceCompleted);
+
+	for (const int32 i : Candidates)
+	{
+		const int32 SlotIndex = DueSlots[i];
+		FDetectorSlot& Slot = Detectors[SlotIndex];
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(PerceptionLineOfSight), false);
+		Params.AddIgnoredActor(Slot.Detector->GetOwner());
+		Params.AddIgnoredActor(Target);
+
+		// With owner and target ignored, any blocking hit means the view is obstructed
+		Slot.PendingTrace = World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Test,
+			FVector(EyeX[i], EyeY[i], EyeZ[i]),
+			TargetLocation,
+			ECC_Visibility,
+			Params,
+			FCollisionResponseParams::DefaultResponseParam,
+			&TraceDelegate,
+			static_cast<uint32>(SlotIndex));
+
+		++NumTracesLastFrame;
+	}
+}
+
+void UPerceptionSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 SlotIndex = static_cast<int32>(Datum.UserData);
+
+	// The slot may have been freed, or reused by another detector, while the trace ran
+	if (!Detectors.IsValidIndex(SlotIndex) || Detectors[SlotIndex].PendingTrace != Handle)
+	{
+		return;
+	}
+
+	FDetectorSlot& Slot = Detectors[SlotIndex];
+	Slot.PendingTrace.Invalidate();
+	Slot.LineOfSightFrame = GFrameCounter;
+	Slot.bHasLineOfSight = !Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+}
@@ -0,0 +1,102 @@
+// Copyright Snowpiercer: Eternal Engine. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "PerceptionSubsystem.generated.h"
+
+class UDetectionComponent;
+
+// ============================================================================
+// UPerceptionSubsystem
+//
+// Drives sight perception for every UDetectionComponent in the world, so a
+// car full of guards costs a bounded amount per frame:
+//
+//   1. Schedule: detectors that are engaged (Suspicious or above) or near the
+//      player update every frame; calm ones nearby at NearIdleInterval, calm
+//      distant ones at FarIdleInterval. Intervals are staggered per detector.
+//   2. Cone pass: due detectors are packed into flat arrays and the range and
+//      vision cone tests run as one branch-free loop over them.
+//   3. Line of sight: only cone survivors trace, asynchronously, oldest result
+//      first, at most Stealth.Perception.TraceBudget traces per frame. A
+//      detector uses its latest completed trace until a fresh one lands.
+//   4. Each due detector then gets one TickPerception call with the time
+//      accumulated since its last update.
+// ============================================================================
+
+UCLASS()
+class TRAINGAME_API UPerceptionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterDetector(UDetectionComponent* Detector);
+	void UnregisterDetector(UDetectionComponent* Detector);
+
+	int32 GetNumDetectors() const { return Detectors.Num(); }
+
+	/** Detectors updated on the last tick */
+	int32 GetNumUpdatedLastFrame() const { return NumUpdatedLastFrame; }
+
+	/** LOS traces issued on the last tick */
+	int32 GetNumTracesLastFrame() const { return NumTracesLastFrame; }
+
+	// Update intervals (seconds) for detectors that are not engaged
+	static constexpr float NearIdleInterval = 0.1f;
+	static constexpr float FarIdleInterval = 0.5f;
+
+	/** Beyond this multiple of a detector's sight range it counts as distant */
+	static constexpr float FarRangeMultiplier = 2.f;
+
+private:
+	struct FDetectorSlot
+	{
+		TWeakObjectPtr<UDetectionComponent> Detector;
+
+		// Scheduling
+		float AccumulatedTime = 0.f;
+		float NextUpdateTime = 0.f;
+
+		// Latest completed LOS trace toward the target; cleared whenever the cone or range test fails
+		bool bHasLineOfSight = false;
+		uint64 LineOfSightFrame = 0;
+		FTraceHandle PendingTrace;
+	};
+
+	/** Result of the cone pass for one detector */
+	enum class EConeResult : uint8
+	{
+		None = 0,
+		OuterCone = 1,
+		InnerCone = 2,
+		CloseRange = 3
+	};
+
+	void RunConePass();
+	void IssueLineOfSightTraces(const AActor* Target);
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Stable indices so trace results can find their detector */
+	TSparseArray<FDetectorSlot> Detectors;
+	TMap<TObjectKey<UDetectionComponent>, int32> SlotByDetector;
+
+	// Packed per-frame inputs of due detectors (structure of arrays)
+	TArray<int32> DueSlots;
+	TArray<float> EyeX, EyeY, EyeZ;
+	TArray<float> ForwardX, ForwardY, ForwardZ;
+	TArray<float> MaxRangeSq, CloseRangeSq, CosInnerSq, CosOuterSq;
+	TArray<float> DistanceSq;
+	TArray<EConeResult> ConeResults;
+
+	FVector TargetLocation = FVector::ZeroVector;
+
+	int32 NumUpdatedLastFrame = 0;
+	int32 NumTracesLastFrame = 0;
+};
@@ -5,6 +5,7 @@
 #include "TrainGame/Combat/EnemyCharacter.h"
 #include "TrainGame/Core/CombatTypes.h"
 #include "GameFramework/Character.h"
+#include "NoisePropagationSubsystem.h"
 
 UStealthComponent::UStealthComponent()
 {
@@ -27,21 +28,20 @@ void UStealthComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 
 void UStealthComponent::GenerateNoise(float Radius, ESoundIntensity Intensity)
 {
-	// TODO: Apply environmental masking to radius
-	// TODO: Broadcast noise event to all DetectionComponents in range
-	float MaskedRadius = Radius - CalculateEnvironmentalMasking();
-	if (MaskedRadius <= 0.f)
+	UNoisePropagationSubsystem* Noise = GetWorld()->GetSubsystem<UNoisePropagationSubsystem>();
+	if (!Noise)
 	{
-		return; // Completely masked
+		return;
 	}
 
+	// Masking and routing to listeners happen in the subsystem
 	FNoiseEvent Event;
 	Event.Origin = GetOwner()->GetActorLocation();
-	Event.Radius = MaskedRadius;
+	Event.Radius = Radius;
 	Event.Intensity = Intensity;
 	Event.Instigator = GetOwner();
 
-	// TODO: Find all DetectionComponents in range and call ProcessNoiseEvent
+	Noise->ReportNoise(Event);
 }
 
 float UStealthComponent::GetFootstepNoiseRadius() const
@@ -295,17 +295,28 @@ void UStealthComponent::UpdateFootstepNoise(float DeltaTime)
 {
 	if (CurrentMovement == EStealthMovement::Stationary || bIsHiding)
 	{
+		FootstepNoiseTimer = 0.f;
 		return;
 	}
 
-	// TODO: Generate periodic footstep noise based on movement speed
-	// TODO: Query surface type from physics material
-}
+	// Step cadence and loudness by movement mode
+	float StepInterval = 0.5f;
+	ESoundIntensity Intensity = ESoundIntensity::Low;
+	switch (CurrentMovement)
+	{
+	case EStealthMovement::CrouchWalk:	StepInterval = 0.7f; Intensity = ESoundIntensity::Minimal; break;
+	case EStealthMovement::Walk:		StepInterval = 0.5f; Intensity = ESoundIntensity::Low; break;
+	case EStealthMovement::Run:			StepInterval = 0.35f; Intensity = ESoundIntensity::Medium; break;
+	case EStealthMovement::Sprint:		StepInterval = 0.28f; Intensity = ESoundIntensity::High; break;
+	default: break;
+	}
 
-float UStealthComponent::CalculateEnvironmentalMasking() const
-{
-	// TODO: Query nearby environmental sound sources
-	// Engine room = -1000cm, kitchen = -400cm, etc.
-	// Also check train motion state (moving = -200cm global)
-	return 0.f;
+	FootstepNoiseTimer += DeltaTime;
+	if (FootstepNoiseTimer >= StepInterval)
+	{
+		FootstepNoiseTimer -= StepInterval;
+		GenerateNoise(GetFootstepNoiseRadius(), Intensity);
+	}
+
+	// TODO: Query surface type from physics material
 }
@@ -170,7 +170,6 @@ private:
 	void UpdateMovementMode();
 	void UpdateComposure(float DeltaTime);
 	void UpdateFootstepNoise(float DeltaTime);
-	float CalculateEnvironmentalMasking() const;
 
 	EStealthMovement CurrentMovement = EStealthMovement::Stationary;
 	ESurfaceType CurrentSurface = ESurfaceType::MetalGrating;